@@ -1,8 +1,16 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <format>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include "result.hpp"
 #include "conventions.hpp"
 
@@ -15,17 +23,20 @@ namespace ir {
 
 		Date() = default;
 		//Date(int y, unsigned m, unsigned d) : d_(std::chrono::year{y} / m / d) {}
-		explicit Date(sys_days d) : d_(d) {}
+		constexpr explicit Date(sys_days d) : d_(d) {}
 
-		static Date from_ymd(int y, unsigned m, unsigned d) { return Date{ std::chrono::year{y} / m / d }; }
+		static constexpr Date from_ymd(int y, unsigned m, unsigned d) { return Date{ std::chrono::year{y} / m / d }; }
 		static Result<Date> parse_iso(const std::string_view& iso); // Assumes format "YYYY-MM-DD"
+		// parse_iso without the error: "YYYY-MM-DD" (or "2026-1-5"), nullopt if not a
+		// valid date. No allocation, no exceptions; usable in constant expressions.
+		static constexpr std::optional<Date> try_parse_iso(std::string_view iso) noexcept;
 		std::string to_iso() const { return std::format("{:%Y-%m-%d}", d_); }
 
 		int year() const;
 		unsigned month() const;
 		unsigned day() const;
 
-		sys_days raw() const { return d_; }
+		constexpr sys_days raw() const { return d_; }
 
 		// Operator overloading
 		friend bool operator==(const Date&, const Date&) = default;
@@ -49,24 +60,139 @@ namespace ir {
 		TenorUnit unit{ TenorUnit::Days };
 
 		static Result<Tenor> parse(std::string_view s); // "1D", "2W", "3M", "5Y"
+		// parse without the error: an optionally signed integer and one unit letter
+		// (D/d, W/w, M, Y/y), nullopt otherwise. No allocation, no exceptions; usable in
+		// constant expressions.
+		static constexpr std::optional<Tenor> try_parse(std::string_view s) noexcept;
 
 		// helper queries
 		bool is_zero() const { return n == 0; }
 	};
 
+	constexpr std::optional<Tenor> Tenor::try_parse(std::string_view s) noexcept
+	{
+		if (s.size() < 2) return std::nullopt;
+
+		Tenor t;
+		switch (s.back()) {
+		case 'D': case 'd': t.unit = TenorUnit::Days; break;
+		case 'W': case 'w': t.unit = TenorUnit::Weeks; break;
+		case 'M': t.unit = TenorUnit::Months; break;
+		case 'Y': case 'y': t.unit = TenorUnit::Years; break;
+		default: return std::nullopt;
+		}
+
+		std::size_t i = (s[0] == '+' || s[0] == '-') ? 1 : 0;
+		if (i + 1 == s.size()) return std::nullopt;
+		long long n = 0;
+		for (; i + 1 < s.size(); ++i) {
+			if (s[i] < '0' || s[i] > '9') return std::nullopt;
+			n = n * 10 + (s[i] - '0');
+			if (n > std::numeric_limits<int>::max()) return std::nullopt;
+		}
+		t.n = static_cast<int>(s[0] == '-' ? -n : n);
+		return t;
+	}
+
+	constexpr std::optional<Date> Date::try_parse_iso(std::string_view iso) noexcept
+	{
+		// Three '-' separated runs of digits
+		int seg[3]{};
+		std::size_t n = 0;
+		std::size_t digits = 0;
+		for (const char c : iso) {
+			if (c == '-') {
+				if (digits == 0 || n == 2) return std::nullopt;
+				++n;
+				digits = 0;
+			}
+			else if (c >= '0' && c <= '9' && digits < 9) {
+				seg[n] = seg[n] * 10 + (c - '0');
+				++digits;
+			}
+			else {
+				return std::nullopt;
+			}
+		}
+		if (n != 2 || digits == 0 || seg[0] > 32767) return std::nullopt;
+
+		const std::chrono::year_month_day ymd{ std::chrono::year{ seg[0] },
+			std::chrono::month{ static_cast<unsigned>(seg[1]) }, std::chrono::day{ static_cast<unsigned>(seg[2]) } };
+		if (seg[1] > 12 || seg[2] > 31 || !ymd.ok()) return std::nullopt;   // e.g. 2026-02-30
+		return Date{ std::chrono::sys_days{ ymd } };
+	}
+
+	// Compile-time literals: "3M"_tenor, "2025-09-30"_date. A malformed literal does
+	// not compile.
+	namespace literals {
+
+		consteval Tenor operator""_tenor(const char* s, std::size_t n)
+		{
+			const auto t = Tenor::try_parse(std::string_view{ s, n });
+			if (!t) throw "invalid tenor literal";
+			return *t;
+		}
+
+		consteval Date operator""_date(const char* s, std::size_t n)
+		{
+			const auto d = Date::try_parse_iso(std::string_view{ s, n });
+			if (!d) throw "invalid date literal";
+			return *d;
+		}
+
+	} // namespace literals
+
 
 	// Calendar
+	//
+	// Weekends plus an optional holiday list, as a dense table over a date range: one
+	// business-day bit per date, the number of business days before each 64-day word,
+	// and the offset of every business day. Membership, adjust, advance_business_days
+	// and business_days_between are O(1) inside the range (a popcount and a lookup);
+	// outside it only weekends are holidays and dates are stepped one by one. Tables
+	// are immutable and shared, so a Calendar is cheap to copy. A default Calendar is
+	// weekends-only.
 	class Calendar {
 	public:
-		// v1: weekends-only. later: store holiday set.
+		Calendar() = default;
+
+		// Range of the tables when none is given: [1970-01-01, 2100-01-01)
+		static Date default_first();
+		static Date default_last();
+
+		// Weekends plus `holidays` over [first, last); holidays outside are ignored.
+		static Calendar from_holidays(std::string name, std::span<const Date> holidays,
+			Date first = default_first(), Date last = default_last());
+		// Joint calendar (e.g. USNY+GBLO): a holiday in either is a holiday. Named
+		// "<a>+<b>", over the union of both ranges.
+		static Calendar join(const Calendar& a, const Calendar& b);
+
+		const std::string& name() const;   // "WEEKENDS" for the default
+		// Hash of the table range and business days: equal for calendars with the same
+		// holidays, whatever their names; differs (up to collisions) when they differ.
+		std::uint64_t fingerprint() const;
+
 		bool is_business_day(const Date& d) const;
 		Date adjust(const Date& d, BusinessDayConvention bdc) const;
 
 		// advance by tenor (calendar-aware) then adjust
 		Date advance(const Date& d, const Tenor& t, BusinessDayConvention bdc) const;
 
+		// The n-th business day after d (before it for n < 0); adjust(d, Following) for n == 0
+		Date advance_business_days(const Date& d, int n) const;
+		// Business days in [from, to); negative when to < from
+		long business_days_between(const Date& from, const Date& to) const;
+
 	private:
+		struct Table;
+		explicit Calendar(std::shared_ptr<const Table> t) : table_(std::move(t)) {}
+		const Table& table() const;
+
 		static bool is_weekend(const Date& d);
+		Date following(const Date& d) const;
+		Date preceding(const Date& d) const;
+
+		std::shared_ptr<const Table> table_;   // null: the shared weekends-only table
 	};
 
 	// year fraction
@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "date.hpp"
+
+namespace ir {
+
+	// Thread-safe cache of generated schedules, keyed on (start, end, tenor, calendar
+	// fingerprint, bdc, rule, end_of_month). Standardised swaps share most of their
+	// schedules, so a book is generated once per distinct configuration. Schedules are
+	// immutable once cached and shared between callers.
+	//
+	// Calendars are identified by Calendar::fingerprint(), i.e. by their holidays and
+	// range, not their names. At most max_entries schedules are kept; the least
+	// recently used is dropped to make room.
+	class ScheduleCache {
+	public:
+		struct Stats {
+			std::size_t hits{ 0 };      // requests served from the cache
+			std::size_t misses{ 0 };    // schedules generated
+			std::size_t entries{ 0 };
+			std::size_t evictions{ 0 };  // entries dropped at capacity
+		};
+
+		static constexpr std::size_t kDefaultMaxEntries = 16384;
+
+		explicit ScheduleCache(std::size_t max_entries = kDefaultMaxEntries);   // at least 1
+
+		// make_schedule(cfg), generated on the first request for its key
+		std::shared_ptr<const Schedule> get(const ScheduleConfig& cfg);
+
+		Stats stats() const;
+		void clear();                   // drops entries and resets the counters
+
+		// Process-wide cache used by the rate helpers and ire_price, kDefaultMaxEntries
+		static ScheduleCache& global();
+
+	private:
+		struct Key {
+			std::int32_t start{ 0 };    // days since epoch
+			std::int32_t end{ 0 };
+			std::int32_t tenor_n{ 0 };
+			TenorUnit tenor_unit{ TenorUnit::Months };
+			BusinessDayConvention bdc{ BusinessDayConvention::ModifiedFollowing };
+			DateGenerationRule rule{ DateGenerationRule::Backward };
+			bool end_of_month{ false };
+			std::uint64_t calendar{ 0 };  // Calendar::fingerprint()
+
+			bool operator==(const Key&) const = default;
+		};
+		struct KeyHash {
+			std::size_t operator()(const Key& k) const;
+		};
+
+		using Lru = std::list<std::pair<Key, std::shared_ptr<const Schedule>>>;
+
+		std::size_t max_entries_;
+		mutable std::mutex m_;
+		Lru lru_;                       // most recently used first
+		std::unordered_map<Key, Lru::iterator, KeyHash> index_;
+
+		std::atomic<std::size_t> hits_{ 0 };
+		std::atomic<std::size_t> misses_{ 0 };
+		std::atomic<std::size_t> evictions_{ 0 };
+	};
+
+} // namespace ir
@@ -10,6 +10,14 @@ namespace ir::market {
 
 namespace ir::instruments {
 
+    // Realised compounded factor prod(1 + r_d * dt_d) of an RFR observation over the
+    // days [obs.start, until), from the fixing history. 1 when until <= obs.start;
+    // nullopt if a fixing is missing. Every pricer and risk engine compounds realised
+    // RFR days through this.
+    std::optional<double> realised_rfr_compound(const RfrObservation& obs,
+        const ir::market::FixingStore& fixings,
+        const ir::Date& until);
+
     class FixedCoupon final : public Cashflow {
     public:
         FixedCoupon(ir::Date pay_date, double amount);
@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+#include "ir/core/date.hpp"
+#include "ir/core/result.hpp"
+
+namespace ir::io {
+
+	// Holiday calendars from holiday lists: one ISO date (YYYY-MM-DD) per line, in the
+	// first CSV column (later columns, e.g. a holiday name, are ignored). Blank lines,
+	// lines starting with '#' and a non-date first line (header) are skipped. The
+	// calendar covers [first, last) as in Calendar::from_holidays.
+	ir::Result<ir::Calendar> parse_holiday_calendar(std::string_view text, std::string name,
+		ir::Date first = ir::Calendar::default_first(), ir::Date last = ir::Calendar::default_last());
+	ir::Result<ir::Calendar> load_holiday_calendar(const std::string& file_path, std::string name,
+		ir::Date first = ir::Calendar::default_first(), ir::Date last = ir::Calendar::default_last());
+
+} // namespace ir::io
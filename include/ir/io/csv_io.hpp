@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -25,6 +27,59 @@ namespace ir::io {
 	ir::Result<CsvTable> read_csv_text(std::string_view text, const CsvOptions& opt = {});
 	ir::Result<CsvTable> read_csv_file(const std::string& file_path, const CsvOptions& opt = {});
 
+	// Read-only bytes of a file, memory-mapped (POSIX mmap / Win32 MapViewOfFile) so
+	// nothing is copied. An empty file gives an empty view. Move-only.
+	class MappedFile {
+	public:
+		static ir::Result<MappedFile> open(const std::string& file_path);
+
+		MappedFile() = default;
+		MappedFile(MappedFile&& o) noexcept;
+		MappedFile& operator=(MappedFile&& o) noexcept;
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		~MappedFile();
+
+		std::string_view text() const { return { data_, size_ }; }
+
+	private:
+		void close();
+
+		const char* data_{ nullptr };
+		std::size_t size_{ 0 };
+#ifdef _WIN32
+		void* file_{ nullptr };      // HANDLE
+		void* mapping_{ nullptr };   // HANDLE
+#endif
+	};
+
+	// Columnar CSV: columns[c][r] is the cell of row r under headers[c], as a view into
+	// the source text (no per-cell allocation). Tables read from a file own the mapping
+	// in `source`; tables read from text require the caller to keep the text alive.
+	struct CsvColumns {
+		std::vector<std::string> headers;
+		std::vector<std::vector<std::string_view>> columns;
+		std::string_view text{};                      // the tokenised text
+		std::shared_ptr<const MappedFile> source{};
+
+		std::size_t rows() const { return columns.empty() ? 0 : columns.front().size(); }
+
+		// Position / cells of the column with this header (look up once, then index by row).
+		ir::Result<std::size_t> index(std::string_view header) const;
+		ir::Result<const std::vector<std::string_view>*> column(std::string_view header) const;
+
+		// "'<cell>' (<header>, line L, column C)" for error messages. Line and column
+		// are recovered from the cell's position in `text`, so nothing is stored per row.
+		std::string describe(std::size_t col, std::size_t row) const;
+	};
+
+	ir::Result<CsvColumns> read_csv_columns_text(std::string_view text, const CsvOptions& opt = {});
+	ir::Result<CsvColumns> read_csv_columns_file(const std::string& file_path, const CsvOptions& opt = {});
+
+	// Allocation- and exception-free cell parser (std::from_chars). The whole view must
+	// be a number; a leading '+' is accepted.
+	ir::Result<double> parse_double(std::string_view s);
+
 	// Helper utilities
 	std::string trim_copy(std::string s);
 	std::vector<std::string> split_line(std::string_view line, char sep);
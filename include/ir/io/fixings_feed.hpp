@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "ir/core/date.hpp"
+#include "ir/core/ids.hpp"
+#include "ir/core/result.hpp"
+#include "ir/market/quotes.hpp"
+
+namespace ir::io {
+
+    struct FeedRefresh {
+        std::size_t rows{ 0 };           // fixings added by this call
+        std::uint64_t bytes_read{ 0 };   // bytes read from the history file
+        bool full_reload{ false };       // whole file parsed (first load, rewrite, truncation)
+    };
+
+    // Incremental loader for append-only fixing histories (Date,Rate CSV, one row
+    // appended per fixing). The first refresh of a file parses it in full; later ones
+    // read only the bytes appended since, up to the last complete line, so a writer
+    // caught mid-row is picked up on the next refresh.
+    //
+    // Per file the feed keeps the byte offset consumed, a hash of the header line and
+    // of the last 4 KB before the offset, and the newest fixing loaded. A refresh checks
+    // the file still has that prefix and falls back to a full reload if it was rewritten
+    // or truncated (the reload overwrites fixings by date; it does not remove any).
+    // The same state is written to a sidecar "<file>.idx" after every refresh; a new
+    // feed resumes from it (instead of reparsing) when its store already ends with the
+    // sidecar's newest fixing, e.g. a store restored with load_snapshot.
+    //
+    // Not thread-safe; one feed per store.
+    class FixingsFeed {
+    public:
+        explicit FixingsFeed(ir::market::FixingStore& store, bool write_sidecar = true)
+            : store_(store), write_sidecar_(write_sidecar) {}
+
+        ir::Result<FeedRefresh> refresh(const std::string& path, const ir::IndexId& index);
+
+        static std::string sidecar_path(const std::string& path) { return path + ".idx"; }
+
+    private:
+        struct FileState {
+            std::string index;
+            std::string header;              // first line, without the newline
+            std::uint64_t consumed{ 0 };     // bytes parsed (always ends on a newline)
+            std::uint64_t header_hash{ 0 };
+            std::uint64_t tail_hash{ 0 };    // last kTailWindow bytes before `consumed`
+            std::size_t rows{ 0 };
+            ir::Date last_date{};
+            double last_rate{ 0.0 };
+        };
+
+        ir::Result<FeedRefresh> full_load(const std::string& path, const ir::IndexId& index, FileState& st);
+        bool resume_from_sidecar(const std::string& path, const ir::IndexId& index, FileState& st) const;
+        void save_sidecar(const std::string& path, const FileState& st) const;
+
+        ir::market::FixingStore& store_;
+        bool write_sidecar_;
+        std::unordered_map<std::string, FileState> files_;   // by path as given
+    };
+
+} // namespace ir::io
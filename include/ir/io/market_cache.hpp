@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/ids.hpp"
+#include "ir/core/result.hpp"
+#include "ir/io/snapshot.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/quotes.hpp"
+
+namespace ir::io {
+
+    // 64-bit FNV-1a hash of a byte string.
+    std::uint64_t fnv1a_64(std::string_view bytes);
+
+    // Thread-safe cache of market CSV files shared by many deals (ire_price --batch).
+    // Each distinct path is read, hashed (FNV-1a) and tokenised once; each distinct
+    // (content hash, file kind, asof) is built once, so copies of the same file in
+    // different folders share one curve. Curves are fully built before they are
+    // returned and never modified afterwards, so the same shared_ptr can be registered
+    // in many MarketData objects priced concurrently.
+    class MarketFileCache {
+    public:
+        using FixingRows = std::vector<std::pair<ir::Date, double>>;
+
+        struct Stats {
+            std::size_t files_read{ 0 };   // distinct paths read from disk
+            std::size_t built{ 0 };        // curves, fixing series and stores built
+            std::size_t hits{ 0 };         // requests served from the cache
+        };
+
+        ir::Result<std::shared_ptr<ir::market::PiecewiseDiscountCurve>>
+            discount_curve(const std::string& path, const ir::Date& asof);
+
+        ir::Result<std::shared_ptr<ir::market::PiecewiseForwardCurve>>
+            forward_curve(const std::string& path, const ir::Date& asof);
+
+        ir::Result<std::shared_ptr<const FixingRows>> fixings(const std::string& path);
+
+        // One store holding the fixings of every (index, file) pair, built once per
+        // distinct set of index ids and file contents (in any order), so deals that read
+        // the same fixing files share it instead of each filling their own. Where two
+        // files give the same index and day, the one whose content sorts last wins.
+        ir::Result<std::shared_ptr<const ir::market::FixingStore>>
+            fixing_store(const std::vector<std::pair<ir::IndexId, std::string>>& files);
+
+        // Whole market from a binary snapshot (see snapshot.hpp), loaded once per path.
+        ir::Result<std::shared_ptr<const MarketSnapshot>> snapshot(const std::string& path);
+
+        Stats stats() const;
+
+    private:
+        struct Slot;
+        using SlotMap = std::unordered_map<std::string, std::shared_ptr<Slot>>;
+
+        std::shared_ptr<Slot> slot(SlotMap& map, const std::string& key);
+        std::shared_ptr<Slot> file(const std::string& path);
+        static std::string canonical_key(const std::string& path);
+
+        template <class T, class Build>
+        ir::Result<std::shared_ptr<T>> object(const char* kind, const std::string& path,
+            const std::string& asof_key, Build&& build);
+
+        std::mutex m_;
+        SlotMap files_;     // canonical path -> mapped, tokenised table and content hash
+        SlotMap objects_;   // kind|asof|hash (or snapshot|path) -> built object
+
+        std::atomic<std::size_t> files_read_{ 0 };
+        std::atomic<std::size_t> built_{ 0 };
+        std::atomic<std::size_t> hits_{ 0 };
+    };
+
+} // namespace ir::io
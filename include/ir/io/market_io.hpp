@@ -1,11 +1,15 @@
 #pragma once
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "ir/core/date.hpp"
 #include "ir/core/result.hpp"
 #include "ir/core/ids.hpp"
 #include "ir/market/market_data.hpp"
 #include "ir/market/curves.hpp"
+#include "ir/io/csv_io.hpp"
 
 namespace ir::io {
 
@@ -22,4 +26,14 @@ namespace ir::io {
         const ir::IndexId& index,
         ir::market::FixingStore& store);
 
+    // Builders behind the loaders, for callers that share one parsed file between
+    // several MarketData objects (see MarketFileCache).
+    ir::Result<std::shared_ptr<ir::market::PiecewiseDiscountCurve>>
+        discount_curve_from_csv(const CsvColumns& tab, const ir::Date& asof);
+
+    ir::Result<std::shared_ptr<ir::market::PiecewiseForwardCurve>>
+        forward_curve_from_csv(const CsvColumns& tab, const ir::Date& asof);
+
+    ir::Result<std::vector<std::pair<ir::Date, double>>> fixings_from_csv(const CsvColumns& tab);
+
 } // namespace ir::io
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/core/result.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+
+namespace ir::io {
+
+    // Versioned binary snapshot of a MarketData: piecewise discount/forward curves
+    // (nodes and Config), quotes and the fixing store, in one file.
+    //
+    // Layout (native little-endian; every block 8-byte aligned):
+    //   SnapshotHeader | CurveRecord[discount] | CurveRecord[forward] | QuoteRecord[]
+    //   | FixingRecord[] | string pool | doubles (node t[], node v[], per-day curve
+    //   values, per-day fixings)
+    // Records reference names in the string pool and arrays in the double block by
+    // byte offset, so loading is bounds checks and memcpy from the mapped file: no text
+    // parsing, and curves with date_cache_values take their per-day table as saved
+    // instead of re-evaluating ~22k days each (the shared t tables are rebuilt).
+    inline constexpr std::uint32_t kSnapshotVersion = 1;
+
+    // The loaded market. MarketData points at `fixings`, so keep them together.
+    struct MarketSnapshot {
+        std::unique_ptr<ir::market::FixingStore> fixings;
+        std::unique_ptr<ir::market::MarketData> md;
+    };
+
+    // Writes md (and its fixing store, if set) to path. Fails if a curve is not a
+    // PiecewiseDiscountCurve / PiecewiseForwardCurve.
+    ir::Result<std::size_t> save_snapshot(const ir::market::MarketData& md, const std::string& path);
+
+    ir::Result<MarketSnapshot> load_snapshot(const std::string& path);
+
+} // namespace ir::io
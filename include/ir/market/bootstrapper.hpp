@@ -7,13 +7,72 @@
 #include "ir/market/curves.hpp"
 #include "ir/market/rate_helpers.hpp"
 #include "ir/utils/root_finding.hpp"
+#include "ir/utils/sparse_matrix.hpp"
 
 namespace ir::market {
 
+    enum class PillarSolver {
+        Brent,      // bracketing solve over [df_min, df_max]
+        Newton      // analytic d(quote)/d(last node), seeded from the previous pillar's
+                    // zero rate; falls back to Brent if it fails
+    };
+
     struct BootstrapOptions {
         ir::utils::RootFindOptions solver{};
         double df_min = 1e-8;      // bracket lower bound for DF
         double df_max = 1.0;       // bracket upper bound for DF
+
+        // Incremental mode mutates only the last node in place during the solve, so a
+        // curve build is linear in the number of pillars. Set false to rebuild the full
+        // interpolator per objective call (legacy behaviour, kept for validation).
+        bool incremental = true;
+
+        PillarSolver pillar_solver = PillarSolver::Brent;
+    };
+
+    // Solver statistics of one bootstrap run (optional output).
+    struct BootstrapReport {
+        int pillars = 0;
+        int iterations = 0;         // solver iterations, summed over pillars
+        int evaluations = 0;        // objective calls, summed over pillars
+        int newton_fallbacks = 0;   // pillars where Newton failed and Brent was used
+
+        double avg_iterations_per_pillar() const {
+            return pillars > 0 ? static_cast<double>(iterations) / pillars : 0.0;
+        }
+        double avg_evaluations_per_pillar() const {
+            return pillars > 0 ? static_cast<double>(evaluations) / pillars : 0.0;
+        }
+    };
+
+    // Sensitivity of a sequentially bootstrapped curve to its market quotes (optional
+    // output). Pillar i solves implied_i(x_1..x_i) = quote_i, so by the implicit function
+    // theorem dx/dq = J^-1 with J = d implied / d x at the solution, lower triangular:
+    // one forward substitution per quote instead of one re-bootstrap per quote bump.
+    struct BootstrapSensitivities {
+        // d(node value)/d(quote). Rows: curve nodes (row 0, the t = 0 node, is empty);
+        // columns: helpers in maturity order.
+        ir::utils::SparseMatrix d_node_d_quote;
+        std::vector<ir::Date> quote_maturities;   // per column
+
+        // Forward curves: d(node value)/d(discount node value) with the quotes held
+        // fixed (IRS helpers discount on the given curve). Rows as above; columns:
+        // nodes of the discount curve. Empty (0 x 0) for a discount curve.
+        ir::utils::SparseMatrix d_node_d_discount;
+    };
+
+    // Result of the joint discount + forward solve.
+    struct JointBootstrapResult {
+        std::shared_ptr<PiecewiseDiscountCurve> discount;
+        std::shared_ptr<PiecewiseForwardCurve> forward;
+
+        // d(implied quote)/d(node value) at the solution.
+        // Rows: OIS helpers, then FRA/IRS helpers (each group sorted by maturity).
+        // Columns: discount nodes 1..n, then forward nodes 1..m (t=0 nodes are fixed).
+        ir::utils::SparseMatrix jacobian;
+
+        int iterations = 0;              // Newton iterations
+        double max_abs_residual = 0.0;   // max |implied - quote| at the solution
     };
 
     class CurveBootstrapper {
@@ -23,7 +82,9 @@ namespace ir::market {
             bootstrap_discount_curve(const ir::Date& asof,
                 PiecewiseDiscountCurve::Config cfg,
                 const std::vector<std::shared_ptr<OisSwapHelper>>& helpers,
-                const BootstrapOptions& opts = {}) const;
+                const BootstrapOptions& opts = {},
+                BootstrapReport* report = nullptr,
+                BootstrapSensitivities* sensitivities = nullptr) const;
 
         // Forward curve from FRA/IRS helpers, given discount curve
         ir::Result<std::shared_ptr<PiecewiseForwardCurve>>
@@ -31,6 +92,19 @@ namespace ir::market {
                 PiecewiseForwardCurve::Config cfg,
                 const PiecewiseDiscountCurve& discount_curve,
                 const std::vector<std::shared_ptr<RateHelper>>& helpers,
+                const BootstrapOptions& opts = {},
+                BootstrapReport* report = nullptr,
+                BootstrapSensitivities* sensitivities = nullptr) const;
+
+        // Discount and forward curves solved simultaneously: global Newton-Raphson over
+        // all node values with the analytic Jacobian of the helpers. Converged when
+        // max |implied - quote| <= opts.solver.tol_abs; at most opts.solver.max_iter steps.
+        ir::Result<JointBootstrapResult>
+            bootstrap_curves_jointly(const ir::Date& asof,
+                PiecewiseDiscountCurve::Config disc_cfg,
+                PiecewiseForwardCurve::Config fwd_cfg,
+                const std::vector<std::shared_ptr<OisSwapHelper>>& ois_helpers,
+                const std::vector<std::shared_ptr<RateHelper>>& fwd_helpers,
                 const BootstrapOptions& opts = {}) const;
     };
 
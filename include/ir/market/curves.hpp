@@ -1,4 +1,9 @@
 #pragma once
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
 #include "ir/core/date.hpp"
 #include "ir/core/conventions.hpp"
 #include "ir/core/ids.hpp"
@@ -31,6 +36,12 @@ namespace ir::market {
 
 		// Optional convenience (implemented in derived or as helper)
 		virtual double df(double t) const = 0; // t in year units used by this curve
+
+		// Batch evaluation: out[i] = df(t[i]) / df(d[i]), out.size() == input size.
+		// The defaults loop over the scalar calls; piecewise curves override them with a
+		// single vectorised pass. Ascending inputs are fastest.
+		virtual void df_batch(std::span<const double> t, std::span<double> out) const;
+		virtual void df_batch(std::span<const ir::Date> d, std::span<double> out) const;
 	};
 
 	class ForwardCurve : public Curve {
@@ -44,6 +55,46 @@ namespace ir::market {
 			ir::DayCount dc) const = 0;
 	};
 
+	// Suggested Config::date_cache_days: 60 years of calendar days.
+	inline constexpr int kDateCache60Y = 60 * 366;
+
+	// Dense lookup tables indexed by the day offset of a date from the curve's asof,
+	// replacing year_fraction (and optionally the interpolation) in date-based queries.
+	// The t table depends only on (asof, dc, days) and is shared between curves; the
+	// value table belongs to one curve and follows its nodes.
+	class DateCache {
+	public:
+		void init(const ir::Date& asof, ir::DayCount dc, int days);
+
+		bool enabled() const { return t_ != nullptr; }
+
+		// Offset of d in the table, or -1 if outside it (or disabled)
+		std::ptrdiff_t offset(const ir::Date& asof, const ir::Date& d) const {
+			if (!t_) return -1;
+			const auto i = static_cast<std::ptrdiff_t>((d - asof).count());
+			return (i >= 0 && i < static_cast<std::ptrdiff_t>(t_->size())) ? i : -1;
+		}
+		double t(std::ptrdiff_t i) const { return (*t_)[static_cast<std::size_t>(i)]; }
+
+		bool has_values() const { return !v_.empty(); }
+		double value(std::ptrdiff_t i) const { return v_[static_cast<std::size_t>(i)]; }
+		void rebuild_values(const ir::utils::LogLinearKernel& kernel);   // kernel.ready()
+		void clear_values() { v_.clear(); }
+		// Takes a value table built earlier from the same nodes (e.g. a snapshot). Returns
+		// false, leaving no values, if its size or end points do not match kernel.
+		bool adopt_values(std::span<const double> v, const ir::utils::LogLinearKernel& kernel);
+		// Re-evaluates only the days with t in [t_lo, t_hi] (no-op without values)
+		void refresh_values(const ir::utils::LogLinearKernel& kernel, double t_lo, double t_hi);
+		std::span<const double> values() const { return v_; }
+
+		// Bytes held: the (shared) t table plus this curve's value table
+		std::size_t bytes() const;
+
+	private:
+		std::shared_ptr<const std::vector<double>> t_;
+		std::vector<double> v_;
+	};
+
 	class PiecewiseDiscountCurve final : public DiscountCurve {
 	public:
 		struct Config {
@@ -51,17 +102,52 @@ namespace ir::market {
 			ir::Calendar calendar{};
 			ir::BusinessDayConvention bdc{ ir::BusinessDayConvention::ModifiedFollowing };
 			// For conversion Date->t (year fraction from asof)
+
+			// Date -> t table over [asof, asof + date_cache_days) (0 = off), e.g.
+			// kDateCache60Y (~172 KB, shared by curves with the same asof and dc).
+			int date_cache_days{ 0 };
+			// Also tabulate the DF per day (8 bytes/day for this curve). Built by set_nodes
+			// and rebuild_date_cache(); push_node / set_last_value drop it until rebuilt.
+			bool date_cache_values{ false };
 		};
 
 		PiecewiseDiscountCurve(const ir::Date& asof, Config cfg);
 
 		// Build/update nodes
 		ir::Result<int> set_nodes(ir::utils::Nodes1D nodes_df); // nodes_df.v are DFs
+		// As set_nodes, reusing a per-day DF table saved from date_cache_values() instead
+		// of recomputing it (recomputed anyway if it does not fit the nodes and Config).
+		ir::Result<int> set_nodes(ir::utils::Nodes1D nodes_df, std::span<const double> date_cache_values);
+
+		// Incremental updates (bootstrapping): append a node / replace the last DF in place,
+		// without rebuilding the interpolator.
+		ir::Result<int> push_node(double t, double df);
+		ir::Result<int> set_last_value(double df);
+		// Replace node i's DF in place (bumps): only the two adjacent segments and the
+		// per-day table over [t(i-1), t(i+1)] (to the end for the last node) change.
+		ir::Result<int> set_node_value(std::size_t i, double df);
 
 		// DiscountCurve
 		double df(const ir::Date& d) const override;
 		double df(double t) const override;
 
+		// Hinted lookup: `hint` is a caller-owned segment index carried across calls,
+		// so evaluating increasing times walks the nodes instead of binary-searching.
+		double df(double t, std::size_t& hint) const;
+
+		void df_batch(std::span<const double> t, std::span<double> out) const override;
+		void df_batch(std::span<const ir::Date> d, std::span<double> out) const override;
+
+		// Recompute the per-day DF table (after incremental node updates)
+		void rebuild_date_cache();
+		std::size_t date_cache_bytes() const { return date_cache_.bytes(); }
+		std::span<const double> date_cache_values() const { return date_cache_.values(); }
+
+		// DF at t and its partial derivatives w.r.t. the node DFs (for Newton / Jacobians)
+		ir::utils::NodeGradient df_gradient(double t) const;
+		ir::utils::NodeGradient df_gradient(double t, std::size_t& hint) const;
+		ir::utils::NodeGradient df_gradient(const ir::Date& d) const;   // t as in df(d)
+
 		// Accessors (handy for tests/diagnostics)
 		const ir::utils::Nodes1D& nodes() const { return nodes_df_; }
 		const Config& config() const { return cfg_; }
@@ -69,19 +155,32 @@ namespace ir::market {
 	private:
 		Config cfg_;
 		ir::utils::Nodes1D nodes_df_;
-		std::unique_ptr<ir::utils::IInterpolator1D> interp_; // log-linear on DF
+		ir::utils::LogLinearKernel kernel_; // log-linear on DF
+		DateCache date_cache_;
+
+		double time_of(const ir::Date& d) const;
 	};
 
 	class PiecewiseForwardCurve final : public ForwardCurve {
 	public:
 		struct Config {
 			ir::DayCount dc{ ir::DayCount::ACT365 };
+
+			// See PiecewiseDiscountCurve::Config; values are pseudo-DFs
+			int date_cache_days{ 0 };
+			bool date_cache_values{ false };
 		};
 
 		PiecewiseForwardCurve(const ir::Date& asof, Config cfg);
 
 		// Nodes represent pseudo-DFs P_f(t) > 0
 		ir::Result<int> set_nodes(ir::utils::Nodes1D nodes_pf);
+		ir::Result<int> set_nodes(ir::utils::Nodes1D nodes_pf, std::span<const double> date_cache_values);
+
+		// Incremental updates (bootstrapping), see PiecewiseDiscountCurve.
+		ir::Result<int> push_node(double t, double pf);
+		ir::Result<int> set_last_value(double pf);
+		ir::Result<int> set_node_value(std::size_t i, double pf);
 
 		// ForwardCurve
 		double forward_rate(const ir::Date& start,
@@ -90,13 +189,27 @@ namespace ir::market {
 
 		// Convenience
 		double pf(double t) const;   // pseudo DF
+		double pf(double t, std::size_t& hint) const;   // hinted, see PiecewiseDiscountCurve::df
+		void pf_batch(std::span<const double> t, std::span<double> out) const;   // see DiscountCurve::df_batch
+		ir::utils::NodeGradient pf_gradient(double t) const;
+		ir::utils::NodeGradient pf_gradient(double t, std::size_t& hint) const;
+		ir::utils::NodeGradient pf_gradient(const ir::Date& d) const;   // t as in pf(d)
+
+		// Pseudo DF at a date (uses the date cache when enabled)
+		double pf(const ir::Date& d) const;
+
+		void rebuild_date_cache();
+		std::size_t date_cache_bytes() const { return date_cache_.bytes(); }
+		std::span<const double> date_cache_values() const { return date_cache_.values(); }
 
 		const ir::utils::Nodes1D& nodes() const { return nodes_pf_; }
+		const Config& config() const { return cfg_; }
 
 	private:
 		Config cfg_;
 		ir::utils::Nodes1D nodes_pf_;
-		std::unique_ptr<ir::utils::IInterpolator1D> interp_; // log-linear on pf
+		ir::utils::LogLinearKernel kernel_; // log-linear on pf
+		DateCache date_cache_;
 	};
 
 	enum class CurveType { Discount, Forward };
@@ -2,6 +2,7 @@
 #include <memory>
 #include <unordered_map>
 #include <optional>
+#include <vector>
 
 #include "ir/core/ids.hpp"
 #include "ir/core/result.hpp"
@@ -15,6 +16,13 @@ namespace ir::market {
 	public:
 		MarketData(ir::Date asof) : asof_(asof), fixings_{ nullptr } {};
 
+		// Copy-on-write layer over `base`, which must outlive it: starts empty, and every
+		// lookup not overridden by a set_* call on the layer falls through to base (curves,
+		// quotes and the fixings store). Overriding a curve costs one map entry, so a
+		// scenario that reshapes two curves does not copy the others.
+		static MarketData overlay(const MarketData& base);
+		const MarketData* base() const { return base_; }
+
 		ir::Date asof() const { return asof_; }
 
 		// Curves
@@ -24,12 +32,18 @@ namespace ir::market {
 		const DiscountCurve& discount_curve(const ir::CurveId& id) const;
 		const ForwardCurve& forward_curve(const ir::CurveId& id) const;
 
+		// Registered curve ids (unordered, including the base's), e.g. for serialisation
+		std::vector<ir::CurveId> discount_curve_ids() const;
+		std::vector<ir::CurveId> forward_curve_ids() const;
+
 		// Quotes
 		void set_quote(const QuoteId& id, Quote q);
 		std::optional<Quote> quote(const QuoteId& id) const;
+		// Quotes set on this object (not on the base of an overlay)
+		const std::unordered_map<QuoteId, Quote>& quotes() const { return quotes_; }
 
 		// Fixings - return pointer so caller can check for nullptr
-		void set_fixings(FixingStore* fixings_ptr) { fixings_ = fixings_ptr; };
+		void set_fixings(const FixingStore* fixings_ptr) { fixings_ = fixings_ptr; };
 		std::optional<double> fixings(const ir::IndexId& index, const ir::Date& d) const;
 		const FixingStore* fixings() const { return fixings_; } // Return pointer, not reference!
 
@@ -40,7 +54,8 @@ namespace ir::market {
 		std::unordered_map<std::string, std::shared_ptr<ForwardCurve>> forward_;
 		std::unordered_map<QuoteId, Quote> quotes_;
 
-		FixingStore* fixings_{ nullptr };
+		const FixingStore* fixings_{ nullptr };
+		const MarketData* base_{ nullptr };
 	};
 
 } // namespace ir::market
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
 #include <string>
 #include <utility>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include "ir/core/date.hpp"
 #include "ir/core/ids.hpp"   // IndexId
@@ -20,19 +25,58 @@ namespace ir::market {
 		double value{ 0.0 };
 	};
 
+	// Historical fixings. Index ids are interned to small integer handles and each
+	// index's history is one contiguous array with an entry per calendar day (NaN where
+	// no fixing exists), so a lookup is a hash-free array load once the handle is known.
 	class FixingStore {
 	public:
-		// Adds/overwrites fixing
+		using Handle = std::uint32_t;
+		static constexpr Handle kNoIndex = std::numeric_limits<Handle>::max();
+
+		// Adds/overwrites fixing (a NaN fixing removes the entry)
 		void add(const ir::IndexId& index, const ir::Date& d, double fixing);
 
 		// Returns empty if missing
 		std::optional<double> get(const ir::IndexId& index, const ir::Date& d) const;
 
+		// Handle of an index, kNoIndex if the store has never seen it. Handles stay
+		// valid for the lifetime of the store.
+		Handle handle(const ir::IndexId& index) const;
+		std::optional<double> get(Handle h, const ir::Date& d) const;
+
+		// Fixings for the days [d0, d1), one entry per calendar day, NaN for a missing
+		// day. The span is empty unless the whole range lies within the stored history
+		// (or d0 >= d1); it is invalidated by the next add().
+		std::span<const double> get_range(Handle h, const ir::Date& d0, const ir::Date& d1) const;
+
+		// Bulk add: per_day[i] is the fixing for first + i days. NaN entries mean "no
+		// fixing" and are skipped (they do not remove existing fixings). A new index takes
+		// the array in one copy.
+		void add_series(const ir::IndexId& index, const ir::Date& first, std::span<const double> per_day);
+
+		// Stored indices in handle order, and one index's per-day history (NaN = missing)
+		// starting at first_date(h); empty for an index without fixings.
+		std::vector<ir::IndexId> indices() const;
+		ir::Date first_date(Handle h) const;
+		std::span<const double> history(Handle h) const;
+
 	private:
-		// Key = index.value + "|" + YYYY-MM-DD (simple, deterministic)
-		static std::string key(const ir::IndexId& index, const ir::Date& d);
+		// values[head + i] is the fixing of day first_day + i (NaN = no fixing).
+		// values[0, head) is room for earlier days, grown geometrically, so loading a
+		// history newest-first costs amortised O(1) per day.
+		struct Series {
+			long long first_day{ 0 };       // serial day of values[head]
+			std::size_t head{ 0 };
+			std::vector<double> values;
+
+			std::size_t size() const { return values.size() - head; }
+			std::span<const double> days() const { return std::span<const double>(values).subspan(head); }
+		};
+
+		static long long serial(const ir::Date& d) { return d.raw().time_since_epoch().count(); }
 
-		std::unordered_map<std::string, double> fixings_;
+		std::unordered_map<std::string, Handle> handles_;
+		std::vector<Series> series_;
 	};
 
 } // namespace ir::market
@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "ir/core/date.hpp"
@@ -14,6 +15,10 @@ namespace ir::market {
 
     // For bootstrapping, we typically solve for the last node value.
     // So each helper must be able to compute implied quote using the curves provided.
+    //
+    // Swap helpers cache their schedule, accrual fractions and curve times on first use
+    // (only curve values change between solver iterations). The cache is mutable state:
+    // a helper must not be used from several threads at once.
     class RateHelper {
     public:
         virtual ~RateHelper() = default;
@@ -44,11 +49,34 @@ namespace ir::market {
         // Implied par rate given a candidate discount curve
         ir::Result<double> implied_par_rate(const PiecewiseDiscountCurve& disc) const;
 
+        // Same, and writes d(par)/d(node DF j) into d_disc (size = number of curve nodes).
+        ir::Result<double> implied_par_rate(const PiecewiseDiscountCurve& disc,
+            std::span<double> d_disc) const;
+
     private:
+        // Schedule-derived data, built once; curve times rebuilt if the curve time axis changes.
+        struct Cache {
+            bool has_schedule{ false };
+            std::vector<ir::Date> pay_dates;
+            std::vector<double> tau;
+
+            bool has_times{ false };
+            ir::Date asof{};
+            ir::DayCount dc{ ir::DayCount::ACT365 };
+            std::vector<double> pay_t;
+            double t_start{ 0.0 };
+            double t_end{ 0.0 };
+
+            std::vector<ir::utils::NodeGradient> grad;   // scratch for the gradient pass
+        };
+
+        ir::Result<int> ensure_cache(const PiecewiseDiscountCurve& disc) const;
+
         ir::Date start_;
         ir::Date end_;
         double par_rate_;
         Config cfg_;
+        mutable Cache cache_;
     };
 
     // ---------- FRA helper (forward curve bootstrap) ----------
@@ -72,6 +100,10 @@ namespace ir::market {
         // Implied FRA rate given forward curve (pseudo-DF) and discount curve (for PV consistency if needed)
         ir::Result<double> implied_fra_rate(const PiecewiseForwardCurve& fwd) const;
 
+        // Same, and writes d(rate)/d(node pseudo-DF j) into d_fwd.
+        ir::Result<double> implied_fra_rate(const PiecewiseForwardCurve& fwd,
+            std::span<double> d_fwd) const;
+
     private:
         ir::Date start_;
         ir::Date end_;
@@ -105,11 +137,40 @@ namespace ir::market {
         ir::Result<double> implied_par_rate(const PiecewiseDiscountCurve& disc,
             const PiecewiseForwardCurve& fwd) const;
 
+        // Same, and writes the gradients w.r.t. the discount / forward node values.
+        // Pass an empty span to skip a gradient (e.g. discount curve held fixed).
+        ir::Result<double> implied_par_rate(const PiecewiseDiscountCurve& disc,
+            const PiecewiseForwardCurve& fwd,
+            std::span<double> d_disc,
+            std::span<double> d_fwd) const;
+
     private:
+        struct Cache {
+            bool has_schedule{ false };
+            std::vector<ir::Date> fixed_pay;
+            std::vector<double> fixed_tau;
+            std::vector<ir::Date> float_dates;     // accrual boundaries, float_dates[i] pays period i
+
+            bool has_times{ false };
+            ir::Date disc_asof{};
+            ir::DayCount disc_dc{ ir::DayCount::ACT365 };
+            ir::Date fwd_asof{};
+            ir::DayCount fwd_dc{ ir::DayCount::ACT365 };
+            std::vector<double> fixed_pay_t;       // discount curve axis
+            std::vector<double> float_pay_t;       // discount curve axis
+            std::vector<double> float_t;           // forward curve axis
+
+            std::vector<ir::utils::NodeGradient> fixed_grad;   // scratch for the gradient pass
+        };
+
+        ir::Result<int> ensure_cache(const PiecewiseDiscountCurve& disc,
+            const PiecewiseForwardCurve& fwd) const;
+
         ir::Date start_;
         ir::Date end_;
         double par_rate_;
         Config cfg_;
+        mutable Cache cache_;
     };
 
 } // namespace ir::market
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/ids.hpp"
+#include "ir/core/result.hpp"
+#include "ir/instruments/cashflow.hpp"
+#include "ir/instruments/leg.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+
+namespace ir::pricers {
+
+    // The reference date and day count a curve turns dates into times with.
+    struct CurveAxis {
+        ir::Date asof{};
+        ir::DayCount dc{ ir::DayCount::ACT365 };
+
+        bool operator==(const CurveAxis&) const = default;
+    };
+
+    // Curve a planned cashflow projects its rate on.
+    enum class PlanCurve : std::uint8_t { None, Ibor, Rfr };
+
+    // A trade or leg flattened for repeated pricing: one entry per cashflow paid after
+    // the valuation date, in leg order, as contiguous arrays. Dates are already curve
+    // times, known amounts (fixed cashflows, fixed IBOR coupons, fully realised RFR
+    // coupons) are already signed amounts, and the realised part of an RFR coupon is
+    // one compounded factor, so pricing reads no fixings, dates or cashflow objects.
+    //
+    // Times are on the axes of the curves the plan was compiled against; a plan prices
+    // any curves of the same ids, types and axes (bumped, shifted or rebuilt ones).
+    struct CashflowPlan {
+        PricingFramework framework{ PricingFramework::MultiCurve };
+        ir::CurveId discount_curve{ ir::CurveId{ "DISCOUNT" } };
+        ir::CurveId ibor_forward_curve{ ir::CurveId{ "FWD_IBOR" } };
+        ir::CurveId rfr_forward_curve{ ir::CurveId{ "FWD_RFR" } };
+        CurveAxis discount_axis{};
+        CurveAxis ibor_axis{};        // multi-curve plans with IBOR projections only
+        CurveAxis rfr_axis{};         // multi-curve plans with RFR projections only
+        bool uses_ibor{ false };
+        bool uses_rfr{ false };
+        std::size_t legs{ 0 };        // 2 for swaps (fixed, float), 1 for a Leg
+
+        std::vector<std::uint8_t> leg;
+        std::vector<ir::instruments::CashflowType> type;
+        std::vector<PlanCurve> curve;
+        std::vector<double> t_pay;        // discount curve time
+        std::vector<double> t_start;      // projected period on the projection curve
+        std::vector<double> t_end;        // (the discount curve in single-curve plans)
+        std::vector<double> tau;          // accrual year fraction of a projected coupon
+        std::vector<double> notional;     // signed
+        std::vector<double> spread;
+        std::vector<double> realised;     // RFR: realised compounded factor, 1 otherwise
+        std::vector<double> known_amount; // signed; cashflows with curve == None
+
+        std::size_t size() const { return t_pay.size(); }
+    };
+
+    // Compiles against the curves and fixings in md, with the trade's own context if
+    // it has one. Fixed, IBOR and RFR cashflows on piecewise curves only; RFR coupons
+    // are projected as by the default pricers (not rfr_exact_daily_projection).
+    ir::Result<CashflowPlan> compile_plan(const PortfolioTrade& trade,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx);
+
+    ir::Result<CashflowPlan> compile_plan(const ir::instruments::Leg& leg,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx);
+
+    // The curves a plan is priced on. Projection curves are null when unused, and in
+    // single-curve plans, which project on the discount curve.
+    struct PlanCurves {
+        const ir::market::PiecewiseDiscountCurve* discount{ nullptr };
+        const ir::market::PiecewiseForwardCurve* ibor{ nullptr };
+        const ir::market::PiecewiseForwardCurve* rfr{ nullptr };
+    };
+
+    // Looks up the plan's curves in md and checks they are on the plan's axes.
+    ir::Result<PlanCurves> plan_curves(const CashflowPlan& plan, const ir::market::MarketData& md);
+
+    // PV of a plan (and pv_fixed_leg / pv_float_leg for swaps; no lines). Curves must
+    // come from plan_curves, or share ids, types and axes with ones that did. Does not
+    // allocate, and is safe to call concurrently on shared plans and curves.
+    PricingResult price_plan(const CashflowPlan& plan, const PlanCurves& curves);
+
+} // namespace ir::pricers
@@ -0,0 +1,117 @@
+#pragma once
+#include <algorithm>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/core/error.hpp"
+#include "ir/core/result.hpp"
+#include "ir/instruments/cashflow.hpp"
+#include "ir/instruments/coupons.hpp"
+#include "ir/instruments/leg.hpp"
+#include "ir/market/quotes.hpp"
+
+namespace ir::pricers {
+
+    // PV of a leg's cashflows paid after the valuation date: the one copy of the
+    // Fixed / IBOR / RFR amount rules, shared by the swap pricers (Scalar = double)
+    // and AadRiskEngine (Scalar = utils::AReal). Market numbers come from `curves`:
+    //
+    //   const char* who                                    prefix of error messages
+    //   Scalar df(std::size_t k, const Date& pay)          DF of the k-th payable cashflow
+    //   Result<Scalar> ibor_forward(const IborObservation&, double tau)
+    //   Result<Scalar> rfr_growth(const RfrObservation&, const Date& from)
+    //                                                      projected compound factor over [from, end)
+    //
+    // Known IBOR fixings are used as is; RFR coupons compound their fixings for days
+    // before the valuation date and rfr_growth from there on. on_cashflow(cf,
+    // signed_amount, df, pv) is called for every priced cashflow, in leg order.
+    template <class Scalar, class Curves, class OnCashflow>
+    ir::Result<Scalar> pv_leg_cashflows(const ir::instruments::Leg& leg,
+        const ir::market::FixingStore& fixings,
+        const ir::Date& valuation_date,
+        const Curves& curves,
+        OnCashflow&& on_cashflow) {
+
+        auto error = [&](const char* what) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, std::string(curves.who) + ": " + what);
+        };
+
+        const double sgn = (leg.direction == ir::instruments::PayReceive::Pay) ? -1.0 : +1.0;
+        Scalar pv = 0.0;
+        std::size_t k = 0;
+
+        for (const auto& cfptr : leg.cashflows) {
+            if (!cfptr) continue;
+
+            // v1: ignore cashflows on/before valuation_date
+            const ir::Date pay = cfptr->pay_date();
+            if (!(valuation_date < pay)) continue;
+
+            Scalar amt = 0.0;
+            switch (cfptr->type()) {
+
+            case ir::instruments::CashflowType::Fixed: {
+                auto known = cfptr->amount_if_known(&fixings);
+                if (!known.has_value()) return error("fixed cashflow amount unknown.");
+                amt = known.value();
+                break;
+            }
+
+            case ir::instruments::CashflowType::IborCoupon: {
+                auto known = cfptr->amount_if_known(&fixings);
+                if (known.has_value()) {
+                    amt = known.value();
+                    break;
+                }
+
+                const auto* cpn = dynamic_cast<const ir::instruments::IborCoupon*>(cfptr.get());
+                if (!cpn) return error("cashflow type mismatch (IborCoupon).");
+
+                const auto& obs = cpn->observation();
+                const double tau = ir::year_fraction(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
+                if (!(tau > 0.0)) return error("invalid IBOR accrual year fraction.");
+
+                auto fwd = curves.ibor_forward(obs, tau);
+                if (!fwd.has_value()) return fwd.error();
+                amt = cpn->notional() * (fwd.value() + cpn->spread()) * tau;
+                break;
+            }
+
+            case ir::instruments::CashflowType::RfrCoupon: {
+                const auto* cpn = dynamic_cast<const ir::instruments::RfrCompoundCoupon*>(cfptr.get());
+                if (!cpn) return error("cashflow type mismatch (RfrCompoundCoupon).");
+
+                const auto& obs = cpn->observation();
+                const double tau_total = ir::year_fraction(obs.start, obs.end, obs.accrual_dc);
+                if (!(tau_total > 0.0)) return error("invalid RFR accrual year fraction.");
+
+                // Realised days before the valuation date, projected days from there on
+                const ir::Date proj_start = (obs.start < valuation_date)
+                    ? std::min(valuation_date, obs.end) : obs.start;
+                const auto realised = ir::instruments::realised_rfr_compound(obs, fixings, proj_start);
+                if (!realised.has_value()) return error("missing historical RFR fixing.");
+
+                Scalar compound = realised.value();
+                if (proj_start < obs.end) {
+                    auto growth = curves.rfr_growth(obs, proj_start);
+                    if (!growth.has_value()) return growth.error();
+                    compound *= growth.value();
+                }
+                amt = cpn->notional() * (compound - 1.0) + cpn->notional() * cpn->spread() * tau_total;
+                break;
+            }
+
+            default:
+                return error("unsupported cashflow type.");
+            }
+
+            const Scalar df = curves.df(k++, pay);
+            const Scalar signed_amt = sgn * amt;
+            const Scalar cf_pv = signed_amt * df;
+            pv += cf_pv;
+            on_cashflow(*cfptr, signed_amt, df, cf_pv);
+        }
+        return pv;
+    }
+
+} // namespace ir::pricers
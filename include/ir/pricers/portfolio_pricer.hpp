@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+#include "ir/core/result.hpp"
+#include "ir/instruments/leg.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+#include "ir/utils/thread_pool.hpp"
+
+namespace ir::pricers {
+
+    using PortfolioProduct = std::variant<
+        ir::instruments::InterestRateSwap,
+        ir::instruments::OisSwap,
+        ir::instruments::Leg>;
+
+    struct PortfolioTrade {
+        PortfolioProduct product;
+        std::optional<PricingContext> ctx{};   // overrides the portfolio-level context
+    };
+
+    struct PortfolioOptions {
+        std::size_t threads{ 0 };     // 0: hardware concurrency; 1: serial on the calling thread
+        std::size_t grain{ 0 };       // trades per task; 0: chosen from the batch size
+        bool keep_lines{ true };      // false: lines are not built (PricingDetail::Cashflows priced as Aggregates)
+    };
+
+    // Prices a batch of trades against one MarketData in parallel.
+    //
+    // Results come back in input order, one per trade; a failing trade yields its own
+    // Error and does not affect the others. Swaps fill pv / pv_fixed_leg / pv_float_leg
+    // (float = IBOR or RFR leg); a raw Leg fills pv and lines only. The pricer follows
+    // ctx.framework: SingleCurve uses DiscountingSwapPricer, MultiCurve MultiCurveSwapPricer.
+    //
+    // Thread-safety contract (what makes the shared, read-only MarketData safe):
+    //  - MarketData, its curves and its FixingStore must not be modified while price()
+    //    runs. All const member functions of these types are safe to call concurrently:
+    //    curve lookups keep their interpolation hints on the caller's stack and the
+    //    date-cache tables are built before the curve is published.
+    //  - Curve setters (set_nodes, push_node, set_last_value, rebuild_date_cache),
+    //    MarketData::set_* and FixingStore::add are not synchronised; do them before
+    //    pricing starts.
+    //  - Rate helpers (rate_helpers.hpp) keep a mutable schedule cache and are not
+    //    shared by this engine; bootstrap curves first, then price.
+    class PortfolioPricer {
+    public:
+        explicit PortfolioPricer(PortfolioOptions opts = {});
+
+        std::vector<ir::Result<PricingResult>>
+            price(std::span<const PortfolioTrade> trades,
+                const ir::market::MarketData& md,
+                const PricingContext& ctx) const;
+
+        // Worker threads used (1 when pricing serially).
+        std::size_t threads() const { return pool_ ? pool_->size() : 1; }
+
+    private:
+        PortfolioOptions opts_;
+        std::unique_ptr<ir::utils::ThreadPool> pool_;   // null when threads == 1
+        DiscountingSwapPricer single_curve_{};
+        MultiCurveSwapPricer multi_curve_{};
+    };
+
+} // namespace ir::pricers
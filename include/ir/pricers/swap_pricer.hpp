@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -20,6 +21,14 @@ namespace ir::pricers {
         MultiCurve
     };
 
+    // What a pricing call reports. Cashflow lines cost one entry per cashflow, so
+    // PV-only runs (risk, scenarios, batch totals) should not ask for them.
+    enum class PricingDetail {
+        PvOnly,         // pv
+        Aggregates,     // pv, pv_fixed_leg, pv_float_leg
+        Cashflows       // aggregates and one CashflowPVLine per priced cashflow
+    };
+
     struct PricingContext {
         ir::Date valuation_date{};
         PricingFramework framework{ PricingFramework::MultiCurve };
@@ -29,6 +38,13 @@ namespace ir::pricers {
         ir::CurveId rfr_forward_curve{ ir::CurveId{"FWD_RFR"} };
 
         bool include_accrued{ false };
+
+        // Single-curve RFR coupons: the projected days compound to DF(p)/DF(end), with
+        // p = max(accrual start, valuation date), so by default only realised days are
+        // iterated. Set true to compound the projected part day by day (validation).
+        bool rfr_exact_daily_projection{ false };
+
+        PricingDetail detail{ PricingDetail::Cashflows };
     };
 
     struct CashflowPVLine {
@@ -36,8 +52,8 @@ namespace ir::pricers {
         double amount{ 0.0 };
         double df{ 0.0 };
         double pv{ 0.0 };
-        std::string label{};
-        std::string leg_id{};
+        ir::instruments::CashflowType type{ ir::instruments::CashflowType::Fixed };
+        std::uint32_t leg{ 0 };   // in the trade: 0 fixed / 1 float leg of a swap, 0 for a Leg
     };
 
     struct LegPVResult {
@@ -105,6 +121,9 @@ namespace ir::pricers {
 
     double leg_sign(ir::instruments::PayReceive dir);
 
+    // "FIXED", "IBOR" or "RFR"
+    const char* cashflow_label(ir::instruments::CashflowType type);
+
     // For fixed/IBOR cashflows this behaves like before.
     // For RFR coupons it can use fixings for d < valuation_date and projection for d >= valuation_date.
     std::optional<double> signed_amount_if_known(
@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "ir/core/result.hpp"
+#include "ir/instruments/leg.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+#include "ir/utils/aad.hpp"
+
+namespace ir::risk {
+
+    struct AadRiskOptions {
+        double bump{ 1e-4 };   // zero-rate shift the deltas are scaled to, as BucketedRiskOptions
+    };
+
+    struct AadRisk {
+        double pv{ 0.0 };
+        std::vector<RiskPillar> pillars;   // same pillars, same order as BucketedRisk
+        std::vector<double> gradient;      // d PV / d node value (DF or pseudo-DF)
+        std::vector<double> deltas;        // d PV / d zero rate * bump: BucketedRisk deltas to first order
+        std::size_t tape_nodes{ 0 };
+    };
+
+    // Node sensitivities of one trade's PV by adjoint algorithmic differentiation.
+    //
+    // The trade is priced once on a Tape, following the DiscountingSwapPricer /
+    // MultiCurveSwapPricer leg logic (selected by ctx.framework), with every node of
+    // every PiecewiseDiscountCurve / PiecewiseForwardCurve in MarketData as an input.
+    // Curve lookups are recorded as one tape node each, with the log-linear
+    // interpolation weights of df_gradient / pf_gradient as partials; one backward
+    // sweep then yields d PV / d node for all pillars. Single-curve RFR coupons use
+    // the telescoped DF(p)/DF(end) projection regardless of rfr_exact_daily_projection.
+    //
+    // The engine owns its tape (reused across calls, so repeated calls do not
+    // allocate): use one engine per thread.
+    class AadRiskEngine {
+    public:
+        explicit AadRiskEngine(AadRiskOptions opts = {});
+
+        ir::Result<AadRisk> compute(const ir::pricers::PortfolioTrade& trade,
+            const ir::market::MarketData& md,
+            const ir::pricers::PricingContext& ctx);
+
+        ir::Result<AadRisk> compute(const ir::instruments::Leg& leg,
+            const ir::market::MarketData& md,
+            const ir::pricers::PricingContext& ctx);
+
+        const ir::utils::Tape& tape() const { return tape_; }
+
+    private:
+        ir::Result<AadRisk> run(std::span<const ir::instruments::Leg* const> legs,
+            const ir::market::MarketData& md,
+            const ir::pricers::PricingContext& ctx);
+
+        AadRiskOptions opts_;
+        ir::utils::Tape tape_;
+    };
+
+} // namespace ir::risk
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/ids.hpp"
+#include "ir/core/result.hpp"
+#include "ir/market/bootstrapper.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+#include "ir/utils/sparse_matrix.hpp"
+
+namespace ir::risk {
+
+    // One par quote a curve was bootstrapped from.
+    struct QuotePillar {
+        ir::CurveId curve{};
+        std::size_t index{ 0 };   // helper index in maturity order
+        ir::Date maturity{};
+    };
+
+    // Maps node sensitivities to par-quote sensitivities with the chain rule.
+    //
+    // Curves are added with the BootstrapSensitivities of their bootstrap. A forward
+    // curve also depends on the quotes of the discount curve it was built on, through
+    // d_node_d_discount, so that curve must be added first. matrix() then stacks
+    // d(node)/d(quote) over the pillars of a risk result (AadRisk / BucketedRisk), and
+    // the quote risk of any set of trades is one product with the node gradient:
+    //   d PV / d quote = matrix^T * d PV / d node.
+    class QuoteRiskMap {
+    public:
+        ir::Result<int> add_discount_curve(const ir::CurveId& id,
+            const ir::market::BootstrapSensitivities& sens);
+
+        ir::Result<int> add_forward_curve(const ir::CurveId& id,
+            const ir::market::BootstrapSensitivities& sens,
+            const ir::CurveId& discount_curve);
+
+        const std::vector<QuotePillar>& quotes() const { return quotes_; }
+
+        // Rows: pillars (nodes of curves that were not added are empty rows);
+        // columns: quotes(). Pillars must match the curves' node counts.
+        ir::Result<ir::utils::SparseMatrix> matrix(std::span<const RiskPillar> pillars) const;
+
+    private:
+        struct CurveRows {
+            ir::CurveId id;
+            CurveRole role{ CurveRole::Discount };
+            std::vector<std::vector<double>> rows;   // per node, over the quotes known when added
+        };
+
+        const CurveRows* find(const ir::CurveId& id, CurveRole role) const;
+        ir::Result<int> add(const ir::CurveId& id, CurveRole role,
+            const ir::market::BootstrapSensitivities& sens, const CurveRows* discount);
+
+        std::vector<CurveRows> curves_;
+        std::vector<QuotePillar> quotes_;
+    };
+
+    // PV change for a `bump` rise of each quote, to first order:
+    // node_to_quote^T * node_gradient * bump (node_gradient per pillar, e.g. AadRisk::gradient).
+    std::vector<double> quote_deltas(const ir::utils::SparseMatrix& node_to_quote,
+        std::span<const double> node_gradient,
+        double bump = 1e-4);
+
+} // namespace ir::risk
@@ -0,0 +1,85 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ir/core/ids.hpp"
+#include "ir/core/result.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+#include "ir/utils/thread_pool.hpp"
+
+namespace ir::risk {
+
+    // Zero-rate move of one piecewise curve in MarketData. At node i (time t_i) the
+    // zero rate moves by
+    //   dz_i = parallel + twist * (t_i - pivot) + node_shifts[i]
+    // and the node value becomes v_i * exp(-dz_i * t_i). node_shifts is empty or has
+    // one entry per node (historical node moves).
+    struct CurveShift {
+        ir::CurveId curve{};
+        CurveRole role{ CurveRole::Discount };
+        double parallel{ 0.0 };
+        double twist{ 0.0 };       // per year of node time
+        double pivot{ 0.0 };       // node time at which the twist is zero
+        std::vector<double> node_shifts{};
+    };
+
+    // One market scenario: curves without a shift keep their base nodes.
+    struct Scenario {
+        std::string name{};
+        std::vector<CurveShift> shifts{};
+    };
+
+    struct ScenarioOptions {
+        std::size_t threads{ 0 };     // see PortfolioOptions
+        std::size_t grain{ 0 };       // scenarios per task; 0: chosen from the count
+    };
+
+    struct ScenarioResult {
+        std::size_t trades{ 0 };
+        std::vector<std::string> scenarios;   // names, in input order
+        std::vector<double> base_pv;          // per trade
+        std::vector<double> pv;               // [scenario * trades + trade]
+
+        double trade_pv(std::size_t scenario, std::size_t trade) const { return pv[scenario * trades + trade]; }
+        double pnl(std::size_t scenario, std::size_t trade) const { return trade_pv(scenario, trade) - base_pv[trade]; }
+    };
+
+    // Reprices a set of trades under many market scenarios.
+    //
+    // Each trade is compiled once against the base market into a CashflowPlan
+    // (cashflow_plan.hpp): cashflow dates become curve times, and known fixings and
+    // realised RFR compounding become constants. A scenario only changes node values,
+    // not curve times, so its PV is one price_plan sweep per trade.
+    //
+    // A scenario's market is an overlay on the base (MarketData::overlay) holding only
+    // the shifted curves, which are rebuilt from the shifted nodes without a date
+    // cache; the base is never copied. Scenarios are priced in parallel.
+    //
+    // Trades must compile to a plan (see compile_plan); one that does not fails the run.
+    // The MarketData contract of PortfolioPricer applies.
+    class ScenarioEngine {
+    public:
+        explicit ScenarioEngine(ScenarioOptions opts = {});
+
+        ir::Result<ScenarioResult> run(std::span<const ir::pricers::PortfolioTrade> trades,
+            const ir::market::MarketData& md,
+            std::span<const Scenario> scenarios,
+            const ir::pricers::PricingContext& ctx) const;
+
+        // The market of one scenario, as used by run(): an overlay on `md` (which must
+        // outlive it) with the shifted curves. For pricing outside the engine.
+        static ir::Result<ir::market::MarketData> scenario_market(const ir::market::MarketData& md,
+            const Scenario& scenario);
+
+    private:
+        ScenarioOptions opts_;
+        std::unique_ptr<ir::utils::ThreadPool> pool_;   // null when threads == 1
+    };
+
+} // namespace ir::risk
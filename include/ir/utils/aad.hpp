@@ -0,0 +1,164 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ir::utils {
+
+	// Reverse-mode automatic differentiation (AAD).
+	//
+	// Every operation on an active AReal appends one node to the thread's active Tape:
+	// the tape indices of its (at most two) active operands and the local partials.
+	// A single backward sweep (Tape::propagate) then gives d out / d x for every
+	// recorded x, at a small constant multiple of the cost of the forward pass.
+	// Constants (AReal built from a double) are never recorded.
+	//
+	// Nodes live in an arena of fixed-size blocks that is kept across rewind(), so
+	// once a tape has seen its largest recording no operation allocates. Operations
+	// record on Tape::active(), set per thread with Tape::Scope: one tape per thread.
+	class AReal;
+
+	class Tape {
+	public:
+		static constexpr std::uint32_t kNoNode = 0xffffffffu;
+
+		// block_nodes is rounded up to a power of two (24 bytes per node)
+		explicit Tape(std::size_t block_nodes = 4096);
+
+		Tape(const Tape&) = delete;
+		Tape& operator=(const Tape&) = delete;
+
+		// New independent variable
+		AReal input(double v);
+
+		// Result with value v and partials da = d v / d a, db = d v / d b; a constant
+		// (not recorded) if neither operand is active.
+		static AReal unary(double v, const AReal& a, double da);
+		static AReal binary(double v, const AReal& a, double da, const AReal& b, double db);
+
+		// Drop all recorded nodes; the arena is kept for the next recording.
+		void rewind() { size_ = 0; }
+
+		std::size_t size() const { return size_; }
+		std::size_t bytes() const;   // arena + adjoints
+
+		// Backward sweep from `out`: afterwards adjoint(x) = d out / d x.
+		void propagate(const AReal& out);
+		double adjoint(const AReal& x) const;
+
+		static Tape* active() { return active_; }
+
+		// Makes `tape` the active tape of this thread for the scope's lifetime
+		class Scope {
+		public:
+			explicit Scope(Tape& tape) : prev_(active_) { active_ = &tape; }
+			~Scope() { active_ = prev_; }
+			Scope(const Scope&) = delete;
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			Tape* prev_;
+		};
+
+	private:
+		struct Node {
+			std::uint32_t a;
+			std::uint32_t b;
+			double da;
+			double db;
+		};
+
+		std::uint32_t push(std::uint32_t a, double da, std::uint32_t b, double db) {
+			if (size_ == capacity_) grow();
+			Node& n = blocks_[size_ >> shift_][size_ & mask_];
+			n.a = a;
+			n.da = da;
+			n.b = b;
+			n.db = db;
+			return static_cast<std::uint32_t>(size_++);
+		}
+		const Node& node(std::size_t i) const { return blocks_[i >> shift_][i & mask_]; }
+		void grow();
+
+		std::size_t shift_{ 0 };
+		std::size_t mask_{ 0 };
+		std::size_t size_{ 0 };
+		std::size_t capacity_{ 0 };
+		std::vector<std::unique_ptr<Node[]>> blocks_;
+		std::vector<double> adjoints_;
+
+		static thread_local Tape* active_;
+	};
+
+	// Value plus its node on the active tape (kNoNode for constants). 16 bytes,
+	// passed by value like a double.
+	class AReal {
+	public:
+		AReal() = default;
+		AReal(double v) : v_(v) {}   // implicit: constants mix freely with active values
+
+		double value() const { return v_; }
+		std::uint32_t node() const { return node_; }
+		bool active() const { return node_ != Tape::kNoNode; }
+
+		AReal& operator+=(const AReal& b);
+		AReal& operator-=(const AReal& b);
+		AReal& operator*=(const AReal& b);
+		AReal& operator/=(const AReal& b);
+
+	private:
+		friend class Tape;
+		AReal(double v, std::uint32_t node) : v_(v), node_(node) {}
+
+		double v_{ 0.0 };
+		std::uint32_t node_{ Tape::kNoNode };
+	};
+
+	inline AReal Tape::input(double v) {
+		return AReal(v, push(kNoNode, 0.0, kNoNode, 0.0));
+	}
+
+	inline AReal Tape::unary(double v, const AReal& a, double da) {
+		if (!a.active()) return AReal(v);
+		return AReal(v, active_->push(a.node_, da, kNoNode, 0.0));
+	}
+
+	inline AReal Tape::binary(double v, const AReal& a, double da, const AReal& b, double db) {
+		if (!a.active()) return unary(v, b, db);
+		if (!b.active()) return unary(v, a, da);
+		return AReal(v, active_->push(a.node_, da, b.node_, db));
+	}
+
+	inline AReal operator+(const AReal& a, const AReal& b) {
+		return Tape::binary(a.value() + b.value(), a, 1.0, b, 1.0);
+	}
+	inline AReal operator-(const AReal& a, const AReal& b) {
+		return Tape::binary(a.value() - b.value(), a, 1.0, b, -1.0);
+	}
+	inline AReal operator*(const AReal& a, const AReal& b) {
+		return Tape::binary(a.value() * b.value(), a, b.value(), b, a.value());
+	}
+	inline AReal operator/(const AReal& a, const AReal& b) {
+		const double q = a.value() / b.value();
+		return Tape::binary(q, a, 1.0 / b.value(), b, -q / b.value());
+	}
+	inline AReal operator-(const AReal& a) {
+		return Tape::unary(-a.value(), a, -1.0);
+	}
+
+	inline AReal exp(const AReal& a) {
+		const double e = std::exp(a.value());
+		return Tape::unary(e, a, e);
+	}
+	inline AReal log(const AReal& a) {
+		return Tape::unary(std::log(a.value()), a, 1.0 / a.value());
+	}
+
+	inline AReal& AReal::operator+=(const AReal& b) { return *this = *this + b; }
+	inline AReal& AReal::operator-=(const AReal& b) { return *this = *this - b; }
+	inline AReal& AReal::operator*=(const AReal& b) { return *this = *this * b; }
+	inline AReal& AReal::operator/=(const AReal& b) { return *this = *this / b; }
+
+} // namespace ir::utils
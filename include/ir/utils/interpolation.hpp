@@ -1,4 +1,7 @@
 #pragma once
+#include <algorithm>
+#include <cmath>
+#include <span>
 #include <vector>
 #include <stdexcept>
 #include "ir/core/result.hpp"
@@ -16,6 +19,16 @@ namespace ir::utils {
         std::vector<double> y;  // same size as x
     };
 
+    // Interpolated value together with its partial derivatives w.r.t. the node
+    // y-values it depends on (at most two: the enclosing segment's end points).
+    struct NodeGradient {
+        double value{ 0.0 };
+        std::size_t i0{ 0 };
+        double d0{ 0.0 };
+        std::size_t i1{ 0 };
+        double d1{ 0.0 };
+    };
+
     class IInterpolator1D {
     public:
         virtual ~IInterpolator1D() = default;
@@ -23,6 +36,15 @@ namespace ir::utils {
         virtual double value(double x) const = 0;
         double operator()(double x) const { return value(x); }
 
+        // value(x) and d value / d y_i for the nodes involved
+        virtual NodeGradient value_and_gradient(double x) const = 0;
+
+        // In-place updates used by incremental bootstrapping (no reallocation of existing nodes).
+        // Append a node; expects x > last x.
+        virtual Result<int> push_back(double x, double y) = 0;
+        // Replace last y value (common during solve iterations).
+        virtual Result<int> set_last_value(double y) = 0;
+
     protected:
         std::vector<double> xs_;
         std::vector<double> ys_;
@@ -36,6 +58,10 @@ namespace ir::utils {
         LinearInterpolator(Interp1DData data);
 
         double value(double x) const override;
+        NodeGradient value_and_gradient(double x) const override;
+
+        Result<int> push_back(double x, double y) override;
+        Result<int> set_last_value(double y) override;
 
     };
 
@@ -48,9 +74,107 @@ namespace ir::utils {
         LogLinearInterpolator(Interp1DData data);
 
         double value(double x) const override;
+        NodeGradient value_and_gradient(double x) const override;
+
+        Result<int> push_back(double x, double y) override;
+        Result<int> set_last_value(double y) override;
 
     private:
+        std::vector<double> log_ys_;   // ys_ is kept alongside for gradients
+    };
+
+    // ------------------- Log-Linear kernel --------------------
+    // Concrete (non-virtual) log-linear interpolation used by the piecewise curves.
+    // Structure-of-arrays layout with the per-segment slope of log(y) precomputed, so
+    // an interior value is one lookup, one fma and one exp:
+    //   y(x) = exp( log_ys[i] + slopes[i] * (x - xs[i]) ),  xs[i] <= x < xs[i+1]
+    // Flat extrapolation beyond the end nodes. Needs >= 2 nodes before evaluation.
+    //
+    // Segment lookups come in two flavours: plain (binary search) and hinted, where the
+    // caller owns a segment index that is reused across calls. For increasing x the
+    // hinted lookup walks forward from the last segment, which makes pricing sorted
+    // cashflow times O(1) per point. The kernel itself holds no mutable lookup state,
+    // so concurrent const use is safe.
+    class LogLinearKernel {
+    public:
+        LogLinearKernel() = default;
+
+        // Replace all nodes (validated as validate_xy, y > 0).
+        Result<int> assign(const std::vector<double>& x, const std::vector<double>& y);
+
+        // In-place updates (incremental bootstrapping, bumps).
+        Result<int> push_back(double x, double y);   // x > last x, y > 0
+        Result<int> set_value(std::size_t i, double y);
+        Result<int> set_last_value(double y) { return set_value(ys_.size() - 1, y); }
+
+        std::size_t size() const { return xs_.size(); }
+        bool ready() const { return xs_.size() >= 2; }
+
+        // Segment index i with xs[i] <= x < xs[i+1]; requires xs.front() < x < xs.back().
+        std::size_t segment(double x) const {
+            return static_cast<std::size_t>(std::upper_bound(xs_.begin(), xs_.end(), x) - xs_.begin()) - 1;
+        }
+        std::size_t segment(double x, std::size_t& hint) const {
+            std::size_t i = hint < xs_.size() - 1 ? hint : 0;
+            if (x < xs_[i]) {
+                i = segment(x);
+            }
+            else {
+                // Short forward walk, then binary search over the remainder
+                for (int k = 0; k < 4 && x >= xs_[i + 1]; ++k) ++i;
+                if (x >= xs_[i + 1]) {
+                    i = static_cast<std::size_t>(std::upper_bound(xs_.begin() + i + 1, xs_.end(), x) - xs_.begin()) - 1;
+                }
+            }
+            hint = i;
+            return i;
+        }
+
+        double value(double x) const {
+            if (x <= xs_.front()) return ys_.front();
+            if (x >= xs_.back())  return ys_.back();
+            return eval(segment(x), x);
+        }
+        double value(double x, std::size_t& hint) const {
+            if (x <= xs_.front()) return ys_.front();
+            if (x >= xs_.back())  return ys_.back();
+            return eval(segment(x, hint), x);
+        }
+
+        // out[k] = value(xs[k]), out.size() == xs.size(). Segments are located with a
+        // running hint (linear for ascending xs, any order accepted); interpolation and
+        // exp run through the vectorised kernels of ir/utils/simd.hpp.
+        void values(std::span<const double> xs, std::span<double> out) const;
+
+        NodeGradient value_and_gradient(double x) const {
+            if (x <= xs_.front()) return NodeGradient{ ys_.front(), 0, 1.0, 0, 0.0 };
+            if (x >= xs_.back())  return NodeGradient{ ys_.back(), xs_.size() - 1, 1.0, xs_.size() - 1, 0.0 };
+            return gradient(segment(x), x);
+        }
+        NodeGradient value_and_gradient(double x, std::size_t& hint) const {
+            if (x <= xs_.front()) return NodeGradient{ ys_.front(), 0, 1.0, 0, 0.0 };
+            if (x >= xs_.back())  return NodeGradient{ ys_.back(), xs_.size() - 1, 1.0, xs_.size() - 1, 0.0 };
+            return gradient(segment(x, hint), x);
+        }
+
+    private:
+        double eval(std::size_t i, double x) const {
+            return std::exp(log_ys_[i] + slopes_[i] * (x - xs_[i]));
+        }
+        NodeGradient gradient(std::size_t i, double x) const {
+            // d exp(ly) / d y_j = value * (weight of ly_j) / y_j
+            const double w = (x - xs_[i]) / (xs_[i + 1] - xs_[i]);
+            const double v = eval(i, x);
+            return NodeGradient{ v, i, v * (1.0 - w) / ys_[i], i + 1, v * w / ys_[i + 1] };
+        }
+        void update_slope(std::size_t i) {   // segment [i, i+1]
+            slopes_[i] = (log_ys_[i + 1] - log_ys_[i]) / (xs_[i + 1] - xs_[i]);
+        }
+
+        std::vector<double> xs_;
+        std::vector<double> ys_;
         std::vector<double> log_ys_;
+        std::vector<double> slopes_;   // per segment, plus a 0 sentinel for the last node
     };
 
     // Validation helper (used in constructors)
@@ -1,7 +1,16 @@
 #pragma once
-#include <functional>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "ir/core/error.hpp"
 #include "ir/core/result.hpp"
+#include "ir/utils/math.hpp"
 
+// Header-only root finders. The objective is any callable (lambda, functor,
+// function pointer, std::function); taking it as a template parameter lets the
+// compiler inline it into the solver loop instead of dispatching through
+// std::function on every evaluation.
 
 namespace ir::utils {
 
@@ -22,12 +31,248 @@ namespace ir::utils {
 		RootFindReport report;
 	};
 
-	// Brent's method on [a,b] with f(a)*f(b) <= 0.
-	Result<RootFindResult> brent(
-		const std::function<double(double)>& f,
-		double a,
-		double b,
-		const RootFindOptions& opts = {}
-	);
+	// Brent's method on [a,b] with f(a)*f(b) <= 0. f(x) -> double.
+	template <class F>
+	Result<RootFindResult> brent(F&& f, double a, double b, const RootFindOptions& opts = {}) {
+		if (!(a < b)) {
+			return Error::make(ErrorCode::InvalidArgument, "brent: require a < b.");
+		}
+
+		double fa = f(a);
+		double fb = f(b);
+		if (!std::isfinite(fa) || !std::isfinite(fb)) {
+			return Error::make(ErrorCode::InvalidArgument, "brent: f(a) or f(b) non-finite.");
+		}
+		if (fa == 0.0) return RootFindResult{ a, RootFindReport{0, fa, true} };
+		if (fb == 0.0) return RootFindResult{ b, RootFindReport{0, fb, true} };
+
+		if (fa * fb > 0.0) {
+			return Error::make(ErrorCode::InvalidArgument, "brent: root not bracketed (f(a)*f(b) > 0).");
+		}
+
+		double c = a;
+		double fc = fa;
+
+		double d = b - a;
+		double e = d;
+
+		RootFindReport rep{ 0, 0.0, false };
+
+		for (int iter = 1; iter <= opts.max_iter; ++iter) {
+			// Ensure |fb| <= |fc|
+			if (std::fabs(fc) < std::fabs(fb)) {
+				a = b;  b = c;  c = a;
+				fa = fb; fb = fc; fc = fa;
+			}
+
+			const double tol = std::max(opts.tol_abs, opts.tol_rel * std::fabs(b));
+			const double m = 0.5 * (c - b);
+
+			if (std::fabs(m) <= tol || fb == 0.0) {
+				rep.iterations = iter;
+				rep.f_at_root = fb;
+				rep.converged = true;
+				return RootFindResult{ b, rep };
+			}
+
+			double p = 0.0, q = 1.0;
+			bool use_interp = false;
+
+			if (std::fabs(e) > tol && std::fabs(fa) > std::fabs(fb)) {
+				// Attempt interpolation
+				use_interp = true;
+				double s = fb / fa;
+
+				if (a == c) {
+					// Secant
+					p = 2.0 * m * s;
+					q = 1.0 - s;
+				}
+				else {
+					// Inverse quadratic interpolation
+					double r = fb / fc;
+					double t = fa / fc;
+					p = s * (2.0 * m * t * (t - r) - (b - a) * (r - 1.0));
+					q = (t - 1.0) * (r - 1.0) * (s - 1.0);
+				}
+
+				if (p > 0.0) q = -q;
+				p = std::fabs(p);
+
+				// Check acceptability
+				const double min1 = 3.0 * m * q - std::fabs(tol * q);
+				const double min2 = std::fabs(e * q);
+
+				if (!(2.0 * p < std::min(min1, min2))) {
+					use_interp = false;
+				}
+			}
+
+			if (!use_interp) {
+				// Bisection
+				d = m;
+				e = m;
+			}
+			else {
+				e = d;
+				d = p / q;
+			}
+
+			a = b;
+			fa = fb;
+
+			if (std::fabs(d) > tol) b += d;
+			else b += (m > 0 ? tol : -tol);
+
+			fb = f(b);
+			if (!std::isfinite(fb)) {
+				return Error::make(ErrorCode::InvalidArgument, "brent: f(x) became non-finite.");
+			}
+
+			// Maintain bracketing
+			if ((fb > 0 && fc > 0) || (fb < 0 && fc < 0)) {
+				c = a;
+				fc = fa;
+				e = d = b - a;
+			}
+		}
+
+		rep.iterations = opts.max_iter;
+		rep.f_at_root = fb;
+		rep.converged = false;
+		return RootFindResult{ b, rep }; // best effort
+	}
+
+	// Newton's method from x0. fdf(x, dfdx) returns f(x) and writes f'(x).
+	// Iterates are kept inside [lo, hi] (a step leaving the interval is replaced by
+	// bisection towards the violated bound). A vanishing derivative or non-finite
+	// values return an error so callers can fall back to a bracketing method.
+	template <class FD>
+	Result<RootFindResult> newton(FD&& fdf, double x0, double lo, double hi, const RootFindOptions& opts = {}) {
+		if (!(lo < hi)) {
+			return Error::make(ErrorCode::InvalidArgument, "newton: require lo < hi.");
+		}
+
+		double x = clamp(x0, lo, hi);
+		double fx = 0.0;
+		RootFindReport rep{ 0, 0.0, false };
+
+		for (int iter = 1; iter <= opts.max_iter; ++iter) {
+			double dfx = 0.0;
+			fx = fdf(x, dfx);
+			if (!std::isfinite(fx) || !std::isfinite(dfx)) {
+				return Error::make(ErrorCode::InvalidArgument, "newton: f(x) or f'(x) non-finite.");
+			}
+			if (fx == 0.0) {
+				return RootFindResult{ x, RootFindReport{ iter, fx, true } };
+			}
+			if (dfx == 0.0) {
+				return Error::make(ErrorCode::InvalidArgument, "newton: zero derivative.");
+			}
+
+			double x_new = x - fx / dfx;
+			if (x_new < lo) x_new = 0.5 * (x + lo);
+			if (x_new > hi) x_new = 0.5 * (x + hi);
+
+			const double tol = std::max(opts.tol_abs, opts.tol_rel * std::fabs(x_new));
+			const bool done = std::fabs(x_new - x) <= tol;
+			x = x_new;
+
+			if (done) {
+				rep.iterations = iter;
+				rep.f_at_root = fx;
+				rep.converged = true;
+				return RootFindResult{ x, rep };
+			}
+		}
+
+		rep.iterations = opts.max_iter;
+		rep.f_at_root = fx;
+		rep.converged = false;
+		return RootFindResult{ x, rep };
+	}
+
+	// Secant method from x0, x1 (no bracket required). f(x) -> double.
+	// Errors on non-finite values or a flat secant (f(x0) == f(x1)).
+	template <class F>
+	Result<RootFindResult> secant(F&& f, double x0, double x1, const RootFindOptions& opts = {}) {
+		if (x0 == x1) {
+			return Error::make(ErrorCode::InvalidArgument, "secant: require x0 != x1.");
+		}
+
+		double f0 = f(x0);
+		double f1 = f(x1);
+		RootFindReport rep{ 0, f1, false };
+
+		for (int iter = 1; iter <= opts.max_iter; ++iter) {
+			if (!std::isfinite(f0) || !std::isfinite(f1)) {
+				return Error::make(ErrorCode::InvalidArgument, "secant: f(x) non-finite.");
+			}
+			if (f1 == 0.0) {
+				return RootFindResult{ x1, RootFindReport{ iter, f1, true } };
+			}
+			if (f1 == f0) {
+				return Error::make(ErrorCode::InvalidArgument, "secant: flat secant.");
+			}
+
+			const double x2 = x1 - f1 * (x1 - x0) / (f1 - f0);
+			const double tol = std::max(opts.tol_abs, opts.tol_rel * std::fabs(x2));
+			const bool done = std::fabs(x2 - x1) <= tol;
+
+			x0 = x1; f0 = f1;
+			x1 = x2; f1 = f(x1);
+
+			if (done) {
+				rep.iterations = iter;
+				rep.f_at_root = f1;
+				rep.converged = true;
+				return RootFindResult{ x1, rep };
+			}
+		}
+
+		rep.iterations = opts.max_iter;
+		rep.f_at_root = f1;
+		rep.converged = false;
+		return RootFindResult{ x1, rep };
+	}
+
+	// Bisection on [a,b] with f(a)*f(b) <= 0. Slow but unconditionally robust.
+	template <class F>
+	Result<RootFindResult> bisection(F&& f, double a, double b, const RootFindOptions& opts = {}) {
+		if (!(a < b)) {
+			return Error::make(ErrorCode::InvalidArgument, "bisection: require a < b.");
+		}
+
+		double fa = f(a);
+		const double fb = f(b);
+		if (!std::isfinite(fa) || !std::isfinite(fb)) {
+			return Error::make(ErrorCode::InvalidArgument, "bisection: f(a) or f(b) non-finite.");
+		}
+		if (fa == 0.0) return RootFindResult{ a, RootFindReport{0, fa, true} };
+		if (fb == 0.0) return RootFindResult{ b, RootFindReport{0, fb, true} };
+		if (fa * fb > 0.0) {
+			return Error::make(ErrorCode::InvalidArgument, "bisection: root not bracketed (f(a)*f(b) > 0).");
+		}
+
+		double m = 0.5 * (a + b);
+		double fm = fa;
+		for (int iter = 1; iter <= opts.max_iter; ++iter) {
+			m = 0.5 * (a + b);
+			fm = f(m);
+			if (!std::isfinite(fm)) {
+				return Error::make(ErrorCode::InvalidArgument, "bisection: f(x) became non-finite.");
+			}
+
+			const double tol = std::max(opts.tol_abs, opts.tol_rel * std::fabs(m));
+			if (fm == 0.0 || 0.5 * (b - a) <= tol) {
+				return RootFindResult{ m, RootFindReport{ iter, fm, true } };
+			}
+
+			if ((fa < 0.0) == (fm < 0.0)) { a = m; fa = fm; }
+			else { b = m; }
+		}
+
+		return RootFindResult{ m, RootFindReport{ opts.max_iter, fm, false } };
+	}
 
 } // namespace ir::utils
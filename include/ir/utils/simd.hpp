@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Vectorised numeric kernels. The AVX2 / AVX-512 paths are compiled in when the
+// library is configured with IR_ENABLE_AVX2 / IR_ENABLE_AVX512; otherwise the
+// portable scalar fallback is used. Results agree with std::exp to ~1 ulp.
+
+namespace ir::utils::simd {
+
+	// Instruction set selected at build time: "avx512", "avx2" or "scalar".
+	const char* isa();
+
+	// x[i] = exp(x[i])
+	void exp_inplace(std::span<double> x);
+
+	// Log-linear segment interpolation, n points:
+	//   out[k] = log_ys[idx[k]] + slopes[idx[k]] * (x[k] - xs[idx[k]])
+	// (log-space value; follow with exp_inplace). Indices are gathered.
+	void log_linear_gather(const double* xs, const double* log_ys, const double* slopes,
+		const std::int64_t* idx, const double* x, std::size_t n, double* out);
+
+} // namespace ir::utils::simd
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "ir/core/result.hpp"
+
+namespace ir::utils {
+
+	// Compressed sparse row matrix. Built row by row:
+	//   SparseMatrix m(rows, cols); m.push(j, v) ...; m.end_row(); ...
+	struct SparseMatrix {
+		std::size_t rows{ 0 };
+		std::size_t cols{ 0 };
+		std::vector<std::size_t> row_ptr{ 0 };   // size rows + 1 once complete
+		std::vector<std::size_t> col;           // column index per stored entry
+		std::vector<double> val;                // value per stored entry
+
+		SparseMatrix() = default;
+		SparseMatrix(std::size_t r, std::size_t c) : rows(r), cols(c) {
+			row_ptr.reserve(r + 1);
+		}
+
+		// Append entry (row currently being built, column j). Zeros are skipped.
+		void push(std::size_t j, double v) {
+			if (v == 0.0) return;
+			col.push_back(j);
+			val.push_back(v);
+		}
+		void end_row() { row_ptr.push_back(col.size()); }
+
+		std::size_t nonzeros() const { return val.size(); }
+
+		// Entry (i, j); 0 if not stored.
+		double at(std::size_t i, std::size_t j) const;
+
+		// y = A x
+		std::vector<double> multiply(const std::vector<double>& x) const;
+		// y = A^T x (x.size() == rows)
+		std::vector<double> multiply_transposed(std::span<const double> x) const;
+	};
+
+	// Solve A x = b (A square) by LU with partial pivoting, each row held densely over
+	// its envelope (first to last stored column, widened by fill-in). Elimination only
+	// touches rows whose envelope reaches the pivot column, over the pivot row's
+	// envelope, so the curve Jacobians (nonzeros up to a node or two past the diagonal)
+	// solve in O(n^2 * upper bandwidth) rather than O(n^3).
+	Result<std::vector<double>> solve(const SparseMatrix& a, std::vector<double> b);
+
+} // namespace ir::utils
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ir::utils {
+
+	// Fixed-size work-stealing thread pool. Every worker owns a deque: it runs tasks from
+	// the back of its own deque and, when that is empty, steals from the front of the
+	// others. Tasks submitted from a worker go to that worker's deque; tasks submitted
+	// from outside are spread round-robin.
+	class ThreadPool {
+	public:
+		// threads == 0 uses std::thread::hardware_concurrency() (at least 1).
+		explicit ThreadPool(std::size_t threads = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		std::size_t size() const { return threads_.size(); }
+
+		// Fire-and-forget. The task must not throw.
+		void submit(std::function<void()> task);
+
+		// Calls body(begin, end) over [0, n) in chunks of at most `grain` indices and
+		// blocks until every chunk has run. The calling thread runs chunks too, so this
+		// may be called from inside a task. The first exception thrown by a chunk is
+		// rethrown here once all chunks have finished.
+		void parallel_for(std::size_t n, std::size_t grain,
+			const std::function<void(std::size_t, std::size_t)>& body);
+
+	private:
+		struct Queue {
+			std::mutex m;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		void push(std::size_t q, std::function<void()> task);
+		bool try_run_one(std::size_t self);
+		void worker_loop(std::size_t self);
+
+		std::vector<std::unique_ptr<Queue>> queues_;
+		std::vector<std::thread> threads_;
+
+		std::mutex wake_m_;
+		std::condition_variable wake_cv_;
+		std::atomic<std::size_t> pending_{ 0 };   // queued, not yet started
+		std::atomic<std::size_t> next_queue_{ 0 };
+		bool stop_{ false };
+	};
+
+} // namespace ir::utils
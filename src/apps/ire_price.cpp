@@ -1,6 +1,11 @@
+#include <algorithm>
+#include <charconv>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -9,11 +14,16 @@
 
 #include "ir/core/conventions.hpp"
 #include "ir/core/date.hpp"
+#include "ir/core/schedule_cache.hpp"
 #include "ir/io/deal_io.hpp"
+#include "ir/io/market_cache.hpp"
 #include "ir/io/market_io.hpp"
+#include "ir/io/snapshot.hpp"
 #include "ir/market/market_data.hpp"
 #include "ir/pricers/swap_pricer.hpp"
 #include "ir/instruments/leg_builder.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+#include "ir/utils/thread_pool.hpp"
 
 namespace fs = std::filesystem;
 
@@ -68,12 +78,37 @@ static fs::path find_repo_root_from_cwd() {
         "Could not locate repository root from current working directory.");
 }
 
+static bool has_flag(int argc, char** argv, const std::string& flag) {
+    for (int i = 1; i < argc; ++i) {
+        if (argv[i] == flag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// --threads value: a whole number in [0, kMaxThreads], 0 meaning one per core
+static constexpr std::size_t kMaxThreads = 1024;
+
+static std::optional<std::size_t> parse_thread_count(const std::string& text) {
+    std::size_t n = 0;
+    const char* first = text.data();
+    const char* last = first + text.size();
+    const auto [ptr, ec] = std::from_chars(first, last, n);
+    if (ec != std::errc{} || ptr != last || n > kMaxThreads) {
+        return std::nullopt;
+    }
+    return n;
+}
+
 static fs::path resolve_input_folder(int argc, char** argv) {
     if (argc < 2) {
         throw std::runtime_error(
             "Usage:\n"
-            "  ire_price <folder_path>\n"
-            "  ire_price --example <folder_name>\n");
+            "  ire_price <folder_path> [--risk]\n"
+            "  ire_price --example <folder_name> [--risk]\n"
+            "  ire_price --batch <root_folder> [--threads N] [--risk]\n"
+            "  ire_price --snapshot <folder> [<out_file>]\n");
     }
 
     const std::string arg1 = argv[1];
@@ -160,187 +195,562 @@ static void write_result_csv(
     }
 }
 
-int main(int argc, char** argv) {
-    try {
-        const fs::path folder = resolve_input_folder(argc, argv);
+// Bucketed DV01: one row per curve node, one column per leg plus the deal total.
+static void write_result_risk_csv(
+    const fs::path& out_file,
+    const ir::risk::BucketedRisk& risk) {
+
+    std::ofstream out(out_file);
+    if (!out) {
+        throw std::runtime_error(
+            "Could not open output file for writing: " + out_file.string());
+    }
 
-        // -------- Load deal_data.csv --------
-        auto deal_res = ir::io::read_deal_data_csv((folder / "deal_data.csv").string());
-        if (!deal_res.has_value()) {
-            throw std::runtime_error(deal_res.error().message);
+    out << "Curve,Role,Node,T";
+    for (const auto& leg : risk.legs) {
+        out << "," << leg.leg_id;
+    }
+    out << ",Total\n";
+    for (std::size_t p = 0; p < risk.pillars.size(); ++p) {
+        const auto& pillar = risk.pillars[p];
+        out << pillar.curve.value << ","
+            << (pillar.role == ir::risk::CurveRole::Discount ? "Discount" : "Forward") << ","
+            << pillar.node << ","
+            << pillar.t;
+        double total = 0.0;
+        for (std::size_t l = 0; l < risk.legs.size(); ++l) {
+            out << "," << risk.leg_delta(p, l);
+            total += risk.leg_delta(p, l);
         }
+        out << "," << total << "\n";
+    }
+}
 
-        ir::io::DealSpec deal = deal_res.value();
-        if (deal.legs.empty()) {
-            throw std::runtime_error("Deal has no legs.");
+// Market files are looked up in the deal folder first, then in each parent folder up
+// to market_root, so a batch can keep shared curves and fixings at its root.
+static fs::path find_market_file(const fs::path& folder, const fs::path& market_root,
+    const std::string& name) {
+    for (fs::path p = folder; ; p = p.parent_path()) {
+        if (fs::exists(p / name)) {
+            return p / name;
         }
+        if (p == market_root || p == p.parent_path() || p.empty()) {
+            break;
+        }
+    }
+    return folder / name;
+}
 
-        // -------- Market setup --------
-        const ir::Date asof = deal.legs.front().cob;
-        ir::market::MarketData md(asof);
-        ir::market::FixingStore fixings;
+struct DealSummary {
+    ir::Date valuation_date{};
+    std::size_t num_legs{ 0 };
+    std::size_t num_cashflows{ 0 };
+    double total_pv{ 0.0 };
+};
 
-        // discount.csv remains mandatory
-        const auto& discount_id = deal.legs.front().discount_curve;
-        auto disc_res = ir::io::load_discount_curve_nodes_csv(
-            (folder / "discount.csv").string(), discount_id, md);
-        if (!disc_res.has_value()) {
-            throw std::runtime_error(disc_res.error().message);
-        }
+// Market objects one deal needs, keyed by the ids in its deal_data.csv.
+struct DealMarket {
+    std::vector<std::pair<ir::CurveId, std::shared_ptr<ir::market::PiecewiseDiscountCurve>>> discount;
+    std::vector<std::pair<ir::CurveId, std::shared_ptr<ir::market::PiecewiseForwardCurve>>> forward;
+    std::vector<std::pair<ir::IndexId, std::string>> fixing_files;   // index, fixing CSV path
+    std::shared_ptr<const ir::market::FixingStore> fixings;            // shared, from the cache
+};
 
-        // -------- Load forward curves and optional fixings --------
-        std::unordered_map<std::string, ir::IndexId> fixings_map;
-        std::unordered_map<std::string, bool> loaded_fwd;
+static const char* kSnapshotFile = "market.irsnap";
 
-        for (const auto& leg : deal.legs) {
-            if (leg.type == ir::io::LegType::Ibor || leg.type == ir::io::LegType::Rfr) {
-                if (leg.fwd_curve.value.empty()) {
-                    throw std::runtime_error(
-                        "Floating leg missing FwdCurveID: " + leg.leg_id);
-                }
+static ir::io::DealSpec read_deal(const fs::path& folder) {
+    auto deal_res = ir::io::read_deal_data_csv((folder / "deal_data.csv").string());
+    if (!deal_res.has_value()) {
+        throw std::runtime_error(deal_res.error().message);
+    }
+    if (deal_res.value().legs.empty()) {
+        throw std::runtime_error("Deal has no legs.");
+    }
+    return deal_res.value();
+}
+
+// The cache's shared store for these fixing files; throws on a read or parse error.
+static std::shared_ptr<const ir::market::FixingStore> fixing_store_or_throw(
+    const std::vector<std::pair<ir::IndexId, std::string>>& files,
+    ir::io::MarketFileCache& cache) {
+    auto res = cache.fixing_store(files);
+    if (!res.has_value()) {
+        throw std::runtime_error(res.error().message);
+    }
+    return res.value();
+}
 
-                const std::string fwd_file = leg.fwd_curve.value + ".csv";
+// Loads the deal's curves and fixings from the CSV market files.
+static DealMarket load_deal_market(const fs::path& folder,
+    const fs::path& market_root,
+    const ir::io::DealSpec& deal,
+    ir::io::MarketFileCache& cache) {
+    const ir::Date asof = deal.legs.front().cob;
+    DealMarket m;
+
+    // discount.csv remains mandatory
+    auto disc_res = cache.discount_curve(
+        find_market_file(folder, market_root, "discount.csv").string(), asof);
+    if (!disc_res.has_value()) {
+        throw std::runtime_error(disc_res.error().message);
+    }
+    m.discount.emplace_back(deal.legs.front().discount_curve, disc_res.value());
 
-                if (!loaded_fwd[leg.fwd_curve.value]) {
-                    auto fwd_res = ir::io::load_forward_curve_nodes_csv(
-                        (folder / fwd_file).string(), leg.fwd_curve, md);
-                    if (!fwd_res.has_value()) {
-                        throw std::runtime_error(fwd_res.error().message);
-                    }
-                    loaded_fwd[leg.fwd_curve.value] = true;
-                }
+    // -------- Load forward curves and optional fixings --------
+    std::unordered_map<std::string, ir::IndexId> fixings_map;
+    std::unordered_map<std::string, bool> loaded_fwd;
 
-                if (!leg.fixings_id.empty()) {
-                    fixings_map[leg.fixings_id] = leg.index;
-                }
+    for (const auto& leg : deal.legs) {
+        if (leg.type == ir::io::LegType::Ibor || leg.type == ir::io::LegType::Rfr) {
+            if (leg.fwd_curve.value.empty()) {
+                throw std::runtime_error(
+                    "Floating leg missing FwdCurveID: " + leg.leg_id);
             }
-        }
 
-        for (const auto& [fix_id, index] : fixings_map) {
-            const fs::path p = folder / (fix_id + ".csv");
-            if (fs::exists(p)) {
-                auto fix_res = ir::io::load_fixings_csv(p.string(), index, fixings);
-                if (!fix_res.has_value()) {
-                    throw std::runtime_error(fix_res.error().message);
+            const std::string fwd_file = leg.fwd_curve.value + ".csv";
+
+            if (!loaded_fwd[leg.fwd_curve.value]) {
+                auto fwd_res = cache.forward_curve(
+                    find_market_file(folder, market_root, fwd_file).string(), asof);
+                if (!fwd_res.has_value()) {
+                    throw std::runtime_error(fwd_res.error().message);
                 }
+                m.forward.emplace_back(leg.fwd_curve, fwd_res.value());
+                loaded_fwd[leg.fwd_curve.value] = true;
             }
+
+            if (!leg.fixings_id.empty()) {
+                fixings_map[leg.fixings_id] = leg.index;
+            }
+        }
+    }
+
+    for (const auto& [fix_id, index] : fixings_map) {
+        const fs::path p = find_market_file(folder, market_root, fix_id + ".csv");
+        if (fs::exists(p)) {
+            m.fixing_files.emplace_back(index, p.string());
+        }
+    }
+    m.fixings = fixing_store_or_throw(m.fixing_files, cache);
+    return m;
+}
+
+// Registers m's curves and fixing store in md; m.fixings must outlive md.
+static void install_market(const DealMarket& m, ir::market::MarketData& md) {
+    for (const auto& [id, c] : m.discount) md.set_discount_curve(id, c);
+    for (const auto& [id, c] : m.forward) md.set_forward_curve(id, c);
+    md.set_fixings(m.fixings.get());
+}
+
+// Prices one deal folder and writes its result.csv / result_cashflows.csv.
+// The market comes from market.irsnap if one is found (deal folder, then parents up
+// to market_root), otherwise from the CSV market files.
+// With a risk engine it also writes result_risk.csv (bucketed DV01 per leg).
+// Throws std::runtime_error on any input or pricing failure.
+static DealSummary price_deal_folder(const fs::path& folder,
+    const fs::path& market_root,
+    ir::io::MarketFileCache& cache,
+    const ir::risk::BucketedRiskEngine* risk = nullptr) {
+    // -------- Load deal_data.csv --------
+    const ir::io::DealSpec deal = read_deal(folder);
+
+    // -------- Market setup --------
+    const ir::Date asof = deal.legs.front().cob;
+    ir::market::MarketData csv_md(asof);
+    DealMarket csv_market;
+    std::shared_ptr<const ir::io::MarketSnapshot> snap;
+
+    const fs::path snap_file = find_market_file(folder, market_root, kSnapshotFile);
+    if (fs::exists(snap_file)) {
+        auto snap_res = cache.snapshot(snap_file.string());
+        if (!snap_res.has_value()) {
+            throw std::runtime_error(snap_res.error().message);
+        }
+        snap = snap_res.value();
+        if (snap->md->asof() != asof) {
+            throw std::runtime_error(snap_file.string() + " is for " + snap->md->asof().to_iso()
+                + ", deal COB is " + asof.to_iso());
         }
+    }
+    else {
+        csv_market = load_deal_market(folder, market_root, deal, cache);
+        install_market(csv_market, csv_md);
+    }
+    const ir::market::MarketData& md = snap ? *snap->md : csv_md;
 
-        md.set_fixings(&fixings);
+    // -------- Build legs --------
+    ir::Calendar cal;
+    const auto bdc = ir::BusinessDayConvention::ModifiedFollowing;
 
-        // -------- Build legs --------
-        ir::Calendar cal;
-        const auto bdc = ir::BusinessDayConvention::ModifiedFollowing;
+    std::vector<BuiltLegEntry> built_legs;
+    built_legs.reserve(deal.legs.size());
 
-        std::vector<BuiltLegEntry> built_legs;
-        built_legs.reserve(deal.legs.size());
+    for (const auto& leg_spec : deal.legs) {
+        ir::ScheduleConfig sc;
+        sc.start = leg_spec.start;
+        sc.end = leg_spec.end;
+        sc.tenor = parse_tenor_or_throw(leg_spec.frequency);
+        sc.calendar = cal;
+        sc.bdc = bdc;
+        sc.rule = ir::DateGenerationRule::Backward;
 
-        for (const auto& leg_spec : deal.legs) {
-            ir::ScheduleConfig sc;
-            sc.start = leg_spec.start;
-            sc.end = leg_spec.end;
-            sc.tenor = parse_tenor_or_throw(leg_spec.frequency);
-            sc.calendar = cal;
-            sc.bdc = bdc;
-            sc.rule = ir::DateGenerationRule::Backward;
+        const auto sched_ptr = ir::ScheduleCache::global().get(sc);
+        const ir::Schedule& sched = *sched_ptr;
 
-            auto sched = ir::make_schedule(sc);
+        if (leg_spec.type == ir::io::LegType::Fixed) {
+            ir::instruments::FixedLegConfig cfg;
+            cfg.notional = leg_spec.notional;
+            cfg.fixed_rate = leg_spec.fixed_rate;
+            cfg.dc = leg_spec.dc;
 
-            if (leg_spec.type == ir::io::LegType::Fixed) {
-                ir::instruments::FixedLegConfig cfg;
-                cfg.notional = leg_spec.notional;
-                cfg.fixed_rate = leg_spec.fixed_rate;
-                cfg.dc = leg_spec.dc;
+            auto leg = ir::instruments::LegBuilder::build_fixed_leg(
+                to_instr_dir(leg_spec.dir), sched, cfg);
 
-                auto leg = ir::instruments::LegBuilder::build_fixed_leg(
-                    to_instr_dir(leg_spec.dir), sched, cfg);
+            built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
+        }
+        else if (leg_spec.type == ir::io::LegType::Ibor) {
+            ir::instruments::IborLegConfig cfg;
+            cfg.notional = leg_spec.notional;
+            cfg.spread = leg_spec.spread;
+            cfg.index = leg_spec.index;
+            cfg.dc = leg_spec.dc;
+            cfg.fixing_lag_days = 2;
+
+            auto leg = ir::instruments::LegBuilder::build_ibor_leg(
+                to_instr_dir(leg_spec.dir), sched, cfg, cal, bdc);
+
+            built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
+        }
+        else {
+            ir::instruments::RfrLegConfig cfg;
+            cfg.notional = leg_spec.notional;
+            cfg.spread = leg_spec.spread;
+            cfg.index = leg_spec.index;
+            cfg.dc = leg_spec.dc;
 
-                built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
-            }
-            else if (leg_spec.type == ir::io::LegType::Ibor) {
-                ir::instruments::IborLegConfig cfg;
-                cfg.notional = leg_spec.notional;
-                cfg.spread = leg_spec.spread;
-                cfg.index = leg_spec.index;
-                cfg.dc = leg_spec.dc;
-                cfg.fixing_lag_days = 2;
-
-                auto leg = ir::instruments::LegBuilder::build_ibor_leg(
-                    to_instr_dir(leg_spec.dir), sched, cfg, cal, bdc);
-
-                built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
-            }
-            else {
-                ir::instruments::RfrLegConfig cfg;
-                cfg.notional = leg_spec.notional;
-                cfg.spread = leg_spec.spread;
-                cfg.index = leg_spec.index;
-                cfg.dc = leg_spec.dc;
+            auto leg = ir::instruments::LegBuilder::build_rfr_compound_leg(
+                to_instr_dir(leg_spec.dir), sched, cfg);
 
-                auto leg = ir::instruments::LegBuilder::build_rfr_compound_leg(
-                    to_instr_dir(leg_spec.dir), sched, cfg);
+            built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
+        }
+    }
 
-                built_legs.push_back(BuiltLegEntry{ leg_spec, std::move(leg) });
-            }
+    // -------- Price each leg independently --------
+    ir::pricers::MultiCurveSwapPricer pricer;
+
+    double total_pv = 0.0;
+    std::vector<std::pair<std::string, double>> leg_pvs;
+    std::vector<ResultCashflowRow> cashflow_rows;
+    std::vector<ir::pricers::PricingContext> leg_contexts;
+
+    for (const auto& entry : built_legs) {
+        ir::pricers::PricingContext ctx;
+        ctx.valuation_date = asof;
+        ctx.framework = ir::pricers::PricingFramework::MultiCurve;
+        ctx.discount_curve = entry.spec.discount_curve;
+
+        if (entry.spec.type == ir::io::LegType::Ibor) {
+            ctx.ibor_forward_curve = entry.spec.fwd_curve;
+        }
+        else if (entry.spec.type == ir::io::LegType::Rfr) {
+            ctx.rfr_forward_curve = entry.spec.fwd_curve;
+        }
+
+        leg_contexts.push_back(ctx);
+        auto leg_res = pricer.price_leg(entry.leg, md, ctx);
+        if (!leg_res.has_value()) {
+            throw std::runtime_error(
+                "Failed pricing leg " + entry.spec.leg_id + ": " +
+                leg_res.error().message);
         }
 
-        // -------- Price each leg independently --------
-        ir::pricers::MultiCurveSwapPricer pricer;
+        total_pv += leg_res.value().pv;
+        leg_pvs.push_back({ entry.spec.leg_id, leg_res.value().pv });
+
+        for (const auto& line : leg_res.value().lines) {
+            ResultCashflowRow row;
+            row.leg_id = entry.spec.leg_id;
+            row.leg_type = to_string_leg_type(entry.spec.type);
+            row.pay_receive = to_int_pay_receive(entry.spec.dir);
+            row.pay_date = line.pay_date.to_iso();
+            row.amount = line.amount;
+            row.df = line.df;
+            row.pv = line.pv;
+            cashflow_rows.push_back(std::move(row));
+        }
+    }
 
-        double total_pv = 0.0;
-        std::vector<std::pair<std::string, double>> leg_pvs;
-        std::vector<ResultCashflowRow> cashflow_rows;
+    // -------- Write outputs --------
+    write_result_cashflows_csv(folder / "result_cashflows.csv", cashflow_rows);
+    write_result_csv(folder / "result.csv", asof, total_pv, leg_pvs, cashflow_rows.size());
 
+    if (risk) {
+        std::vector<ir::pricers::PortfolioTrade> trades;
+        trades.reserve(built_legs.size());
         for (const auto& entry : built_legs) {
-            ir::pricers::PricingContext ctx;
-            ctx.valuation_date = asof;
-            ctx.framework = ir::pricers::PricingFramework::MultiCurve;
-            ctx.discount_curve = entry.spec.discount_curve;
+            ir::instruments::Leg leg = entry.leg;
+            leg.leg_id = entry.spec.leg_id;
+            trades.push_back(ir::pricers::PortfolioTrade{
+                ir::pricers::PortfolioProduct(std::in_place_type<ir::instruments::Leg>, std::move(leg)),
+                leg_contexts[trades.size()] });
+        }
+        auto risk_res = risk->compute(trades, md, leg_contexts.front());
+        if (!risk_res.has_value()) {
+            throw std::runtime_error(risk_res.error().message);
+        }
+        write_result_risk_csv(folder / "result_risk.csv", risk_res.value());
+    }
+
+    return DealSummary{ asof, built_legs.size(), cashflow_rows.size(), total_pv };
+}
+
+struct BatchEntry {
+    fs::path folder;
+    DealSummary summary{};
+    std::string error{};
+};
+
+// Every folder under root (root included) that contains a deal_data.csv, sorted.
+static std::vector<fs::path> find_deal_folders(const fs::path& root) {
+    std::vector<fs::path> out;
+    if (fs::exists(root / "deal_data.csv")) {
+        out.push_back(root);
+    }
+    for (const auto& e : fs::recursive_directory_iterator(root)) {
+        if (e.is_directory() && fs::exists(e.path() / "deal_data.csv")) {
+            out.push_back(e.path());
+        }
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static void write_portfolio_summary_csv(const fs::path& out_file,
+    const fs::path& root,
+    const std::vector<BatchEntry>& entries,
+    double total_pv) {
+
+    std::ofstream out(out_file);
+    if (!out) {
+        throw std::runtime_error(
+            "Could not open output file for writing: " + out_file.string());
+    }
+
+    out << "Deal,ValuationDate,NumLegs,NumCashflows,PV,Status\n";
+    for (const auto& e : entries) {
+        out << fs::relative(e.folder, root).generic_string() << ",";
+        if (e.error.empty()) {
+            out << e.summary.valuation_date.to_iso() << ","
+                << e.summary.num_legs << ","
+                << e.summary.num_cashflows << ","
+                << e.summary.total_pv << ",OK\n";
+        }
+        else {
+            // Keep the message on one CSV field
+            std::string msg = e.error;
+            std::replace(msg.begin(), msg.end(), ',', ';');
+            std::replace(msg.begin(), msg.end(), '\n', ' ');
+            out << ",,,,ERROR: " << msg << "\n";
+        }
+    }
+    out << "\nTotalPV\n" << total_pv << "\n";
+}
+
+static int run_batch(fs::path root, std::size_t threads, bool with_risk) {
+    if (!fs::is_directory(root)) {
+        throw std::runtime_error("Batch root is not a directory: " + root.string());
+    }
+    // Canonical, without a trailing separator, so find_market_file stops at it
+    root = fs::weakly_canonical(root);
+    if (!root.has_filename()) {
+        root = root.parent_path();
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    std::vector<BatchEntry> entries;
+    for (auto& f : find_deal_folders(root)) {
+        entries.push_back(BatchEntry{ std::move(f) });
+    }
 
-            if (entry.spec.type == ir::io::LegType::Ibor) {
-                ctx.ibor_forward_curve = entry.spec.fwd_curve;
+    ir::io::MarketFileCache cache;
+    ir::utils::ThreadPool pool(threads);
+    // Deals already run in parallel, so each risk run stays on its deal's thread
+    const ir::risk::BucketedRiskEngine risk(ir::risk::BucketedRiskOptions{ 1e-4, 1 });
+    pool.parallel_for(entries.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            try {
+                entries[i].summary = price_deal_folder(entries[i].folder, root, cache,
+                    with_risk ? &risk : nullptr);
             }
-            else if (entry.spec.type == ir::io::LegType::Rfr) {
-                ctx.rfr_forward_curve = entry.spec.fwd_curve;
+            catch (const std::exception& e) {
+                entries[i].error = e.what();
             }
+        }
+        });
 
-            auto leg_res = pricer.price_leg(entry.leg, md, ctx);
-            if (!leg_res.has_value()) {
-                throw std::runtime_error(
-                    "Failed pricing leg " + entry.spec.leg_id + ": " +
-                    leg_res.error().message);
+    double total_pv = 0.0;
+    std::size_t failed = 0;
+    for (const auto& e : entries) {
+        if (e.error.empty()) {
+            total_pv += e.summary.total_pv;
+        }
+        else {
+            ++failed;
+            std::cerr << "Failed: " << e.folder.string() << ": " << e.error << "\n";
+        }
+    }
+
+    const fs::path summary_file = root / "portfolio_summary.csv";
+    write_portfolio_summary_csv(summary_file, root, entries, total_pv);
+
+    const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    const auto stats = cache.stats();
+    const auto sched_stats = ir::ScheduleCache::global().stats();
+
+    std::cout << "\n=== Batch pricing completed ===\n";
+    std::cout << "Root folder         : " << root.string() << "\n";
+    std::cout << "Threads             : " << pool.size() << "\n";
+    std::cout << "Deals priced        : " << (entries.size() - failed) << "\n";
+    std::cout << "Deals failed        : " << failed << "\n";
+    std::cout << "Portfolio PV        : " << total_pv << "\n";
+    std::cout << "Market files read   : " << stats.files_read
+        << " (built " << stats.built << ", cache hits " << stats.hits << ")\n";
+    std::cout << "Schedules generated : " << sched_stats.misses
+        << " (cache hits " << sched_stats.hits << ")\n";
+    std::cout << "Wall time [s]       : " << secs << "\n";
+    std::cout << "Deals/sec           : " << (secs > 0.0 ? entries.size() / secs : 0.0) << "\n";
+    std::cout << "Wrote               : " << summary_file.string() << "\n";
+    std::cout << "Done.\n";
+
+    return failed == 0 ? 0 : 2;
+}
+
+// Builds one snapshot from the CSV market of every deal folder under root (root
+// included). All deals must share a COB; a curve id loaded from two different
+// contents is an error.
+static int run_make_snapshot(const fs::path& root, fs::path out_file) {
+    if (out_file.empty()) {
+        out_file = root / kSnapshotFile;
+    }
+    fs::path market_root = fs::weakly_canonical(root);
+    if (!market_root.has_filename()) {
+        market_root = market_root.parent_path();
+    }
+    const auto folders = find_deal_folders(root);
+    if (folders.empty()) {
+        throw std::runtime_error("No deal_data.csv under " + root.string());
+    }
+
+    ir::io::MarketFileCache cache;
+    std::optional<ir::Date> asof;
+    DealMarket all;
+    std::unordered_map<std::string, const void*> seen;   // curve id -> curve object
+
+    auto merge = [&](auto& into, const auto& from, const char* kind) {
+        for (const auto& [id, c] : from) {
+            const std::string key = std::string(kind) + "|" + id.value;
+            auto [it, inserted] = seen.emplace(key, c.get());
+            if (inserted) {
+                into.emplace_back(id, c);
+            }
+            else if (it->second != c.get()) {
+                throw std::runtime_error(std::string("Conflicting ") + kind + " curve " + id.value);
             }
+        }
+    };
+
+    for (const auto& folder : folders) {
+        const ir::io::DealSpec deal = read_deal(folder);
+        const ir::Date cob = deal.legs.front().cob;
+        if (asof && *asof != cob) {
+            throw std::runtime_error("Deals have different COB dates: " + asof->to_iso()
+                + " and " + cob.to_iso() + " (" + folder.string() + ")");
+        }
+        asof = cob;
+
+        const DealMarket m = load_deal_market(fs::weakly_canonical(folder), market_root, deal, cache);
+        merge(all.discount, m.discount, "discount");
+        merge(all.forward, m.forward, "forward");
+        for (const auto& f : m.fixing_files) {
+            if (std::find(all.fixing_files.begin(), all.fixing_files.end(), f) == all.fixing_files.end()) {
+                all.fixing_files.push_back(f);
+            }
+        }
+    }
+    all.fixings = fixing_store_or_throw(all.fixing_files, cache);
+
+    ir::market::MarketData md(*asof);
+    install_market(all, md);
 
-            total_pv += leg_res.value().pv;
-            leg_pvs.push_back({ entry.spec.leg_id, leg_res.value().pv });
-
-            for (const auto& line : leg_res.value().lines) {
-                ResultCashflowRow row;
-                row.leg_id = entry.spec.leg_id;
-                row.leg_type = to_string_leg_type(entry.spec.type);
-                row.pay_receive = to_int_pay_receive(entry.spec.dir);
-                row.pay_date = line.pay_date.to_iso();
-                row.amount = line.amount;
-                row.df = line.df;
-                row.pv = line.pv;
-                cashflow_rows.push_back(std::move(row));
+    auto bytes = ir::io::save_snapshot(md, out_file.string());
+    if (!bytes.has_value()) {
+        throw std::runtime_error(bytes.error().message);
+    }
+
+    std::cout << "\n=== Snapshot written ===\n";
+    std::cout << "Deals scanned       : " << folders.size() << "\n";
+    std::cout << "Valuation date      : " << asof->to_iso() << "\n";
+    std::cout << "Discount curves     : " << all.discount.size() << "\n";
+    std::cout << "Forward curves      : " << all.forward.size() << "\n";
+    std::cout << "Fixing indices      : " << all.fixings->indices().size() << "\n";
+    std::cout << "Bytes               : " << bytes.value() << "\n";
+    std::cout << "Wrote               : " << out_file.string() << "\n";
+    std::cout << "Done.\n";
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    try {
+        if (argc >= 2 && std::string(argv[1]) == "--batch") {
+            const std::string usage = "Usage: ire_price --batch <root_folder> [--threads N] [--risk]";
+            if (argc < 3) {
+                throw std::runtime_error(usage);
             }
+            std::size_t threads = 0;
+            for (int i = 3; i < argc; ++i) {
+                if (std::string(argv[i]) == "--threads") {
+                    const auto n = (i + 1 < argc) ? parse_thread_count(argv[i + 1]) : std::nullopt;
+                    if (!n) {
+                        throw std::runtime_error("Invalid --threads value (expected an integer in [0, "
+                            + std::to_string(kMaxThreads) + "]). " + usage);
+                    }
+                    threads = *n;
+                    ++i;
+                }
+            }
+            return run_batch(fs::path(argv[2]), threads, has_flag(argc, argv, "--risk"));
+        }
+        if (argc >= 2 && std::string(argv[1]) == "--snapshot") {
+            if (argc < 3) {
+                throw std::runtime_error("Usage: ire_price --snapshot <folder> [<out_file>]");
+            }
+            return run_make_snapshot(fs::path(argv[2]), argc >= 4 ? fs::path(argv[3]) : fs::path{});
         }
 
-        // -------- Write outputs --------
-        const fs::path result_cashflows_file = folder / "result_cashflows.csv";
-        const fs::path result_file = folder / "result.csv";
+        const fs::path folder = resolve_input_folder(argc, argv);
+
+        const bool with_risk = has_flag(argc, argv, "--risk");
 
-        write_result_cashflows_csv(result_cashflows_file, cashflow_rows);
-        write_result_csv(result_file, asof, total_pv, leg_pvs, cashflow_rows.size());
+        ir::io::MarketFileCache cache;
+        // Built only for --risk: the engine starts a thread pool
+        std::optional<ir::risk::BucketedRiskEngine> risk;
+        if (with_risk) {
+            risk.emplace();
+        }
+        const DealSummary summary = price_deal_folder(folder, folder, cache,
+            risk ? &*risk : nullptr);
 
         std::cout << "\n=== Pricing completed ===\n";
         std::cout << "Input folder        : " << folder.string() << "\n";
-        std::cout << "Number of legs      : " << built_legs.size() << "\n";
-        std::cout << "Number of cashflows : " << cashflow_rows.size() << "\n";
-        std::cout << "Total PV            : " << total_pv << "\n";
-        std::cout << "Wrote               : " << result_cashflows_file.string() << "\n";
-        std::cout << "Wrote               : " << result_file.string() << "\n";
+        std::cout << "Number of legs      : " << summary.num_legs << "\n";
+        std::cout << "Number of cashflows : " << summary.num_cashflows << "\n";
+        std::cout << "Total PV            : " << summary.total_pv << "\n";
+        std::cout << "Wrote               : " << (folder / "result_cashflows.csv").string() << "\n";
+        std::cout << "Wrote               : " << (folder / "result.csv").string() << "\n";
+        if (with_risk) {
+            std::cout << "Wrote               : " << (folder / "result_risk.csv").string() << "\n";
+        }
         std::cout << "Done.\n";
 
         return 0;
@@ -1,10 +1,12 @@
 #include "ir/core/date.hpp"
 #include "ir/core/error.hpp"
+#include <bit>
 #include <chrono>
+#include <charconv>
 #include <vector>
 #include <string>
-#include <sstream>
 #include <algorithm>
+#include <cmath>
 
 namespace ir {
 
@@ -15,36 +17,32 @@ namespace ir {
     std::chrono::days operator-(const Date& a, const Date& b) { return static_cast<std::chrono::days>(a.raw() - b.raw()); }
 
 
-    // Minimal stub for parse_iso; leave unimplemented or implement later.
-    Result<Date> Date::parse_iso(const std::string_view& iso)
-    {
-        std::string segment;
-        std::vector<int> seglist{};
-        Error e;
+    static bool is_digit(char c) { return c >= '0' && c <= '9'; }
 
+    static Error invalid_iso_date() {
+        return Error::make(ErrorCode::InvalidDate, "The date does not follow format 'YYYY-mm-dd'");
+    }
 
-        std::stringstream ss(static_cast<std::string>(iso));
-        while (std::getline(ss, segment, '-'))
-        {
-            try {
-                seglist.push_back(std::stoi(segment));
-            }
-            catch (...) {
-                e.code = ErrorCode::ParseError;
-                e.message = "Non-numeric date segment";
-                return e;
+    // try_parse_iso does the parsing; on failure the form is re-read with
+    // std::from_chars per segment to tell a malformed string from an invalid date.
+    Result<Date> Date::parse_iso(const std::string_view& iso)
+    {
+        if (auto d = try_parse_iso(iso)) return *d;
+
+        std::size_t pos = 0;
+        for (;;) {
+            const std::size_t dash = std::min(iso.find('-', pos), iso.size());
+            const char* first = iso.data() + pos;
+            const char* last = iso.data() + dash;
+            int v = 0;
+            const auto [ptr, ec] = std::from_chars(first, last, v);
+            if (ec != std::errc{} || ptr != last) {
+                return Error::make(ErrorCode::ParseError, "Non-numeric date segment");
             }
+            if (dash == iso.size()) break;
+            pos = dash + 1;
         }
-
-        if (seglist.size()!=3 ||
-            (seglist[0] < 0 || seglist[1] < 1 || seglist[1]>12 || seglist[2] < 1 || seglist[2]>31))
-        {
-            e.code = ErrorCode::InvalidDate;
-            e.message = "The date does not follow format 'YYYY-mm-dd'";
-            return e;
-        }
-
-        return Date{ std::chrono::year{seglist[0]} / seglist[1] / seglist[2] };
+        return invalid_iso_date();   // wrong segment count, or e.g. 2026-02-30
     }
 
 
@@ -72,186 +70,239 @@ namespace ir {
 
     Result<Tenor> Tenor::parse(std::string_view s)
     {
-        Error e;
-
-        std::size_t loc_unit;
-        char s_unit;
-        int n_amount;
-        size_t s_size = s.size();
-        Tenor t;
-
-        if (s_size < 2)
-        {
-            e.code = ErrorCode::ParseError;
-            e.message = "Tenor string too short.";
-            return e;
+        if (auto t = try_parse(s)) return *t;
+
+        if (s.size() < 2) return Error::make(ErrorCode::ParseError, "Tenor string too short.");
+
+        // A unit letter after a number, but not a known unit in last place
+        const std::size_t loc_unit = s.find_first_of("dDwWmMyY");
+        const std::size_t digits = (s[0] == '+' || s[0] == '-') ? 1 : 0;
+        bool numeric = loc_unit != std::string_view::npos && loc_unit > digits;
+        for (std::size_t i = digits; numeric && i < loc_unit; ++i) numeric = is_digit(s[i]);
+        if (!numeric) {
+            return Error::make(ErrorCode::ParseError,
+                "Tenor string does not consist of numeric tenor amount and tenor unit (D/W/M/Y)");
         }
+        return Error::make(ErrorCode::ParseError, "Unknown tenor unit (expected D,W,M,Y)");
+    }
 
-        loc_unit = s.find_first_of("dDwWmMyY");
 
-        if (loc_unit == std::string::npos|| loc_unit==0)
-        {
-            e.code = ErrorCode::ParseError;
-            e.message = "Tenor string does not consist of numeric tenor amount and tenor unit (D/W/M/Y)";
-            return e;
+    // Calendar
+    //
+    // Offsets are days from Table::first. bits has one bit per offset (set: business
+    // day), before[w] counts the business days at offsets below 64 * w, and business
+    // lists the business-day offsets in order, so
+    //   rank(o)   = business days at offsets < o = before[o / 64] + popcount(low bits)
+    //   select(k) = first + business[k]
+    struct Calendar::Table {
+        std::string name;
+        std::chrono::sys_days first{};
+        long days{ 0 };
+        std::vector<std::uint64_t> bits;
+        std::vector<std::uint32_t> before;
+        std::vector<std::int32_t> business;
+        std::uint64_t fingerprint{ 0 };   // FNV-1a over first, days and bits
+
+        // Offset of d, or -1 outside [first, first + days)
+        long offset(const Date& d) const {
+            const long o = static_cast<long>((d.raw() - first).count());
+            return (o >= 0 && o < days) ? o : -1;
         }
+        bool test(long o) const { return (bits[o >> 6] >> (o & 63)) & 1u; }
 
-        try{
-            n_amount = std::stoi(static_cast<std::string>(s.substr(0, loc_unit)));
+        // o in [0, days]
+        long rank(long o) const {
+            if (o == days) return static_cast<long>(business.size());
+            const std::uint64_t low = bits[o >> 6] & ((std::uint64_t{ 1 } << (o & 63)) - 1);
+            return static_cast<long>(before[o >> 6]) + std::popcount(low);
         }
-        catch (...) {
-            e.code = ErrorCode::ParseError;
-            e.message = "Tenor string does not consist of numeric tenor amount and tenor unit (D/W/M/Y)";
-            return e;
+        // k in [0, business.size())
+        Date select(long k) const { return Date{ first + std::chrono::days{ business[k] } }; }
+        bool has(long k) const { return k >= 0 && k < static_cast<long>(business.size()); }
+
+        // Table over [first_date, last_date) with the business days given by `open`
+        template <class Open>
+        static std::shared_ptr<const Table> build(std::string name, const Date& first_date, const Date& last_date, Open open) {
+            auto t = std::make_shared<Table>();
+            t->name = std::move(name);
+            t->first = first_date.raw();
+            t->days = std::max<long>(0, static_cast<long>((last_date - first_date).count()));
+            t->bits.assign(static_cast<std::size_t>((t->days + 63) / 64), 0);
+            t->before.assign(t->bits.size(), 0);
+            for (long o = 0; o < t->days; ++o) {
+                if (!open(Date{ t->first + std::chrono::days{ o } })) continue;
+                t->bits[o >> 6] |= std::uint64_t{ 1 } << (o & 63);
+                t->business.push_back(static_cast<std::int32_t>(o));
+            }
+            std::uint32_t n = 0;
+            for (std::size_t w = 0; w < t->bits.size(); ++w) {
+                t->before[w] = n;
+                n += static_cast<std::uint32_t>(std::popcount(t->bits[w]));
+            }
+            std::uint64_t h = 0xcbf29ce484222325ULL;
+            auto mix = [&](std::uint64_t v) { h = (h ^ v) * 0x100000001b3ULL; };
+            mix(static_cast<std::uint64_t>(t->first.time_since_epoch().count()));
+            mix(static_cast<std::uint64_t>(t->days));
+            for (const std::uint64_t w : t->bits) mix(w);
+            t->fingerprint = h;
+            return t;
         }
-        
-        s_unit = s[s_size-1];
+    };
 
-        //Setting Tenor amount
-        t.n = n_amount;
+    Date Calendar::default_first() { return Date::from_ymd(1970, 1, 1); }
+    Date Calendar::default_last() { return Date::from_ymd(2100, 1, 1); }
 
-        //Setting Tenor unit
-        switch (s_unit) {
-        case 'D':
-        case 'd':
-            t.unit = TenorUnit::Days;
-            break;
-        case 'W':
-        case 'w':
-            t.unit = TenorUnit::Weeks;
-            break;
-        case 'M':
-            t.unit = TenorUnit::Months;
-            break;
-        case 'Y':
-        case 'y':
-            t.unit = TenorUnit::Years;
-            break;
-        default:
-            e.code = ErrorCode::ParseError;
-            e.message = "Unknown tenor unit (expected D,W,M,Y)";
-            return e;
-        }
+    const Calendar::Table& Calendar::table() const
+    {
+        static const std::shared_ptr<const Table> weekends = Table::build("WEEKENDS",
+            default_first(), default_last(), [](const Date& d) { return !is_weekend(d); });
+        return table_ ? *table_ : *weekends;
+    }
 
-        return t;
+    Calendar Calendar::from_holidays(std::string name, std::span<const Date> holidays, Date first, Date last)
+    {
+        std::vector<Date> sorted(holidays.begin(), holidays.end());
+        std::sort(sorted.begin(), sorted.end());
+        return Calendar{ Table::build(std::move(name), first, last, [&](const Date& d) {
+            return !is_weekend(d) && !std::binary_search(sorted.begin(), sorted.end(), d);
+        }) };
     }
 
+    Calendar Calendar::join(const Calendar& a, const Calendar& b)
+    {
+        const Table& ta = a.table();
+        const Table& tb = b.table();
+        const Date first{ std::min(ta.first, tb.first) };
+        const Date last{ std::max(ta.first + std::chrono::days{ ta.days }, tb.first + std::chrono::days{ tb.days }) };
+        return Calendar{ Table::build(ta.name + "+" + tb.name, first, last, [&](const Date& d) {
+            return a.is_business_day(d) && b.is_business_day(d);
+        }) };
+    }
+
+    const std::string& Calendar::name() const { return table().name; }
+
+    std::uint64_t Calendar::fingerprint() const { return table().fingerprint; }
 
-    // Calendar implementation (v1: weekends-only)
     bool Calendar::is_business_day(const Date& d) const
     {
-        return !is_weekend(d);
+        const Table& t = table();
+        const long o = t.offset(d);
+        return o >= 0 ? t.test(o) : !is_weekend(d);
     }
 
-    Date Calendar::adjust(const Date& d, BusinessDayConvention bdc) const
+    // First business day on or after d
+    Date Calendar::following(const Date& d) const
     {
-        if (is_business_day(d)) return d;
+        const Table& t = table();
+        const long o = t.offset(d);
+        if (o >= 0 && t.has(t.rank(o))) return t.select(t.rank(o));
 
-        using namespace std::chrono;
+        Date cur = d;
+        while (!is_business_day(cur)) cur = cur + std::chrono::days{ 1 };
+        return cur;
+    }
 
-        if (bdc == BusinessDayConvention::Following || bdc == BusinessDayConvention::ModifiedFollowing) {
-            Date cur = d;
-            while (!is_business_day(cur)) {
-                cur = Date{ cur.raw() + days{1} };
-            }
+    // Last business day on or before d
+    Date Calendar::preceding(const Date& d) const
+    {
+        const Table& t = table();
+        const long o = t.offset(d);
+        if (o >= 0 && t.has(t.rank(o + 1) - 1)) return t.select(t.rank(o + 1) - 1);
+
+        Date cur = d;
+        while (!is_business_day(cur)) cur = cur + std::chrono::days{ -1 };
+        return cur;
+    }
 
-            if (bdc == BusinessDayConvention::ModifiedFollowing) {
-                year_month_day orig{ d.raw() };
-                year_month_day adj{ cur.raw() };
-                if (adj.month() != orig.month()) {
-                    // Fall back to preceding
-                    Date cur2 = d;
-                    while (!is_business_day(cur2)) {
-                        cur2 = Date{ cur2.raw() - days{1} };
-                    }
-                    return cur2;
-                }
+    Date Calendar::adjust(const Date& d, BusinessDayConvention bdc) const
+    {
+        const Table& t = table();
+        const long o = t.offset(d);
+        if (o >= 0 ? t.test(o) : !is_weekend(d)) return d;
+
+        switch (bdc) {
+        case BusinessDayConvention::Following:
+            return following(d);
+        case BusinessDayConvention::ModifiedFollowing: {
+            const Date f = following(d);
+            // Fall back to preceding when following leaves the month
+            if (std::chrono::year_month_day{ f.raw() }.month() != std::chrono::year_month_day{ d.raw() }.month()) {
+                return preceding(d);
             }
-            return cur;
+            return f;
         }
-        else { // Preceding
-            Date cur = d;
-            while (!is_business_day(cur)) {
-                cur = Date{ cur.raw() - std::chrono::days{1} };
-            }
-            return cur;
+        default: // Preceding
+            return preceding(d);
         }
     }
 
-
-    Date Calendar::advance(const Date& d, const Tenor& t, BusinessDayConvention bdc) const
+    Date Calendar::advance_business_days(const Date& d, int n) const
     {
-        using namespace std::chrono;
+        if (n == 0) return following(d);
 
-        sys_days sd = d.raw();
-        sys_days new_sd = sd;
+        const Table& t = table();
+        const long o = t.offset(d);
+        if (o >= 0) {
+            const long k = n > 0 ? t.rank(o + 1) + n - 1 : t.rank(o) + n;
+            if (t.has(k)) return t.select(k);
+        }
 
-        switch (t.unit) {
-        case TenorUnit::Days:
-            new_sd = sd + days{ t.n };
-            break;
-        case TenorUnit::Weeks:
-            new_sd = sd + days{ 7 * t.n };
-            break;
-        case TenorUnit::Months: {
-            year_month_day ymd{ sd };
-            year_month_day new_ymd{ sd };
-            year_month_day_last ymd_lastday{ ymd.year(),std::chrono::month_day_last(ymd.month()) };
-            
-            std::chrono::months delta_m(t.n);
-            new_ymd += delta_m;
-            std::chrono::month new_month{ new_ymd.month() };
-            std::chrono::year new_year{ new_ymd.year() };
-
-            if (ymd == ymd_lastday)
-            {            
-                new_ymd = year_month_day_last{ new_year, std::chrono::month_day_last(new_month) };
-                new_sd = sys_days{ new_ymd };
-                break;
-            }
+        const std::chrono::days step{ n > 0 ? 1 : -1 };
+        Date cur = d;
+        for (int left = n > 0 ? n : -n; left > 0;) {
+            cur = cur + step;
+            if (is_business_day(cur)) --left;
+        }
+        return cur;
+    }
+
+    long Calendar::business_days_between(const Date& from, const Date& to) const
+    {
+        if (to < from) return -business_days_between(to, from);
 
-            // Add days
-            int day=static_cast<unsigned>(new_ymd.day());
+        const Table& t = table();
+        const long of = static_cast<long>((from.raw() - t.first).count());
+        const long ot = static_cast<long>((to.raw() - t.first).count());
+        if (of >= 0 && ot <= t.days) return t.rank(ot) - t.rank(of);
 
-            int new_day = day;
-            //year_month_day new_ymd{ std::chrono::year(new_year), std::chrono::month(new_month), std::chrono::day(new_day) };
-            while (!new_ymd.ok() && new_day > 0) {
-                --new_day;
-                new_ymd = year_month_day{new_year, new_month, std::chrono::day{static_cast<unsigned>(new_day)} };
-            }
-            new_sd = sys_days{ new_ymd };
-            break;
+        long n = 0;
+        for (Date cur = from; cur < to; cur = cur + std::chrono::days{ 1 }) {
+            if (is_business_day(cur)) ++n;
         }
-        case TenorUnit::Years: {
-            year_month_day ymd{ sd };
-            year_month_day new_ymd{ sd };
-            year_month_day_last ymd_lastday{ ymd.year(),std::chrono::month_day_last(ymd.month()) };
-            std::chrono::years delta_y(t.n);
-            new_ymd += delta_y;
-            int day = static_cast<unsigned>(new_ymd.day());
-            // std::chrono::day d{ new_ymd.day() };
-            std::chrono::month new_month{ new_ymd.month() };
-            std::chrono::year new_year{ new_ymd.year() };
-
-            if (ymd == ymd_lastday)
-            {
-                new_ymd = year_month_day_last{ new_year, std::chrono::month_day_last(new_month) };
-                new_sd = sys_days{ new_ymd };
-                break;
-            }
+        return n;
+    }
 
-            int new_day = day;
-            while (!new_ymd.ok() && new_day > 0) {
-                --new_day;
-                new_ymd = year_month_day{ new_year, new_month, std::chrono::day{static_cast<unsigned>(new_day)} };
-            }
-            new_sd = sys_days{ new_ymd };
+
+    static bool is_month_end(const std::chrono::year_month_day& ymd)
+    {
+        return ymd.day() == std::chrono::year_month_day_last{ ymd.year(), std::chrono::month_day_last{ ymd.month() } }.day();
+    }
+
+    // d + t before adjustment (ymd and month_end describe d). Month and year steps keep
+    // the day of month, clamped to the length of the target month; from a month end
+    // they land on the month end.
+    static std::chrono::sys_days unadjusted_advance(std::chrono::sys_days d,
+        const std::chrono::year_month_day& ymd, bool month_end, const Tenor& t)
+    {
+        using namespace std::chrono;
+
+        switch (t.unit) {
+        case TenorUnit::Days:
+            return d + days{ t.n };
+        case TenorUnit::Weeks:
+            return d + days{ 7 * t.n };
+        default:
             break;
         }
-        } // switch
+        const year_month ym = year_month{ ymd.year(), ymd.month() } + months{ t.unit == TenorUnit::Years ? 12 * t.n : t.n };
+        const day last = year_month_day_last{ ym.year(), month_day_last{ ym.month() } }.day();
+        return sys_days{ ym / (month_end || ymd.day() > last ? last : ymd.day()) };
+    }
 
-        Date advanced{ new_sd };
-        return adjust(advanced, bdc);
+    Date Calendar::advance(const Date& d, const Tenor& t, BusinessDayConvention bdc) const
+    {
+        const std::chrono::year_month_day ymd{ d.raw() };
+        return adjust(Date{ unadjusted_advance(d.raw(), ymd, is_month_end(ymd), t) }, bdc);
     }
 
     bool Calendar::is_weekend(const Date& d)
@@ -309,7 +360,7 @@ namespace ir {
         Schedule sched;
         if (cfg.start.raw() > cfg.end.raw()) return sched;
 
-        Calendar cal = cfg.calendar; // copy
+        const Calendar& cal = cfg.calendar;
         Tenor t = cfg.tenor;
         if (t.n == 0) {
             // degenerate: only start and end
@@ -322,14 +373,25 @@ namespace ir {
         // Safety guard to avoid infinite loops
         const int MAX_STEPS = 1024;
 
+        // Dates are anchor + i * tenor, so the anchor is decoded once
+        const Date& anchor = cfg.rule == DateGenerationRule::Backward ? cfg.end : cfg.start;
+        const std::chrono::year_month_day anchor_ymd{ anchor.raw() };
+        const bool anchor_month_end = is_month_end(anchor_ymd);
+        auto step = [&](int n) {
+            return cal.adjust(Date{ unadjusted_advance(anchor.raw(), anchor_ymd, anchor_month_end, Tenor{ n, t.unit }) }, cfg.bdc);
+        };
+        const double tenor_days = t.unit == TenorUnit::Days ? 1.0 : t.unit == TenorUnit::Weeks ? 7.0
+            : t.unit == TenorUnit::Months ? 30.4 : 365.25;
+        const std::size_t expected = static_cast<std::size_t>(std::min<double>(MAX_STEPS,
+            (cfg.end - cfg.start).count() / (tenor_days * std::abs(t.n)))) + 2;
+
         if (cfg.rule == DateGenerationRule::Backward) {
             // generate backward from end
             std::vector<Date> tmp;
-            Tenor neg = t;
+            tmp.reserve(expected);
             tmp.push_back(cal.adjust(cfg.end, cfg.bdc));
             for (int i = 1; i < MAX_STEPS; ++i) {
-                neg.n = -t.n*i;
-                Date next = cal.advance(cfg.end, neg, cfg.bdc);
+                Date next = step(-t.n * i);
                 if (next.raw() < cfg.start.raw()) break;
                 tmp.push_back(next);
                 if (next.raw() == cfg.start.raw()) break;
@@ -346,11 +408,10 @@ namespace ir {
         else {
             // Forward generation
             std::vector<Date> tmp;
-            Tenor pos = t;
+            tmp.reserve(expected);
             tmp.push_back(cal.adjust(cfg.start, cfg.bdc));
             for (int i = 1; i < MAX_STEPS; ++i) {
-                pos.n = i * t.n;
-                Date next = cal.advance(cfg.start, pos, cfg.bdc);
+                Date next = step(i * t.n);
                 if (next.raw() > cfg.end.raw()) break;
                 tmp.push_back(next);
                 if (next.raw() == cfg.end.raw()) break;
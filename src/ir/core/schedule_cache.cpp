@@ -0,0 +1,80 @@
+#include "ir/core/schedule_cache.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ir {
+
+    std::size_t ScheduleCache::KeyHash::operator()(const Key& k) const {
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+        auto mix = [&](std::uint64_t v) { h = (h ^ v) * 0x100000001b3ULL; };
+        mix(static_cast<std::uint32_t>(k.start));
+        mix(static_cast<std::uint32_t>(k.end));
+        mix(static_cast<std::uint32_t>(k.tenor_n));
+        mix(static_cast<std::uint64_t>(k.tenor_unit) | static_cast<std::uint64_t>(k.bdc) << 8
+            | static_cast<std::uint64_t>(k.rule) << 16 | static_cast<std::uint64_t>(k.end_of_month) << 24);
+        mix(k.calendar);
+        return static_cast<std::size_t>(h);
+    }
+
+    ScheduleCache::ScheduleCache(std::size_t max_entries)
+        : max_entries_(std::max<std::size_t>(1, max_entries)) {}
+
+    std::shared_ptr<const Schedule> ScheduleCache::get(const ScheduleConfig& cfg) {
+        Key key{ static_cast<std::int32_t>(cfg.start.raw().time_since_epoch().count()),
+            static_cast<std::int32_t>(cfg.end.raw().time_since_epoch().count()),
+            cfg.tenor.n, cfg.tenor.unit, cfg.bdc, cfg.rule, cfg.end_of_month, cfg.calendar.fingerprint() };
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second->second;
+            }
+        }
+
+        // Generated outside the lock; if another thread got there first, its copy wins
+        auto sched = std::make_shared<const Schedule>(make_schedule(cfg));
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(m_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->second;
+        }
+        lru_.emplace_front(key, std::move(sched));
+        index_.emplace(std::move(key), lru_.begin());
+        if (lru_.size() > max_entries_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return lru_.front().second;
+    }
+
+    ScheduleCache::Stats ScheduleCache::stats() const {
+        Stats s;
+        s.hits = hits_.load(std::memory_order_relaxed);
+        s.misses = misses_.load(std::memory_order_relaxed);
+        s.evictions = evictions_.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(m_);
+        s.entries = lru_.size();
+        return s;
+    }
+
+    void ScheduleCache::clear() {
+        std::lock_guard<std::mutex> lock(m_);
+        index_.clear();
+        lru_.clear();
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+        evictions_.store(0, std::memory_order_relaxed);
+    }
+
+    ScheduleCache& ScheduleCache::global() {
+        static ScheduleCache cache;
+        return cache;
+    }
+
+} // namespace ir
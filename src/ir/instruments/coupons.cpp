@@ -1,6 +1,7 @@
 #include "ir/instruments/coupons.hpp"
 
 #include <chrono>
+#include <cmath>
 #include <optional>
 
 #include "ir/core/date.hpp"
@@ -8,6 +9,28 @@
 
 namespace ir::instruments {
 
+    std::optional<double> realised_rfr_compound(const RfrObservation& obs,
+        const ir::market::FixingStore& fixings,
+        const ir::Date& until) {
+        double compound = 1.0;
+        if (!(obs.start < until)) return compound;
+
+        // One contiguous read of the fixing history
+        const auto n_days = static_cast<std::size_t>((until - obs.start).count());
+        const auto hist = fixings.get_range(fixings.handle(obs.index), obs.start, until);
+        if (hist.size() != n_days) return std::nullopt;
+
+        ir::Date d = obs.start;
+        for (std::size_t k = 0; k < n_days; ++k) {
+            const ir::Date d_next = d + std::chrono::days{ 1 };
+            const double dt = ir::year_fraction(d, d_next, obs.accrual_dc);
+            if (dt < 0.0 || std::isnan(hist[k])) return std::nullopt;
+            compound *= (1.0 + hist[k] * dt);
+            d = d_next;
+        }
+        return compound;
+    }
+
     // ===================== FixedCoupon =====================
 
     FixedCoupon::FixedCoupon(ir::Date pay_date, double amount)
@@ -69,27 +92,15 @@ namespace ir::instruments {
         double compound = 1.0;
 
         // Realized part: [start, cutoff_eff)
-        for (ir::Date d = start; d < cutoff_eff; d = d + std::chrono::days{ 1 }) {
-            ir::Date d_next = d + std::chrono::days{ 1 };
-            if (cutoff_eff < d_next) {
-                d_next = cutoff_eff;
-            }
-
-            const double dt = ir::year_fraction(d, d_next, obs_.accrual_dc);
-            if (dt < 0.0) {
-                return std::nullopt;
-            }
-
+        if (start < cutoff_eff) {
             if (!fixings) {
                 return std::nullopt;
             }
-
-            auto fx = fixings->get(obs_.index, d);
-            if (!fx.has_value()) {
+            const auto realised = realised_rfr_compound(obs_, *fixings, cutoff_eff);
+            if (!realised.has_value()) {
                 return std::nullopt;
             }
-
-            compound *= (1.0 + fx.value() * dt);
+            compound = realised.value();
         }
 
         // Projected part: [max(start, cutoff_eff), end]
@@ -0,0 +1,58 @@
+#include "ir/io/calendar_io.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ir/core/error.hpp"
+#include "ir/io/csv_io.hpp"
+
+namespace ir::io {
+
+    static std::string_view trim(std::string_view s) {
+        const auto b = s.find_first_not_of(" \t\r\f\v");
+        if (b == std::string_view::npos) return {};
+        return s.substr(b, s.find_last_not_of(" \t\r\f\v") - b + 1);
+    }
+
+    // A column title such as "Date": no digits or dashes, so never a mistyped date
+    static bool is_header_cell(std::string_view cell) {
+        return std::none_of(cell.begin(), cell.end(),
+            [](char c) { return c == '-' || (c >= '0' && c <= '9'); });
+    }
+
+    ir::Result<ir::Calendar> parse_holiday_calendar(std::string_view text, std::string name,
+        ir::Date first, ir::Date last) {
+        std::vector<ir::Date> holidays;
+        std::size_t line_no = 0;
+        bool first_row = true;
+        for (std::size_t pos = 0; pos < text.size();) {
+            const std::size_t nl = std::min(text.find('\n', pos), text.size());
+            const std::string_view line = trim(text.substr(pos, nl - pos));
+            pos = nl + 1;
+            ++line_no;
+            if (line.empty() || line.front() == '#') continue;
+
+            const std::string_view cell = trim(line.substr(0, line.find(',')));
+            auto d = ir::Date::parse_iso(cell);
+            const bool may_be_header = first_row;
+            first_row = false;
+            if (!d.has_value()) {
+                if (may_be_header && is_header_cell(cell)) continue;
+                return ir::Error::make(ir::ErrorCode::ParseError, "Holiday calendar " + name + ": line "
+                    + std::to_string(line_no) + ": '" + std::string(cell) + "' is not a date.");
+            }
+            holidays.push_back(d.value());
+        }
+        return ir::Calendar::from_holidays(std::move(name), holidays, first, last);
+    }
+
+    ir::Result<ir::Calendar> load_holiday_calendar(const std::string& file_path, std::string name,
+        ir::Date first, ir::Date last) {
+        auto file = MappedFile::open(file_path);
+        if (!file.has_value()) return file.error();
+        return parse_holiday_calendar(file.value().text(), std::move(name), first, last);
+    }
+
+} // namespace ir::io
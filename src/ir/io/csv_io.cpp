@@ -1,8 +1,23 @@
 #include "ir/io/csv_io.hpp"
 
-#include <fstream>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "ir/core/error.hpp"
 
@@ -66,14 +81,211 @@ namespace ir::io {
     }
 
     ir::Result<CsvTable> read_csv_file(const std::string& file_path, const CsvOptions& opt) {
-        std::ifstream in(file_path);
-        if (!in) {
-            return ir::Error::make(ir::ErrorCode::InvalidArgument,
-                "CSV: cannot open file: " + file_path);
+        auto file = MappedFile::open(file_path);
+        if (!file.has_value()) return file.error();
+        return read_csv_text(file.value().text(), opt);
+    }
+
+    // -------------------- MappedFile --------------------
+
+    ir::Result<MappedFile> MappedFile::open(const std::string& file_path) {
+        auto fail = [&] {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "CSV: cannot open file: " + file_path);
+        };
+        MappedFile f;
+#ifdef _WIN32
+        HANDLE h = ::CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return fail();
+        f.file_ = h;
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(h, &size)) return fail();
+        if (size.QuadPart == 0) return f;
+        f.mapping_ = ::CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!f.mapping_) return fail();
+        const void* p = ::MapViewOfFile(f.mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (!p) return fail();
+        f.data_ = static_cast<const char*>(p);
+        f.size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        const int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd < 0) return fail();
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            ::close(fd);
+            return fail();
+        }
+        if (st.st_size > 0) {
+            void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                return fail();
+            }
+            ::madvise(p, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+            f.data_ = static_cast<const char*>(p);
+            f.size_ = static_cast<std::size_t>(st.st_size);
+        }
+        ::close(fd);   // the mapping stays valid
+#endif
+        return f;
+    }
+
+    MappedFile::MappedFile(MappedFile&& o) noexcept { *this = std::move(o); }
+
+    MappedFile& MappedFile::operator=(MappedFile&& o) noexcept {
+        if (this != &o) {
+            close();
+            data_ = std::exchange(o.data_, nullptr);
+            size_ = std::exchange(o.size_, 0);
+#ifdef _WIN32
+            file_ = std::exchange(o.file_, nullptr);
+            mapping_ = std::exchange(o.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() { close(); }
+
+    void MappedFile::close() {
+#ifdef _WIN32
+        if (data_) ::UnmapViewOfFile(data_);
+        if (mapping_) ::CloseHandle(mapping_);
+        if (file_) ::CloseHandle(file_);
+        file_ = nullptr;
+        mapping_ = nullptr;
+#else
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    // -------------------- Columnar reader --------------------
+
+    static bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v'; }
+
+    static std::string_view trim_view(const char* b, const char* e) {
+        while (b < e && is_blank(*b)) ++b;
+        while (e > b && is_blank(e[-1])) --e;
+        return { b, static_cast<std::size_t>(e - b) };
+    }
+
+    static const char* find_char(const char* b, const char* e, char c) {
+        const void* p = std::memchr(b, c, static_cast<std::size_t>(e - b));
+        return p ? static_cast<const char*>(p) : e;
+    }
+
+    ir::Result<std::size_t> CsvColumns::index(std::string_view header) const {
+        for (std::size_t c = 0; c < headers.size(); ++c) {
+            if (headers[c] == header) return c;
+        }
+        return ir::Error::make(ir::ErrorCode::ParseError,
+            "CSV: missing column: " + std::string(header));
+    }
+
+    ir::Result<const std::vector<std::string_view>*> CsvColumns::column(std::string_view header) const {
+        auto c = index(header);
+        if (!c.has_value()) return c.error();
+        return &columns[c.value()];
+    }
+
+    std::string CsvColumns::describe(std::size_t col, std::size_t row) const {
+        const std::string_view cell = columns[col][row];
+        std::string out = "'";
+        out.append(cell).append("' (").append(headers[col]);
+        if (cell.data() >= text.data() && cell.data() <= text.data() + text.size()) {
+            const std::string_view before = text.substr(0, static_cast<std::size_t>(cell.data() - text.data()));
+            const std::size_t line = static_cast<std::size_t>(std::count(before.begin(), before.end(), '\n')) + 1;
+            const std::size_t bol = before.rfind('\n');
+            const std::size_t column = before.size() - (bol == std::string_view::npos ? 0 : bol + 1) + 1;
+            out += ", line " + std::to_string(line) + ", column " + std::to_string(column);
+        }
+        return out + ")";
+    }
+
+    ir::Result<double> parse_double(std::string_view s) {
+        if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+        double v = 0.0;
+        const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), v);
+        if (s.empty() || ec != std::errc{} || ptr != s.data() + s.size()) {
+            return ir::Error::make(ir::ErrorCode::ParseError, "Failed to parse double: " + std::string(s));
+        }
+        return v;
+    }
+
+    ir::Result<CsvColumns> read_csv_columns_text(std::string_view text, const CsvOptions& opt) {
+        CsvColumns table;
+        table.text = text;
+        const char* p = text.data();
+        const char* const end = p + text.size();
+        std::size_t line_no = 0;
+        bool header_done = false;
+
+        while (p < end) {
+            const char* eol = find_char(p, end, '\n');
+            const char* line_end = (eol > p && eol[-1] == '\r') ? eol - 1 : eol;
+            const char* line = p;
+            p = (eol == end) ? end : eol + 1;   // last line may have no newline
+            ++line_no;
+
+            if (opt.allow_empty_lines && trim_view(line, line_end).empty()) continue;
+
+            if (!header_done) {
+                for (const char* s = line;;) {
+                    const char* sep = find_char(s, line_end, opt.sep);
+                    table.headers.emplace_back(opt.trim ? trim_view(s, sep) : std::string_view(s, sep - s));
+                    if (sep == line_end) break;
+                    s = sep + 1;
+                }
+                // Reserve from the first data line's length instead of scanning the
+                // whole text for newlines; vectors still grow if lines get shorter.
+                table.columns.resize(table.headers.size());
+                if (p < end) {
+                    const std::size_t sample = static_cast<std::size_t>(find_char(p, end, '\n') - p) + 1;
+                    const std::size_t estimate = static_cast<std::size_t>(end - p) / sample + 1;
+                    for (auto& col : table.columns) col.reserve(estimate);
+                }
+                header_done = true;
+                continue;
+            }
+
+            const std::size_t ncols = table.columns.size();
+            std::size_t c = 0;
+            for (const char* s = line;;) {
+                const char* sep = find_char(s, line_end, opt.sep);
+                if (c == ncols) {   // more cells than headers
+                    ++c;
+                    break;
+                }
+                table.columns[c++].push_back(opt.trim ? trim_view(s, sep) : std::string_view(s, sep - s));
+                if (sep == line_end) break;
+                s = sep + 1;
+            }
+            if (c != ncols) {
+                return ir::Error::make(ir::ErrorCode::ParseError,
+                    "CSV: column count mismatch at line " + std::to_string(line_no) + ".");
+            }
+        }
+
+        if (!header_done) {
+            return ir::Error::make(ir::ErrorCode::ParseError, "CSV: missing header.");
         }
-        std::ostringstream buffer;
-        buffer << in.rdbuf();
-        return read_csv_text(buffer.str(), opt);
+
+        return table;
+    }
+
+    ir::Result<CsvColumns> read_csv_columns_file(const std::string& file_path, const CsvOptions& opt) {
+        auto file = MappedFile::open(file_path);
+        if (!file.has_value()) return file.error();
+
+        auto source = std::make_shared<const MappedFile>(std::move(file.value()));
+        auto table = read_csv_columns_text(source->text(), opt);
+        if (!table.has_value()) {
+            return ir::Error::make(table.error().code, table.error().message + " (" + file_path + ")");
+        }
+        table.value().source = std::move(source);
+        return table;
     }
 
 } // namespace ir::io
\ No newline at end of file
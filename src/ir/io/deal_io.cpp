@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <algorithm>
 
 #include "ir/core/error.hpp"
@@ -9,94 +10,118 @@
 
 namespace ir::io {
 
-    static ir::Result<ir::Date> parse_date(const std::string& s) {
-        auto d = ir::Date::parse_iso(s);
-        if (!d.has_value()) return d.error();
-        return d.value();
-    }
-
-    static ir::Result<double> parse_double(const std::string& s) {
-        try {
-            if (s.empty()) return 0.0;
-            return std::stod(s);
-        }
-        catch (...) {
-            return ir::Error::make(ir::ErrorCode::ParseError, "Failed to parse double: " + s);
-        }
-    }
-
-    static ir::Result<LegType> parse_leg_type(const std::string& s) {
+    static ir::Result<LegType> parse_leg_type(std::string_view s) {
         if (s == "FIXED") return LegType::Fixed;
         if (s == "IBOR")  return LegType::Ibor;
         if (s == "RFR")   return LegType::Rfr;
-        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown LegType: " + s);
+        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown LegType: " + std::string(s));
     }
 
-    static ir::Result<PayReceive> parse_dir(const std::string& s) {
+    static ir::Result<PayReceive> parse_dir(std::string_view s) {
         if (s == "-1") return PayReceive::Pay;
         if (s == "1") return PayReceive::Receive;
-        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown PayReceive: " + s);
+        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown PayReceive: " + std::string(s));
     }
 
-    static ir::Result<ir::DayCount> parse_dc(const std::string& s) {
+    static ir::Result<ir::DayCount> parse_dc(std::string_view s) {
         if (s == "ACT360") return ir::DayCount::ACT360;
         if (s == "ACT365") return ir::DayCount::ACT365;
         if (s == "THIRTY360") return ir::DayCount::THIRTY360;
         if (s=="") return ir::DayCount::ACT365;
-        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown Day_Convention: " + s);
+        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown Day_Convention: " + std::string(s));
     }
 
-    static ir::Result<ir::BusinessDayConvention> parse_bdc(const std::string& s) {
+    static ir::Result<ir::BusinessDayConvention> parse_bdc(std::string_view s) {
         if (s == "Following") return ir::BusinessDayConvention::Following;
         if (s == "ModifiedFollowing") return ir::BusinessDayConvention::ModifiedFollowing;
         if (s == "Preceding") return ir::BusinessDayConvention::Preceding;
         if (s=="") return ir::BusinessDayConvention::ModifiedFollowing;
-        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown Day_Convention: " + s);
+        return ir::Error::make(ir::ErrorCode::ParseError, "Unknown Day_Convention: " + std::string(s));
     }
 
+    // Deal file columns, in the order of DealCol.
+    static constexpr const char* kDealColumns[] = {
+        "Leg_ID", "LegType", "PayReceive", "Notional", "FixedRate", "Spread", "IndexId",
+        "DiscountCurveID", "FwdCurveID", "FixingsID", "COB", "Start_Date", "End_Date",
+        "Frequency", "DayCountConvention", "BusDayConvention"
+    };
+
+    namespace {
+        enum DealCol : std::size_t {
+            kLegId, kLegType, kPayReceive, kNotional, kFixedRate, kSpread, kIndexId,
+            kDiscountCurveId, kFwdCurveId, kFixingsId, kCob, kStartDate, kEndDate,
+            kFrequency, kDayCount, kBusDayConvention, kNumDealCols
+        };
+    } // namespace
+
     ir::Result<DealSpec> read_deal_data_csv(const std::string& path) {
-        auto t = ir::io::read_csv_file(path);
+        auto t = ir::io::read_csv_columns_file(path);
         if (!t.has_value()) return t.error();
+        const CsvColumns& tab = t.value();
+
+        std::size_t idx[kNumDealCols];
+        for (std::size_t c = 0; c < kNumDealCols; ++c) {
+            auto i = tab.index(kDealColumns[c]);
+            if (!i.has_value()) return i.error();
+            idx[c] = i.value();
+        }
 
         DealSpec deal;
 
-        for (const auto& r : t.value().rows) {
+        for (std::size_t row = 0; row < tab.rows(); ++row) {
+            auto cell = [&](DealCol c) { return tab.columns[idx[c]][row]; };
+            // Prefix errors with the offending cell, its header, line and column
+            auto fail = [&](DealCol c, const ir::Error& e) {
+                return ir::Error::make(e.code, e.message + " at " + tab.describe(idx[c], row));
+            };
+            auto num = [&](DealCol c) -> ir::Result<double> {
+                if (cell(c).empty()) return 0.0;
+                auto v = parse_double(cell(c));
+                if (!v.has_value()) return fail(c, v.error());
+                return v;
+            };
+            auto date = [&](DealCol c) -> ir::Result<ir::Date> {
+                auto d = ir::Date::parse_iso(cell(c));
+                if (!d.has_value()) return fail(c, d.error());
+                return d;
+            };
+
             LegSpec s;
 
-            s.leg_id = r.at("Leg_ID");
+            s.leg_id = std::string(cell(kLegId));
 
-            auto lt = parse_leg_type(r.at("LegType"));
-            if (!lt.has_value()) return lt.error();
+            auto lt = parse_leg_type(cell(kLegType));
+            if (!lt.has_value()) return fail(kLegType, lt.error());
             s.type = lt.value();
 
-            auto dr = parse_dir(r.at("PayReceive"));
-            if (!dr.has_value()) return dr.error();
+            auto dr = parse_dir(cell(kPayReceive));
+            if (!dr.has_value()) return fail(kPayReceive, dr.error());
             s.dir = dr.value();
 
-            auto n = parse_double(r.at("Notional")); if (!n.has_value()) return n.error(); s.notional = n.value();
-            auto fr = parse_double(r.at("FixedRate")); if (!fr.has_value()) return fr.error(); s.fixed_rate = fr.value();
-            auto sp = parse_double(r.at("Spread")); if (!sp.has_value()) return sp.error(); s.spread = sp.value();
+            auto n = num(kNotional); if (!n.has_value()) return n.error(); s.notional = n.value();
+            auto fr = num(kFixedRate); if (!fr.has_value()) return fr.error(); s.fixed_rate = fr.value();
+            auto sp = num(kSpread); if (!sp.has_value()) return sp.error(); s.spread = sp.value();
 
-            s.index = ir::IndexId{ r.at("IndexId") };
-            s.discount_curve = ir::CurveId{ r.at("DiscountCurveID") };
-            s.fwd_curve = ir::CurveId{ r.at("FwdCurveID") };
-            s.fixings_id = r.at("FixingsID");
+            s.index = ir::IndexId{ std::string(cell(kIndexId)) };
+            s.discount_curve = ir::CurveId{ std::string(cell(kDiscountCurveId)) };
+            s.fwd_curve = ir::CurveId{ std::string(cell(kFwdCurveId)) };
+            s.fixings_id = std::string(cell(kFixingsId));
 
-            auto cob = parse_date(r.at("COB")); if (!cob.has_value()) return cob.error(); s.cob = cob.value();
-            auto st = parse_date(r.at("Start_Date")); if (!st.has_value()) return st.error(); s.start = st.value();
-            auto en = parse_date(r.at("End_Date")); if (!en.has_value()) return en.error(); s.end = en.value();
+            auto cob = date(kCob); if (!cob.has_value()) return cob.error(); s.cob = cob.value();
+            auto st = date(kStartDate); if (!st.has_value()) return st.error(); s.start = st.value();
+            auto en = date(kEndDate); if (!en.has_value()) return en.error(); s.end = en.value();
 
-            s.frequency = r.at("Frequency");
+            s.frequency = std::string(cell(kFrequency));
             if (s.frequency.empty()) {
-                return ir::Error::make(ir::ErrorCode::ParseError, "Frequency is mandatory.");
+                return fail(kFrequency, ir::Error::make(ir::ErrorCode::ParseError, "Frequency is mandatory."));
             }
 
-            auto dc = parse_dc(r.at("DayCountConvention"));
-            if (!dc.has_value()) return dc.error();
+            auto dc = parse_dc(cell(kDayCount));
+            if (!dc.has_value()) return fail(kDayCount, dc.error());
             s.dc = dc.value();
 
-            auto bdc = parse_bdc(r.at("BusDayConvention"));
-            if (!bdc.has_value()) return bdc.error();
+            auto bdc = parse_bdc(cell(kBusDayConvention));
+            if (!bdc.has_value()) return fail(kBusDayConvention, bdc.error());
             s.bdc = bdc.value();
 
             // Basic validation
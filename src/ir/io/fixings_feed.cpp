@@ -0,0 +1,210 @@
+#include "ir/io/fixings_feed.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "ir/core/error.hpp"
+#include "ir/io/csv_io.hpp"
+#include "ir/io/market_cache.hpp"
+#include "ir/io/market_io.hpp"
+
+namespace ir::io {
+
+    namespace {
+
+        constexpr std::uint64_t kTailWindow = 4096;
+        constexpr const char* kSidecarVersion = "1";
+
+        // Reads [offset, offset + n) of the file into out; false on a short read.
+        bool read_range(std::ifstream& f, std::uint64_t offset, std::uint64_t n, std::string& out) {
+            out.resize(static_cast<std::size_t>(n));
+            f.clear();
+            f.seekg(static_cast<std::streamoff>(offset));
+            f.read(out.data(), static_cast<std::streamsize>(n));
+            return static_cast<std::uint64_t>(f.gcount()) == n;
+        }
+
+        bool parse_u64(std::string_view s, std::uint64_t& out) {
+            const auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+            return ec == std::errc{} && p == s.data() + s.size();
+        }
+
+        std::string_view window_of(std::string_view text) {
+            return text.substr(text.size() - std::min<std::size_t>(text.size(), kTailWindow));
+        }
+
+    } // namespace
+
+    ir::Result<FeedRefresh> FixingsFeed::refresh(const std::string& path, const ir::IndexId& index) {
+        auto it = files_.find(path);
+        if (it == files_.end()) {
+            FileState st;
+            const bool resumed = resume_from_sidecar(path, index, st);
+            it = files_.emplace(path, std::move(st)).first;
+            if (!resumed) return full_load(path, index, it->second);
+        }
+        FileState& st = it->second;
+        if (st.index != index.value || st.consumed == 0) return full_load(path, index, st);
+
+        std::error_code ec;
+        const std::uint64_t size = std::filesystem::file_size(path, ec);
+        if (ec) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "Failed to open file: " + path);
+        }
+        if (size < st.consumed) return full_load(path, index, st);   // truncated
+
+        // The consumed prefix must be unchanged: same header, same bytes before the offset
+        std::ifstream f(path, std::ios::binary);
+        std::string head, window;
+        const std::uint64_t w = std::min(st.consumed, kTailWindow);
+        if (!f || !read_range(f, 0, st.header.size(), head) || !read_range(f, st.consumed - w, w, window)
+            || fnv1a_64(head) != st.header_hash || fnv1a_64(window) != st.tail_hash) {
+            return full_load(path, index, st);
+        }
+
+        FeedRefresh out;
+        out.bytes_read = head.size() + window.size();
+        if (size == st.consumed) return out;
+
+        std::string tail;
+        if (!read_range(f, st.consumed, size - st.consumed, tail)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "Failed to read file: " + path);
+        }
+        out.bytes_read += tail.size();
+        const auto last_nl = tail.rfind('\n');
+        if (last_nl == std::string::npos) return out;   // only a partial row so far
+        tail.resize(last_nl + 1);
+
+        // Re-attach the header so the appended rows parse exactly like the full file
+        const std::string text = st.header + "\n" + tail;
+        auto tab = read_csv_columns_text(text);
+        if (!tab.has_value()) {
+            return ir::Error::make(tab.error().code, path + " (appended rows): " + tab.error().message);
+        }
+        auto rows = fixings_from_csv(tab.value());
+        if (!rows.has_value()) {
+            return ir::Error::make(rows.error().code, path + " (appended rows): " + rows.error().message);
+        }
+
+        for (const auto& [d, rate] : rows.value()) {
+            store_.add(index, d, rate);
+            if (st.rows == 0 || st.last_date.raw() <= d.raw()) {
+                st.last_date = d;
+                st.last_rate = rate;
+            }
+            ++st.rows;
+        }
+        st.consumed += tail.size();
+        st.tail_hash = fnv1a_64(window_of(window + tail));
+        if (write_sidecar_) save_sidecar(path, st);
+
+        out.rows = rows.value().size();
+        return out;
+    }
+
+    ir::Result<FeedRefresh> FixingsFeed::full_load(const std::string& path, const ir::IndexId& index, FileState& st) {
+        auto file = MappedFile::open(path);
+        if (!file.has_value()) return file.error();
+        const std::string_view text = file.value().text();
+
+        st = FileState{};
+        st.index = index.value;
+
+        FeedRefresh out;
+        out.full_reload = true;
+        out.bytes_read = text.size();
+
+        const auto last_nl = text.rfind('\n');
+        if (last_nl == std::string_view::npos) return out;   // not even a complete header yet
+        const std::string_view body = text.substr(0, last_nl + 1);
+
+        auto tab = read_csv_columns_text(body);
+        if (!tab.has_value()) return ir::Error::make(tab.error().code, path + ": " + tab.error().message);
+        auto rows = fixings_from_csv(tab.value());
+        if (!rows.has_value()) return ir::Error::make(rows.error().code, path + ": " + rows.error().message);
+
+        for (const auto& [d, rate] : rows.value()) {
+            store_.add(index, d, rate);
+            if (st.rows == 0 || st.last_date.raw() <= d.raw()) {
+                st.last_date = d;
+                st.last_rate = rate;
+            }
+            ++st.rows;
+        }
+        st.header.assign(body.substr(0, body.find('\n')));
+        st.consumed = body.size();
+        st.header_hash = fnv1a_64(st.header);
+        st.tail_hash = fnv1a_64(window_of(body));
+        if (write_sidecar_) save_sidecar(path, st);
+
+        out.rows = st.rows;
+        return out;
+    }
+
+    bool FixingsFeed::resume_from_sidecar(const std::string& path, const ir::IndexId& index, FileState& st) const {
+        std::error_code ec;
+        if (!std::filesystem::exists(sidecar_path(path), ec)) return false;
+        auto tab = read_csv_columns_file(sidecar_path(path));
+        if (!tab.has_value() || tab.value().rows() != 1) return false;
+
+        auto cell = [&](const char* header) -> std::string_view {
+            auto c = tab.value().index(header);
+            return c.has_value() ? tab.value().columns[c.value()][0] : std::string_view{};
+        };
+        FileState s;
+        s.index = std::string(cell("Index"));
+        auto last_date = ir::Date::parse_iso(cell("LastDate"));
+        auto last_rate = parse_double(cell("LastRate"));
+        std::uint64_t rows = 0;
+        if (cell("Version") != kSidecarVersion || s.index != index.value
+            || !parse_u64(cell("Consumed"), s.consumed) || !parse_u64(cell("HeaderHash"), s.header_hash)
+            || !parse_u64(cell("TailHash"), s.tail_hash) || !parse_u64(cell("Rows"), rows)
+            || !last_date.has_value() || !last_rate.has_value() || rows == 0) {
+            return false;
+        }
+        s.rows = static_cast<std::size_t>(rows);
+        s.last_date = last_date.value();
+        s.last_rate = last_rate.value();
+
+        // Only resume if the store already holds the history up to the sidecar's newest fixing
+        const auto h = store_.handle(index);
+        const auto hist = store_.history(h);
+        if (hist.empty()) return false;
+        const ir::Date last = store_.first_date(h) + std::chrono::days{ static_cast<long long>(hist.size() - 1) };
+        if (!(last == s.last_date) || hist.back() != s.last_rate) return false;
+
+        // The header is re-read from the file; refresh() checks it against header_hash
+        std::ifstream f(path, std::ios::binary);
+        if (!f || !std::getline(f, s.header)) return false;
+
+        st = std::move(s);
+        return true;
+    }
+
+    void FixingsFeed::save_sidecar(const std::string& path, const FileState& st) const {
+        // Write-then-rename so a reader never sees a half-written sidecar
+        const std::string side = sidecar_path(path);
+        const std::string tmp = side + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            if (!out) return;   // the sidecar is an optimisation; loading still succeeded
+            char rate[32];
+            std::snprintf(rate, sizeof(rate), "%.17g", st.last_rate);
+            out << "Version,Index,Consumed,HeaderHash,TailHash,Rows,LastDate,LastRate\n"
+                << kSidecarVersion << "," << st.index << "," << st.consumed << ","
+                << st.header_hash << "," << st.tail_hash << "," << st.rows << ","
+                << st.last_date.to_iso() << "," << rate << "\n";
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmp, side, ec);
+    }
+
+} // namespace ir::io
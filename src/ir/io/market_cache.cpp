@@ -0,0 +1,180 @@
+#include "ir/io/market_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+
+#include "ir/core/error.hpp"
+#include "ir/io/csv_io.hpp"
+#include "ir/io/market_io.hpp"
+
+namespace ir::io {
+
+    std::uint64_t fnv1a_64(std::string_view bytes) {
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+        for (unsigned char c : bytes) {
+            h ^= c;
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    // One cache entry, filled exactly once by whichever thread gets there first.
+    struct MarketFileCache::Slot {
+        std::once_flag once;
+        std::shared_ptr<void> value;   // CsvColumns for files, the built object otherwise
+        ir::Error error{};
+        std::uint64_t hash{ 0 };
+    };
+
+    std::shared_ptr<MarketFileCache::Slot> MarketFileCache::slot(SlotMap& map, const std::string& key) {
+        std::lock_guard<std::mutex> lock(m_);
+        auto& s = map[key];
+        if (!s) s = std::make_shared<Slot>();
+        return s;
+    }
+
+    std::string MarketFileCache::canonical_key(const std::string& path) {
+        std::error_code ec;
+        auto canonical = std::filesystem::weakly_canonical(path, ec);
+        return ec ? path : canonical.string();
+    }
+
+    std::shared_ptr<MarketFileCache::Slot> MarketFileCache::file(const std::string& path) {
+        auto s = slot(files_, canonical_key(path));
+
+        std::call_once(s->once, [&] {
+            auto tab = read_csv_columns_file(path);
+            if (!tab.has_value()) {
+                s->error = tab.error();
+                return;
+            }
+            files_read_.fetch_add(1, std::memory_order_relaxed);
+            s->hash = fnv1a_64(tab.value().source->text());
+            s->value = std::make_shared<CsvColumns>(std::move(tab.value()));
+            });
+        return s;
+    }
+
+    template <class T, class Build>
+    ir::Result<std::shared_ptr<T>> MarketFileCache::object(const char* kind, const std::string& path,
+        const std::string& asof_key, Build&& build) {
+        const auto f = file(path);
+        if (!f->value) return f->error;
+
+        char hash_hex[17];
+        std::snprintf(hash_hex, sizeof(hash_hex), "%016llx", static_cast<unsigned long long>(f->hash));
+        auto s = slot(objects_, std::string(kind) + "|" + asof_key + "|" + hash_hex);
+
+        bool built_here = false;
+        std::call_once(s->once, [&] {
+            built_here = true;
+            built_.fetch_add(1, std::memory_order_relaxed);
+            try {
+                auto res = build(*std::static_pointer_cast<const CsvColumns>(f->value));
+                if (!res.has_value()) {
+                    s->error = ir::Error::make(res.error().code, path + ": " + res.error().message);
+                    return;
+                }
+                s->value = std::move(res.value());
+            }
+            catch (const std::exception& e) {   // e.g. missing column
+                s->error = ir::Error::make(ir::ErrorCode::ParseError, path + ": " + e.what());
+            }
+            });
+        if (!built_here) hits_.fetch_add(1, std::memory_order_relaxed);
+
+        if (!s->value) return s->error;
+        return std::static_pointer_cast<T>(s->value);
+    }
+
+    ir::Result<std::shared_ptr<ir::market::PiecewiseDiscountCurve>>
+        MarketFileCache::discount_curve(const std::string& path, const ir::Date& asof) {
+        return object<ir::market::PiecewiseDiscountCurve>("discount", path, asof.to_iso(),
+            [&](const CsvColumns& tab) { return discount_curve_from_csv(tab, asof); });
+    }
+
+    ir::Result<std::shared_ptr<ir::market::PiecewiseForwardCurve>>
+        MarketFileCache::forward_curve(const std::string& path, const ir::Date& asof) {
+        return object<ir::market::PiecewiseForwardCurve>("forward", path, asof.to_iso(),
+            [&](const CsvColumns& tab) { return forward_curve_from_csv(tab, asof); });
+    }
+
+    ir::Result<std::shared_ptr<const MarketFileCache::FixingRows>>
+        MarketFileCache::fixings(const std::string& path) {
+        auto res = object<FixingRows>("fixings", path, "",
+            [](const CsvColumns& tab) -> ir::Result<std::shared_ptr<FixingRows>> {
+                auto rows = fixings_from_csv(tab);
+                if (!rows.has_value()) return rows.error();
+                return std::make_shared<FixingRows>(std::move(rows.value()));
+            });
+        if (!res.has_value()) return res.error();
+        return std::shared_ptr<const FixingRows>(res.value());
+    }
+
+    ir::Result<std::shared_ptr<const ir::market::FixingStore>>
+        MarketFileCache::fixing_store(const std::vector<std::pair<ir::IndexId, std::string>>& files) {
+        // index=content hash per file, sorted and deduplicated, is the store's key
+        std::vector<std::pair<std::string, std::pair<ir::IndexId, std::shared_ptr<const FixingRows>>>> parts;
+        parts.reserve(files.size());
+        for (const auto& [index, path] : files) {
+            auto rows = fixings(path);
+            if (!rows.has_value()) return rows.error();
+            char hash_hex[17];
+            std::snprintf(hash_hex, sizeof(hash_hex), "%016llx", static_cast<unsigned long long>(file(path)->hash));
+            parts.emplace_back(index.value + "=" + hash_hex, std::make_pair(index, rows.value()));
+        }
+        std::sort(parts.begin(), parts.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        parts.erase(std::unique(parts.begin(), parts.end(),
+            [](const auto& a, const auto& b) { return a.first == b.first; }), parts.end());
+
+        std::string key = "fixingstore";
+        for (const auto& p : parts) key += "|" + p.first;
+        auto s = slot(objects_, key);
+
+        bool built_here = false;
+        std::call_once(s->once, [&] {
+            built_here = true;
+            built_.fetch_add(1, std::memory_order_relaxed);
+            auto store = std::make_shared<ir::market::FixingStore>();
+            for (const auto& [k, part] : parts) {
+                for (const auto& [d, rate] : *part.second) store->add(part.first, d, rate);
+            }
+            s->value = std::move(store);
+            });
+        if (!built_here) hits_.fetch_add(1, std::memory_order_relaxed);
+
+        return std::static_pointer_cast<const ir::market::FixingStore>(s->value);
+    }
+
+    ir::Result<std::shared_ptr<const MarketSnapshot>> MarketFileCache::snapshot(const std::string& path) {
+        auto s = slot(objects_, "snapshot|" + canonical_key(path));
+
+        bool built_here = false;
+        std::call_once(s->once, [&] {
+            built_here = true;
+            auto snap = load_snapshot(path);
+            if (!snap.has_value()) {
+                s->error = snap.error();
+                return;
+            }
+            files_read_.fetch_add(1, std::memory_order_relaxed);
+            built_.fetch_add(1, std::memory_order_relaxed);
+            s->value = std::make_shared<MarketSnapshot>(std::move(snap.value()));
+            });
+        if (!built_here) hits_.fetch_add(1, std::memory_order_relaxed);
+
+        if (!s->value) return s->error;
+        return std::static_pointer_cast<const MarketSnapshot>(s->value);
+    }
+
+    MarketFileCache::Stats MarketFileCache::stats() const {
+        Stats s;
+        s.files_read = files_read_.load(std::memory_order_relaxed);
+        s.built = built_.load(std::memory_order_relaxed);
+        s.hits = hits_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+} // namespace ir::io
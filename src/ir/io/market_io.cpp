@@ -2,7 +2,7 @@
 
 #include <algorithm>
 #include <fstream>
-#include <sstream>
+#include <string_view>
 #include <vector>
 
 #include "ir/core/date.hpp"
@@ -19,40 +19,54 @@
 
 namespace ir::io {
 
-    static ir::Result<ir::Date> parse_iso_date(const std::string& s) {
-        auto d = ir::Date::parse_iso(s);
-        if (!d.has_value()) return d.error();
-        return d.value();
+    // Cell parsers; errors name the cell, its header, line and column.
+    static ir::Result<ir::Date> date_at(const CsvColumns& tab, std::size_t col, std::size_t row) {
+        auto d = ir::Date::parse_iso(tab.columns[col][row]);
+        if (!d.has_value()) return ir::Error::make(d.error().code, d.error().message + ": " + tab.describe(col, row));
+        return d;
     }
 
-    static ir::Result<double> parse_double(const std::string& s) {
-        try {
-            return std::stod(s);
-        }
-        catch (...) {
-            return ir::Error::make(ir::ErrorCode::ParseError, "Failed to parse double: " + s);
-        }
+    static ir::Result<double> double_at(const CsvColumns& tab, std::size_t col, std::size_t row) {
+        auto v = parse_double(tab.columns[col][row]);
+        if (!v.has_value()) return ir::Error::make(v.error().code, "Failed to parse double: " + tab.describe(col, row));
+        return v;
     }
 
-    ir::Result<int> load_discount_curve_nodes_csv(const std::string& path,
-        const ir::CurveId& curve_id,
-        ir::market::MarketData& md) {
-        auto tab = ir::io::read_csv_file(path);
-        if (!tab.has_value()) return tab.error();
+    // Two named columns of a table, looked up once.
+    struct ColumnPair {
+        std::size_t a{ 0 };
+        std::size_t b{ 0 };
+    };
+
+    static ir::Result<ColumnPair> columns(const CsvColumns& tab, std::string_view a, std::string_view b) {
+        auto ca = tab.index(a); if (!ca.has_value()) return ca.error();
+        auto cb = tab.index(b); if (!cb.has_value()) return cb.error();
+        return ColumnPair{ ca.value(), cb.value() };
+    }
 
+    ir::Result<std::shared_ptr<ir::market::PiecewiseDiscountCurve>>
+        discount_curve_from_csv(const CsvColumns& tab, const ir::Date& asof) {
         // Build curve
         ir::market::PiecewiseDiscountCurve::Config cfg;
         cfg.dc = ir::DayCount::ACT365;
+        // Loaded curves are read-only: tabulate t and the curve value per day
+        cfg.date_cache_days = ir::market::kDateCache60Y;
+        cfg.date_cache_values = true;
 
-        auto curve = std::make_shared<ir::market::PiecewiseDiscountCurve>(md.asof(), cfg);
+        auto curve = std::make_shared<ir::market::PiecewiseDiscountCurve>(asof, cfg);
 
         // Nodes (t, DF)
         std::vector<std::pair<double, double>> pts;
-        for (const auto& r : tab.value().rows) {
-            auto d = parse_iso_date(r.at("Date")); if (!d.has_value()) return d.error();
-            auto df = parse_double(r.at("DF")); if (!df.has_value()) return df.error();
+        auto cols = columns(tab, "Date", "DF");
+        if (!cols.has_value()) return cols.error();
+        const auto [dates, values] = cols.value();
+
+        pts.reserve(tab.rows());
+        for (std::size_t i = 0; i < tab.rows(); ++i) {
+            auto d = date_at(tab, dates, i); if (!d.has_value()) return d.error();
+            auto df = double_at(tab, values, i); if (!df.has_value()) return df.error();
 
-            const double t = ir::year_fraction(md.asof(), d.value(), cfg.dc);
+            const double t = ir::year_fraction(asof, d.value(), cfg.dc);
             pts.push_back({ t, df.value() });
         }
 
@@ -68,28 +82,30 @@ namespace ir::io {
 
         auto set = curve->set_nodes(std::move(nodes));
         if (!set.has_value()) return set.error();
-
-        md.set_discount_curve(curve_id, curve);
-        return 0;
+        return curve;
     }
 
-    ir::Result<int> load_forward_curve_nodes_csv(const std::string& path,
-        const ir::CurveId& curve_id,
-        ir::market::MarketData& md) {
-        auto tab = ir::io::read_csv_file(path);
-        if (!tab.has_value()) return tab.error();
-
+    ir::Result<std::shared_ptr<ir::market::PiecewiseForwardCurve>>
+        forward_curve_from_csv(const CsvColumns& tab, const ir::Date& asof) {
         ir::market::PiecewiseForwardCurve::Config cfg;
         cfg.dc = ir::DayCount::ACT365;
+        // Loaded curves are read-only: tabulate t and the curve value per day
+        cfg.date_cache_days = ir::market::kDateCache60Y;
+        cfg.date_cache_values = true;
 
-        auto curve = std::make_shared<ir::market::PiecewiseForwardCurve>(md.asof(), cfg);
+        auto curve = std::make_shared<ir::market::PiecewiseForwardCurve>(asof, cfg);
 
         std::vector<std::pair<double, double>> pts;
-        for (const auto& r : tab.value().rows) {
-            auto d = parse_iso_date(r.at("Date")); if (!d.has_value()) return d.error();
-            auto pf = parse_double(r.at("PseudoDF")); if (!pf.has_value()) return pf.error();
+        auto cols = columns(tab, "Date", "PseudoDF");
+        if (!cols.has_value()) return cols.error();
+        const auto [dates, values] = cols.value();
 
-            const double t = ir::year_fraction(md.asof(), d.value(), cfg.dc);
+        pts.reserve(tab.rows());
+        for (std::size_t i = 0; i < tab.rows(); ++i) {
+            auto d = date_at(tab, dates, i); if (!d.has_value()) return d.error();
+            auto pf = double_at(tab, values, i); if (!pf.has_value()) return pf.error();
+
+            const double t = ir::year_fraction(asof, d.value(), cfg.dc);
             pts.push_back({ t, pf.value() });
         }
 
@@ -105,22 +121,61 @@ namespace ir::io {
 
         auto set = curve->set_nodes(std::move(nodes));
         if (!set.has_value()) return set.error();
+        return curve;
+    }
+
+    ir::Result<std::vector<std::pair<ir::Date, double>>> fixings_from_csv(const CsvColumns& tab) {
+        auto cols = columns(tab, "Date", "Rate");
+        if (!cols.has_value()) return cols.error();
+        const auto [dates, rates] = cols.value();
+
+        std::vector<std::pair<ir::Date, double>> out;
+        out.reserve(tab.rows());
+        for (std::size_t i = 0; i < tab.rows(); ++i) {
+            auto d = date_at(tab, dates, i); if (!d.has_value()) return d.error();
+            auto rt = double_at(tab, rates, i); if (!rt.has_value()) return rt.error();
+            out.push_back({ d.value(), rt.value() });
+        }
+        return out;
+    }
+
+    ir::Result<int> load_discount_curve_nodes_csv(const std::string& path,
+        const ir::CurveId& curve_id,
+        ir::market::MarketData& md) {
+        auto tab = ir::io::read_csv_columns_file(path);
+        if (!tab.has_value()) return tab.error();
+
+        auto curve = discount_curve_from_csv(tab.value(), md.asof());
+        if (!curve.has_value()) return curve.error();
+
+        md.set_discount_curve(curve_id, curve.value());
+        return 0;
+    }
+
+    ir::Result<int> load_forward_curve_nodes_csv(const std::string& path,
+        const ir::CurveId& curve_id,
+        ir::market::MarketData& md) {
+        auto tab = ir::io::read_csv_columns_file(path);
+        if (!tab.has_value()) return tab.error();
+
+        auto curve = forward_curve_from_csv(tab.value(), md.asof());
+        if (!curve.has_value()) return curve.error();
 
-        md.set_forward_curve(curve_id, curve);
+        md.set_forward_curve(curve_id, curve.value());
         return 0;
     }
 
     ir::Result<int> load_fixings_csv(const std::string& path,
         const ir::IndexId& index,
         ir::market::FixingStore& store) {
-        auto tab = ir::io::read_csv_file(path);
+        auto tab = ir::io::read_csv_columns_file(path);
         if (!tab.has_value()) return tab.error();
 
-        for (const auto& r : tab.value().rows) {
-            auto d = parse_iso_date(r.at("Date")); if (!d.has_value()) return d.error();
-            auto rt = parse_double(r.at("Rate")); if (!rt.has_value()) return rt.error();
+        auto rows = fixings_from_csv(tab.value());
+        if (!rows.has_value()) return rows.error();
 
-            store.add(index, d.value(), rt.value());
+        for (const auto& [d, rate] : rows.value()) {
+            store.add(index, d, rate);
         }
 
         return 0;
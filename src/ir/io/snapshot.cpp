@@ -0,0 +1,342 @@
+#include "ir/io/snapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ir/core/error.hpp"
+#include "ir/io/csv_io.hpp"
+#include "ir/market/curves.hpp"
+
+namespace ir::io {
+
+    namespace {
+
+        constexpr char kMagic[8] = { 'I', 'R', 'S', 'N', 'A', 'P', '\0', '\0' };
+        constexpr std::uint32_t kEndianMark = 0x01020304;
+        constexpr std::uint32_t kFlagDateCacheValues = 1;
+
+        struct SnapshotHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t endian;
+            std::int64_t asof;             // days since 1970-01-01
+            std::uint32_t n_discount;
+            std::uint32_t n_forward;
+            std::uint32_t n_quotes;
+            std::uint32_t n_fixings;
+            std::uint64_t strings_offset;
+            std::uint64_t strings_size;
+            std::uint64_t file_size;
+        };
+
+        struct CurveRecord {
+            std::uint32_t id_offset;       // into the string pool
+            std::uint32_t id_len;
+            std::int64_t asof;
+            std::uint32_t dc;
+            std::uint32_t bdc;             // discount curves only
+            std::int32_t date_cache_days;
+            std::uint32_t flags;
+            std::uint64_t nodes_offset;    // byte offset of t[n], followed by v[n]
+            std::uint64_t n_nodes;
+            std::uint64_t cache_offset;    // byte offset of the per-day value table
+            std::uint64_t n_cache;         // 0 if the curve has none
+        };
+
+        struct QuoteRecord {
+            std::uint32_t id_offset;
+            std::uint32_t id_len;
+            std::uint32_t type;
+            std::uint32_t reserved;
+            double value;
+        };
+
+        struct FixingRecord {
+            std::uint32_t id_offset;
+            std::uint32_t id_len;
+            std::int64_t first_day;
+            std::uint64_t values_offset;   // byte offset of the per-day array
+            std::uint64_t n_days;
+        };
+
+        static_assert(sizeof(SnapshotHeader) == 64);
+        static_assert(sizeof(CurveRecord) == 64);
+        static_assert(sizeof(QuoteRecord) == 24);
+        static_assert(sizeof(FixingRecord) == 32);
+        static_assert(std::is_trivially_copyable_v<CurveRecord> && std::is_trivially_copyable_v<FixingRecord>);
+
+        std::uint64_t align8(std::uint64_t n) { return (n + 7) & ~std::uint64_t{ 7 }; }
+
+        std::int64_t serial(const ir::Date& d) { return d.raw().time_since_epoch().count(); }
+        ir::Date from_serial(std::int64_t s) { return ir::Date{ ir::Date::sys_days{ std::chrono::days{ s } } }; }
+
+        ir::Error corrupt(const std::string& path, const std::string& what) {
+            return ir::Error::make(ir::ErrorCode::ParseError, "snapshot " + path + ": " + what);
+        }
+
+        // Writer-side staging: names go to the string pool, arrays to the double block
+        // (offsets in doubles, rebased to bytes once the pool size is known).
+        struct Staging {
+            std::string pool;
+            std::vector<double> data;
+
+            std::pair<std::uint32_t, std::uint32_t> name(std::string_view s) {
+                const auto off = static_cast<std::uint32_t>(pool.size());
+                pool.append(s);
+                return { off, static_cast<std::uint32_t>(s.size()) };
+            }
+            std::uint64_t doubles(std::span<const double> v) {
+                const auto off = static_cast<std::uint64_t>(data.size());
+                data.insert(data.end(), v.begin(), v.end());
+                return off;
+            }
+        };
+
+        template <class Curve>
+        CurveRecord curve_record(Staging& st, const std::string& id, const Curve& c) {
+            CurveRecord r{};
+            std::tie(r.id_offset, r.id_len) = st.name(id);
+            r.asof = serial(c.asof());
+            r.dc = static_cast<std::uint32_t>(c.config().dc);
+            r.date_cache_days = c.config().date_cache_days;
+            r.flags = c.config().date_cache_values ? kFlagDateCacheValues : 0;
+            r.n_nodes = c.nodes().t.size();
+            r.nodes_offset = st.doubles(c.nodes().t);
+            st.doubles(c.nodes().v);
+            r.n_cache = c.date_cache_values().size();
+            r.cache_offset = st.doubles(c.date_cache_values());
+            return r;
+        }
+
+        template <class T>
+        void put(std::vector<char>& out, std::uint64_t at, const T& x) {
+            std::memcpy(out.data() + at, &x, sizeof(T));
+        }
+
+    } // namespace
+
+    ir::Result<std::size_t> save_snapshot(const ir::market::MarketData& md, const std::string& path) {
+        Staging st;
+        std::vector<CurveRecord> disc, fwd;
+        std::vector<QuoteRecord> quotes;
+        std::vector<FixingRecord> fixings;
+
+        auto sorted = [](std::vector<ir::CurveId> ids) {
+            std::sort(ids.begin(), ids.end(), [](const auto& a, const auto& b) { return a.value < b.value; });
+            return ids;
+        };
+
+        for (const auto& id : sorted(md.discount_curve_ids())) {
+            const auto* c = dynamic_cast<const ir::market::PiecewiseDiscountCurve*>(&md.discount_curve(id));
+            if (!c) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "save_snapshot: discount curve is not piecewise: " + id.value);
+            }
+            auto r = curve_record(st, id.value, *c);
+            r.bdc = static_cast<std::uint32_t>(c->config().bdc);
+            disc.push_back(r);
+        }
+        for (const auto& id : sorted(md.forward_curve_ids())) {
+            const auto* c = dynamic_cast<const ir::market::PiecewiseForwardCurve*>(&md.forward_curve(id));
+            if (!c) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "save_snapshot: forward curve is not piecewise: " + id.value);
+            }
+            fwd.push_back(curve_record(st, id.value, *c));
+        }
+
+        std::vector<std::pair<ir::market::QuoteId, ir::market::Quote>> qs(md.quotes().begin(), md.quotes().end());
+        std::sort(qs.begin(), qs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (const auto& [id, q] : qs) {
+            QuoteRecord r{};
+            std::tie(r.id_offset, r.id_len) = st.name(id);
+            r.type = static_cast<std::uint32_t>(q.type);
+            r.value = q.value;
+            quotes.push_back(r);
+        }
+
+        if (const auto* store = md.fixings()) {
+            const auto ids = store->indices();
+            for (std::size_t h = 0; h < ids.size(); ++h) {
+                const auto values = store->history(static_cast<ir::market::FixingStore::Handle>(h));
+                if (values.empty()) continue;
+                FixingRecord r{};
+                std::tie(r.id_offset, r.id_len) = st.name(ids[h].value);
+                r.first_day = serial(store->first_date(static_cast<ir::market::FixingStore::Handle>(h)));
+                r.n_days = values.size();
+                r.values_offset = st.doubles(values);
+                fixings.push_back(r);
+            }
+        }
+
+        // Final layout
+        const std::uint64_t records = sizeof(SnapshotHeader)
+            + (disc.size() + fwd.size()) * sizeof(CurveRecord)
+            + quotes.size() * sizeof(QuoteRecord)
+            + fixings.size() * sizeof(FixingRecord);
+        const std::uint64_t strings_offset = align8(records);
+        const std::uint64_t data_offset = align8(strings_offset + st.pool.size());
+        const std::uint64_t file_size = data_offset + st.data.size() * sizeof(double);
+
+        for (auto* v : { &disc, &fwd }) {
+            for (auto& r : *v) {
+                r.nodes_offset = data_offset + r.nodes_offset * sizeof(double);
+                r.cache_offset = data_offset + r.cache_offset * sizeof(double);
+            }
+        }
+        for (auto& r : fixings) r.values_offset = data_offset + r.values_offset * sizeof(double);
+
+        SnapshotHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof(kMagic));
+        h.version = kSnapshotVersion;
+        h.endian = kEndianMark;
+        h.asof = serial(md.asof());
+        h.n_discount = static_cast<std::uint32_t>(disc.size());
+        h.n_forward = static_cast<std::uint32_t>(fwd.size());
+        h.n_quotes = static_cast<std::uint32_t>(quotes.size());
+        h.n_fixings = static_cast<std::uint32_t>(fixings.size());
+        h.strings_offset = strings_offset;
+        h.strings_size = st.pool.size();
+        h.file_size = file_size;
+
+        std::vector<char> out(file_size, '\0');
+        std::uint64_t at = 0;
+        put(out, at, h);
+        at += sizeof(h);
+        for (const auto& r : disc) { put(out, at, r); at += sizeof(r); }
+        for (const auto& r : fwd) { put(out, at, r); at += sizeof(r); }
+        for (const auto& r : quotes) { put(out, at, r); at += sizeof(r); }
+        for (const auto& r : fixings) { put(out, at, r); at += sizeof(r); }
+        std::memcpy(out.data() + strings_offset, st.pool.data(), st.pool.size());
+        if (!st.data.empty()) {
+            std::memcpy(out.data() + data_offset, st.data.data(), st.data.size() * sizeof(double));
+        }
+
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        if (!f) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "save_snapshot: cannot open file: " + path);
+        }
+        f.write(out.data(), static_cast<std::streamsize>(out.size()));
+        if (!f) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "save_snapshot: write failed: " + path);
+        }
+        return static_cast<std::size_t>(file_size);
+    }
+
+    ir::Result<MarketSnapshot> load_snapshot(const std::string& path) {
+        auto file = MappedFile::open(path);
+        if (!file.has_value()) return file.error();
+        const std::string_view bytes = file.value().text();
+
+        SnapshotHeader h{};
+        if (bytes.size() < sizeof(h)) return corrupt(path, "file too small.");
+        std::memcpy(&h, bytes.data(), sizeof(h));
+        if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0) return corrupt(path, "not a market snapshot.");
+        if (h.endian != kEndianMark) return corrupt(path, "written with a different byte order.");
+        if (h.version != kSnapshotVersion) {
+            return corrupt(path, "unsupported version " + std::to_string(h.version)
+                + " (expected " + std::to_string(kSnapshotVersion) + ").");
+        }
+        if (h.file_size != bytes.size()) return corrupt(path, "truncated or padded file.");
+
+        const std::uint64_t records_end = sizeof(SnapshotHeader)
+            + (std::uint64_t{ h.n_discount } + h.n_forward) * sizeof(CurveRecord)
+            + std::uint64_t{ h.n_quotes } * sizeof(QuoteRecord)
+            + std::uint64_t{ h.n_fixings } * sizeof(FixingRecord);
+        if (records_end > h.strings_offset || h.strings_offset + h.strings_size > bytes.size()) {
+            return corrupt(path, "bad section offsets.");
+        }
+        const std::string_view pool = bytes.substr(h.strings_offset, h.strings_size);
+
+        std::uint64_t at = sizeof(SnapshotHeader);
+        auto next = [&](auto& rec) {
+            std::memcpy(&rec, bytes.data() + at, sizeof(rec));
+            at += sizeof(rec);
+        };
+        auto name = [&](std::uint32_t off, std::uint32_t len, std::string& out) {
+            if (std::uint64_t{ off } + len > pool.size()) return false;
+            out.assign(pool.substr(off, len));
+            return true;
+        };
+        std::vector<double> cache;
+        auto doubles = [&](std::uint64_t off, std::uint64_t n, std::vector<double>& out) {
+            if (off % 8 != 0 || n > bytes.size() / 8 || off > bytes.size() - n * 8) return false;
+            out.resize(static_cast<std::size_t>(n));
+            if (n > 0) std::memcpy(out.data(), bytes.data() + off, static_cast<std::size_t>(n) * 8);
+            return true;
+        };
+        auto node_arrays = [&](const CurveRecord& r, ir::utils::Nodes1D& nodes) {
+            return doubles(r.nodes_offset, r.n_nodes, nodes.t)
+                && doubles(r.nodes_offset + r.n_nodes * 8, r.n_nodes, nodes.v)
+                && doubles(r.cache_offset, r.n_cache, cache);
+        };
+
+        MarketSnapshot snap;
+        snap.fixings = std::make_unique<ir::market::FixingStore>();
+        snap.md = std::make_unique<ir::market::MarketData>(from_serial(h.asof));
+        snap.md->set_fixings(snap.fixings.get());
+
+        std::string id;
+        for (std::uint32_t i = 0; i < h.n_discount; ++i) {
+            CurveRecord r{};
+            next(r);
+            ir::utils::Nodes1D nodes;
+            if (!name(r.id_offset, r.id_len, id) || !node_arrays(r, nodes)) return corrupt(path, "bad discount curve record.");
+            if (r.dc > static_cast<std::uint32_t>(ir::DayCount::THIRTY360)
+                || r.bdc > static_cast<std::uint32_t>(ir::BusinessDayConvention::Preceding)) {
+                return corrupt(path, "bad conventions for curve " + id + ".");
+            }
+            ir::market::PiecewiseDiscountCurve::Config cfg;
+            cfg.dc = static_cast<ir::DayCount>(r.dc);
+            cfg.bdc = static_cast<ir::BusinessDayConvention>(r.bdc);
+            cfg.date_cache_days = r.date_cache_days;
+            cfg.date_cache_values = (r.flags & kFlagDateCacheValues) != 0;
+            auto c = std::make_shared<ir::market::PiecewiseDiscountCurve>(from_serial(r.asof), cfg);
+            auto ok = c->set_nodes(std::move(nodes), cache);
+            if (!ok.has_value()) return corrupt(path, "curve " + id + ": " + ok.error().message);
+            snap.md->set_discount_curve(ir::CurveId{ id }, std::move(c));
+        }
+        for (std::uint32_t i = 0; i < h.n_forward; ++i) {
+            CurveRecord r{};
+            next(r);
+            ir::utils::Nodes1D nodes;
+            if (!name(r.id_offset, r.id_len, id) || !node_arrays(r, nodes)) return corrupt(path, "bad forward curve record.");
+            if (r.dc > static_cast<std::uint32_t>(ir::DayCount::THIRTY360)) {
+                return corrupt(path, "bad conventions for curve " + id + ".");
+            }
+            ir::market::PiecewiseForwardCurve::Config cfg;
+            cfg.dc = static_cast<ir::DayCount>(r.dc);
+            cfg.date_cache_days = r.date_cache_days;
+            cfg.date_cache_values = (r.flags & kFlagDateCacheValues) != 0;
+            auto c = std::make_shared<ir::market::PiecewiseForwardCurve>(from_serial(r.asof), cfg);
+            auto ok = c->set_nodes(std::move(nodes), cache);
+            if (!ok.has_value()) return corrupt(path, "curve " + id + ": " + ok.error().message);
+            snap.md->set_forward_curve(ir::CurveId{ id }, std::move(c));
+        }
+        for (std::uint32_t i = 0; i < h.n_quotes; ++i) {
+            QuoteRecord r{};
+            next(r);
+            if (!name(r.id_offset, r.id_len, id) || r.type > static_cast<std::uint32_t>(ir::market::QuoteType::Vol)) {
+                return corrupt(path, "bad quote record.");
+            }
+            snap.md->set_quote(id, ir::market::Quote{ static_cast<ir::market::QuoteType>(r.type), r.value });
+        }
+        std::vector<double> values;
+        for (std::uint32_t i = 0; i < h.n_fixings; ++i) {
+            FixingRecord r{};
+            next(r);
+            if (!name(r.id_offset, r.id_len, id) || !doubles(r.values_offset, r.n_days, values)) {
+                return corrupt(path, "bad fixing record.");
+            }
+            snap.fixings->add_series(ir::IndexId{ id }, from_serial(r.first_day), values);
+        }
+
+        return snap;
+    }
+
+} // namespace ir::io
@@ -22,11 +22,130 @@ namespace ir::market {
         return a->maturity() < b->maturity();
     }
 
+    // The per-day value table (Config::date_cache_values) is only worth building once the
+    // nodes are final: solve on a curve without it, then rebuild with the caller's config.
+    template <class Cfg>
+    static Cfg solve_config(Cfg cfg) {
+        cfg.date_cache_values = false;
+        return cfg;
+    }
+
+    template <class CurveT>
+    static ir::Result<std::shared_ptr<CurveT>> finalize_curve(std::shared_ptr<CurveT> solved,
+        const ir::Date& asof, const typename CurveT::Config& cfg) {
+        if (!cfg.date_cache_values) return solved;
+        auto out = std::make_shared<CurveT>(asof, cfg);
+        auto ok = out->set_nodes(solved->nodes());
+        if (!ok.has_value()) return ok.error();
+        return out;
+    }
+
+    // Starting value for pillar ti: flat extrapolation of the previous pillar's zero rate.
+    static double seed_from_previous(const ir::utils::Nodes1D& nodes, double ti) {
+        double z = 0.02;
+        if (!nodes.t.empty() && nodes.t.back() > 0.0) {
+            z = -std::log(nodes.v.back()) / nodes.t.back();
+        }
+        return std::exp(-z * ti);
+    }
+
+    // Solve f(x) = 0 for the last node value x.
+    // value(x) -> f(x); value_and_derivative(x, dfdx) -> f(x) and f'(x).
+    template <class F, class FD>
+    static ir::Result<double> solve_pillar(F&& value,
+        FD&& value_and_derivative,
+        double guess,
+        const BootstrapOptions& opts,
+        BootstrapReport& rep) {
+        rep.pillars += 1;
+
+        if (opts.pillar_solver == PillarSolver::Newton) {
+            auto sol = ir::utils::newton(value_and_derivative, guess, opts.df_min, opts.df_max, opts.solver);
+            if (sol.has_value() && sol.value().report.converged) {
+                rep.iterations += sol.value().report.iterations;
+                return sol.value().root;
+            }
+            if (sol.has_value()) rep.iterations += sol.value().report.iterations;
+            rep.newton_fallbacks += 1;
+        }
+
+        auto sol = ir::utils::brent(value, opts.df_min, opts.df_max, opts.solver);
+        if (!sol.has_value()) {
+            return sol.error();
+        }
+        rep.iterations += sol.value().report.iterations;
+        return sol.value().root;
+    }
+
+    // Per-pillar equations at the solution, for BootstrapSensitivities: row i holds
+    // d implied_i / d node j of the curve being built (j = 0..i+1) and, for IRS helpers,
+    // d implied_i / d discount node (empty otherwise).
+    struct PillarJacobian {
+        std::vector<std::vector<double>> own;
+        std::vector<std::vector<double>> discount;
+    };
+
+    // Solves L y = b in place by forward substitution, L(i, j) = own[i][j + 1] (j <= i).
+    static bool lower_solve(const std::vector<std::vector<double>>& own, std::vector<double>& b) {
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            double s = b[i];
+            for (std::size_t j = 0; j < i; ++j) s -= own[i][j + 1] * b[j];
+            const double d = own[i][i + 1];
+            if (d == 0.0 || !std::isfinite(d)) return false;
+            b[i] = s / d;
+        }
+        return true;
+    }
+
+    static ir::Result<BootstrapSensitivities> invert_pillars(const PillarJacobian& jac,
+        std::vector<ir::Date> maturities,
+        std::size_t discount_nodes) {
+        const std::size_t n = jac.own.size();
+
+        // Solve column by column (dense, column-major), then store by node row
+        auto solve_columns = [&](std::size_t cols, auto&& rhs) -> ir::Result<ir::utils::SparseMatrix> {
+            std::vector<double> x(cols * n);
+            std::vector<double> b(n);
+            for (std::size_t c = 0; c < cols; ++c) {
+                for (std::size_t i = 0; i < n; ++i) b[i] = rhs(i, c);
+                if (!lower_solve(jac.own, b)) {
+                    return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                        "bootstrap: singular pillar Jacobian, no quote sensitivities.");
+                }
+                std::copy(b.begin(), b.end(), x.begin() + c * n);
+            }
+            ir::utils::SparseMatrix m(n + 1, cols);
+            m.end_row();   // node 0 (t = 0) does not move
+            for (std::size_t i = 0; i < n; ++i) {
+                for (std::size_t c = 0; c < cols; ++c) m.push(c, x[c * n + i]);
+                m.end_row();
+            }
+            return m;
+        };
+
+        BootstrapSensitivities out;
+        auto dq = solve_columns(n, [](std::size_t i, std::size_t c) { return i == c ? 1.0 : 0.0; });
+        if (!dq.has_value()) return dq.error();
+        out.d_node_d_quote = std::move(dq.value());
+        out.quote_maturities = std::move(maturities);
+
+        if (discount_nodes > 0) {
+            auto dd = solve_columns(discount_nodes, [&](std::size_t i, std::size_t c) {
+                return jac.discount[i].empty() ? 0.0 : -jac.discount[i][c];
+                });
+            if (!dd.has_value()) return dd.error();
+            out.d_node_d_discount = std::move(dd.value());
+        }
+        return out;
+    }
+
     ir::Result<std::shared_ptr<PiecewiseDiscountCurve>>
         CurveBootstrapper::bootstrap_discount_curve(const ir::Date& asof,
             PiecewiseDiscountCurve::Config cfg,
             const std::vector<std::shared_ptr<OisSwapHelper>>& helpers,
-            const BootstrapOptions& opts) const {
+            const BootstrapOptions& opts,
+            BootstrapReport* report,
+            BootstrapSensitivities* sensitivities) const {
         if (helpers.empty()) {
             return ir::Error::make(ir::ErrorCode::InvalidArgument,
                 "bootstrap_discount_curve: helpers is empty.");
@@ -35,15 +154,21 @@ namespace ir::market {
         auto sorted = helpers;
         std::sort(sorted.begin(), sorted.end(), by_maturity_discount);
 
-        auto curve = std::make_shared<PiecewiseDiscountCurve>(asof, cfg);
+        auto curve = std::make_shared<PiecewiseDiscountCurve>(asof, solve_config(cfg));
+        BootstrapReport rep;
 
         // Nodes: start with (t=0, df=1)
         ir::utils::Nodes1D nodes;
         {
-        auto r0 = nodes.push_back(0.0, 1.0);
+            auto r0 = opts.incremental ? curve->push_node(0.0, 1.0) : nodes.push_back(0.0, 1.0);
             if (!r0.has_value()) return r0.error();
         }
 
+        // d(par)/d(node DF), reused across pillars
+        std::vector<double> grad;
+        PillarJacobian jac;
+        std::vector<ir::Date> maturities;
+
         // Bootstrapping loop
         for (const auto& h : sorted) {
             const double ti = ir::year_fraction(asof, h->maturity(), cfg.dc);
@@ -53,21 +178,29 @@ namespace ir::market {
             }
 
             // Add node placeholder (will be solved)
+            const double guess = seed_from_previous(opts.incremental ? curve->nodes() : nodes, ti);
             {
-                // Initial guess: slightly decaying
-                double guess = std::exp(-0.02 * ti);
-                auto rr = nodes.push_back(ti, guess);
+                auto rr = opts.incremental ? curve->push_node(ti, guess) : nodes.push_back(ti, guess);
                 if (!rr.has_value()) return rr.error();
             }
+            grad.resize(opts.incremental ? curve->nodes().t.size() : nodes.t.size());
 
-            // Objective f(df_i) = implied_par_rate(df_i) - market_quote
-            auto objective = [&](double df_i) -> double {
+            // Move the last node of the curve to df_i
+            auto set_trial = [&](double df_i) -> bool {
+                if (opts.incremental) {
+                    return curve->set_last_value(df_i).has_value();
+                }
                 ir::utils::Nodes1D trial = nodes;
                 trial.v.back() = df_i;
 
                 // Build curve for this trial
-                auto s = curve->set_nodes(std::move(trial));
-                if (!s.has_value()) return std::numeric_limits<double>::quiet_NaN();
+                return curve->set_nodes(std::move(trial)).has_value();
+                };
+
+            // Objective f(df_i) = implied_par_rate(df_i) - market_quote
+            auto objective = [&](double df_i) -> double {
+                rep.evaluations += 1;
+                if (!set_trial(df_i)) return std::numeric_limits<double>::quiet_NaN();
 
                 auto imp = h->implied_par_rate(*curve);
                 if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
@@ -75,21 +208,50 @@ namespace ir::market {
                 return imp.value() - h->market_quote();
                 };
 
-            // Solve with brent
-            auto sol = ir::utils::brent(objective, opts.df_min, opts.df_max, opts.solver);
+            auto objective_d = [&](double df_i, double& dfdx) -> double {
+                rep.evaluations += 1;
+                if (!set_trial(df_i)) return std::numeric_limits<double>::quiet_NaN();
+
+                auto imp = h->implied_par_rate(*curve, grad);
+                if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
+
+                dfdx = grad.back();
+                return imp.value() - h->market_quote();
+                };
+
+            auto sol = solve_pillar(objective, objective_d, guess, opts, rep);
             if (!sol.has_value()) {
                 return sol.error();
             }
 
-            const double df_star = sol.value().root;
-            nodes.v.back() = df_star;
+            const double df_star = sol.value();
 
             // Finalize curve nodes at this pillar
-            auto ok = curve->set_nodes(nodes);
-            if (!ok.has_value()) return ok.error();
+            if (opts.incremental) {
+                auto ok = curve->set_last_value(df_star);
+                if (!ok.has_value()) return ok.error();
+            }
+            else {
+                nodes.v.back() = df_star;
+                auto ok = curve->set_nodes(nodes);
+                if (!ok.has_value()) return ok.error();
+            }
+
+            if (sensitivities) {
+                auto imp = h->implied_par_rate(*curve, grad);
+                if (!imp.has_value()) return imp.error();
+                jac.own.push_back(grad);
+                maturities.push_back(h->maturity());
+            }
         }
 
-        return curve;
+        if (sensitivities) {
+            auto sens = invert_pillars(jac, std::move(maturities), 0);
+            if (!sens.has_value()) return sens.error();
+            *sensitivities = std::move(sens.value());
+        }
+        if (report) *report = rep;
+        return finalize_curve(std::move(curve), asof, cfg);
     }
 
     ir::Result<std::shared_ptr<PiecewiseForwardCurve>>
@@ -97,7 +259,9 @@ namespace ir::market {
             PiecewiseForwardCurve::Config cfg,
             const PiecewiseDiscountCurve& discount_curve,
             const std::vector<std::shared_ptr<RateHelper>>& helpers,
-            const BootstrapOptions& opts) const {
+            const BootstrapOptions& opts,
+            BootstrapReport* report,
+            BootstrapSensitivities* sensitivities) const {
         if (helpers.empty()) {
             return ir::Error::make(ir::ErrorCode::InvalidArgument,
                 "bootstrap_forward_curve: helpers is empty.");
@@ -106,15 +270,20 @@ namespace ir::market {
         auto sorted = helpers;
         std::sort(sorted.begin(), sorted.end(), by_maturity_any);
 
-        auto fwd = std::make_shared<PiecewiseForwardCurve>(asof, cfg);
+        auto fwd = std::make_shared<PiecewiseForwardCurve>(asof, solve_config(cfg));
+        BootstrapReport rep;
 
         // Nodes for pseudo-discount curve Pf: start at (0,1)
         ir::utils::Nodes1D nodes;
         {
-            auto r0 = nodes.push_back(0.0, 1.0);
+            auto r0 = opts.incremental ? fwd->push_node(0.0, 1.0) : nodes.push_back(0.0, 1.0);
             if (!r0.has_value()) return r0.error();
         }
 
+        std::vector<double> grad;
+        PillarJacobian jac;
+        std::vector<ir::Date> maturities;
+
         for (const auto& h : sorted) {
             const double ti = ir::year_fraction(asof, h->maturity(), cfg.dc);
             if (!(ti > 0.0)) {
@@ -123,11 +292,12 @@ namespace ir::market {
             }
 
             // Placeholder node
+            const double guess = seed_from_previous(opts.incremental ? fwd->nodes() : nodes, ti);
             {
-                double guess = std::exp(-0.02 * ti);
-                auto rr = nodes.push_back(ti, guess);
+                auto rr = opts.incremental ? fwd->push_node(ti, guess) : nodes.push_back(ti, guess);
                 if (!rr.has_value()) return rr.error();
             }
+            grad.resize(opts.incremental ? fwd->nodes().t.size() : nodes.t.size());
 
             // Figure out helper type
             const auto* fra = dynamic_cast<const FraHelper*>(h.get());
@@ -137,37 +307,246 @@ namespace ir::market {
                     "bootstrap_forward_curve: unsupported helper type (not FRA/IRS).");
             }
 
-            auto objective = [&](double pf_i) -> double {
+            auto set_trial = [&](double pf_i) -> bool {
+                if (opts.incremental) {
+                    return fwd->set_last_value(pf_i).has_value();
+                }
                 ir::utils::Nodes1D trial = nodes;
                 trial.v.back() = pf_i;
 
-                auto s = fwd->set_nodes(std::move(trial));
-                if (!s.has_value()) return std::numeric_limits<double>::quiet_NaN();
+                return fwd->set_nodes(std::move(trial)).has_value();
+                };
 
-                if (fra) {
-                    auto imp = fra->implied_fra_rate(*fwd);
-                    if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
-                    return imp.value() - fra->market_quote();
-                }
-                else {
-                    auto imp = irs->implied_par_rate(discount_curve, *fwd);
-                    if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
-                    return imp.value() - irs->market_quote();
-                }
+            // With grad empty: value only; otherwise also fills grad.
+            auto implied = [&](std::span<double> g) -> ir::Result<double> {
+                if (fra) return fra->implied_fra_rate(*fwd, g);
+                return irs->implied_par_rate(discount_curve, *fwd, std::span<double>{}, g);
+                };
+
+            auto objective = [&](double pf_i) -> double {
+                rep.evaluations += 1;
+                if (!set_trial(pf_i)) return std::numeric_limits<double>::quiet_NaN();
+
+                auto imp = implied(std::span<double>{});
+                if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
+                return imp.value() - h->market_quote();
+                };
+
+            auto objective_d = [&](double pf_i, double& dfdx) -> double {
+                rep.evaluations += 1;
+                if (!set_trial(pf_i)) return std::numeric_limits<double>::quiet_NaN();
+
+                auto imp = implied(grad);
+                if (!imp.has_value()) return std::numeric_limits<double>::quiet_NaN();
+
+                dfdx = grad.back();
+                return imp.value() - h->market_quote();
                 };
 
-            auto sol = ir::utils::brent(objective, opts.df_min, opts.df_max, opts.solver);
+            auto sol = solve_pillar(objective, objective_d, guess, opts, rep);
             if (!sol.has_value()) {
                 return sol.error();
             }
 
-            nodes.v.back() = sol.value().root;
+            if (opts.incremental) {
+                auto ok = fwd->set_last_value(sol.value());
+                if (!ok.has_value()) return ok.error();
+            }
+            else {
+                nodes.v.back() = sol.value();
+                auto ok = fwd->set_nodes(nodes);
+                if (!ok.has_value()) return ok.error();
+            }
+
+            if (sensitivities) {
+                std::vector<double> g_disc(irs ? discount_curve.nodes().t.size() : 0);
+                auto imp = fra ? fra->implied_fra_rate(*fwd, grad)
+                    : irs->implied_par_rate(discount_curve, *fwd, g_disc, grad);
+                if (!imp.has_value()) return imp.error();
+                jac.own.push_back(grad);
+                jac.discount.push_back(std::move(g_disc));
+                maturities.push_back(h->maturity());
+            }
+        }
 
-            auto ok = fwd->set_nodes(nodes);
+        if (sensitivities) {
+            auto sens = invert_pillars(jac, std::move(maturities), discount_curve.nodes().t.size());
+            if (!sens.has_value()) return sens.error();
+            *sensitivities = std::move(sens.value());
+        }
+        if (report) *report = rep;
+        return finalize_curve(std::move(fwd), asof, cfg);
+    }
+
+    ir::Result<JointBootstrapResult>
+        CurveBootstrapper::bootstrap_curves_jointly(const ir::Date& asof,
+            PiecewiseDiscountCurve::Config disc_cfg,
+            PiecewiseForwardCurve::Config fwd_cfg,
+            const std::vector<std::shared_ptr<OisSwapHelper>>& ois_helpers,
+            const std::vector<std::shared_ptr<RateHelper>>& fwd_helpers,
+            const BootstrapOptions& opts) const {
+        if (ois_helpers.empty() || fwd_helpers.empty()) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "bootstrap_curves_jointly: helpers is empty.");
+        }
+
+        auto ois = ois_helpers;
+        std::sort(ois.begin(), ois.end(), by_maturity_discount);
+        auto fwh = fwd_helpers;
+        std::sort(fwh.begin(), fwh.end(), by_maturity_any);
+
+        const std::size_t nd = ois.size();
+        const std::size_t nf = fwh.size();
+        const std::size_t n = nd + nf;
+
+        // Initial guess: each pillar node at exp(-quote * t)
+        ir::utils::Nodes1D dn, fn;
+        dn.push_back(0.0, 1.0);
+        fn.push_back(0.0, 1.0);
+        for (const auto& h : ois) {
+            const double ti = ir::year_fraction(asof, h->maturity(), disc_cfg.dc);
+            if (!(ti > 0.0)) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "bootstrap_curves_jointly: non-positive pillar time.");
+            }
+            auto rr = dn.push_back(ti, std::exp(-h->market_quote() * ti));
+            if (!rr.has_value()) return rr.error();
+        }
+        for (const auto& h : fwh) {
+            if (!dynamic_cast<const FraHelper*>(h.get()) && !dynamic_cast<const IrsHelper*>(h.get())) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "bootstrap_curves_jointly: unsupported helper type (not FRA/IRS).");
+            }
+            const double ti = ir::year_fraction(asof, h->maturity(), fwd_cfg.dc);
+            if (!(ti > 0.0)) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "bootstrap_curves_jointly: non-positive pillar time.");
+            }
+            auto rr = fn.push_back(ti, std::exp(-h->market_quote() * ti));
+            if (!rr.has_value()) return rr.error();
+        }
+
+        auto disc = std::make_shared<PiecewiseDiscountCurve>(asof, solve_config(disc_cfg));
+        auto fwd = std::make_shared<PiecewiseForwardCurve>(asof, solve_config(fwd_cfg));
+
+        // Unknowns x = (disc nodes 1..nd, fwd nodes 1..nf)
+        std::vector<double> x(n);
+        for (std::size_t i = 0; i < nd; ++i) x[i] = dn.v[i + 1];
+        for (std::size_t i = 0; i < nf; ++i) x[nd + i] = fn.v[i + 1];
+
+        auto set_curves = [&](const std::vector<double>& xv) -> ir::Result<int> {
+            for (std::size_t i = 0; i < nd; ++i) dn.v[i + 1] = xv[i];
+            for (std::size_t i = 0; i < nf; ++i) fn.v[i + 1] = xv[nd + i];
+            auto okd = disc->set_nodes(dn);
+            if (!okd.has_value()) return okd.error();
+            return fwd->set_nodes(fn);
+            };
+
+        std::vector<double> gd(nd + 1), gf(nf + 1);
+
+        // Residuals r = implied - quote; if jac is given, also the Jacobian rows.
+        auto evaluate = [&](std::vector<double>& r, ir::utils::SparseMatrix* jac) -> ir::Result<int> {
+            const std::span<double> sd = jac ? std::span<double>(gd) : std::span<double>{};
+            const std::span<double> sf = jac ? std::span<double>(gf) : std::span<double>{};
+
+            for (std::size_t i = 0; i < nd; ++i) {
+                auto imp = ois[i]->implied_par_rate(*disc, sd);
+                if (!imp.has_value()) return imp.error();
+                r[i] = imp.value() - ois[i]->market_quote();
+                if (jac) {
+                    for (std::size_t j = 1; j <= nd; ++j) jac->push(j - 1, gd[j]);
+                    jac->end_row();
+                }
+            }
+            for (std::size_t i = 0; i < nf; ++i) {
+                const auto* fra = dynamic_cast<const FraHelper*>(fwh[i].get());
+                const auto* irs = dynamic_cast<const IrsHelper*>(fwh[i].get());
+
+                auto imp = fra ? fra->implied_fra_rate(*fwd, sf)
+                    : irs->implied_par_rate(*disc, *fwd, sd, sf);
+                if (!imp.has_value()) return imp.error();
+                r[nd + i] = imp.value() - fwh[i]->market_quote();
+                if (jac) {
+                    if (irs) {
+                        for (std::size_t j = 1; j <= nd; ++j) jac->push(j - 1, gd[j]);
+                    }
+                    for (std::size_t j = 1; j <= nf; ++j) jac->push(nd + j - 1, gf[j]);
+                    jac->end_row();
+                }
+            }
+            return 0;
+            };
+
+        auto max_abs = [](const std::vector<double>& r) {
+            double m = 0.0;
+            for (double v : r) m = std::max(m, std::fabs(v));
+            return m;
+            };
+
+        JointBootstrapResult out;
+        std::vector<double> r(n), r_trial(n), x_trial(n);
+
+        {
+            auto ok = set_curves(x);
             if (!ok.has_value()) return ok.error();
         }
 
-        return fwd;
+        for (int it = 0; ; ++it) {
+            ir::utils::SparseMatrix jac(n, n);
+            auto ev = evaluate(r, &jac);
+            if (!ev.has_value()) return ev.error();
+
+            const double err = max_abs(r);
+            if (!std::isfinite(err)) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "bootstrap_curves_jointly: non-finite residual.");
+            }
+            if (err <= opts.solver.tol_abs || it >= opts.solver.max_iter) {
+                if (err > opts.solver.tol_abs) {
+                    return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                        "bootstrap_curves_jointly: Newton did not converge.");
+                }
+                out.jacobian = std::move(jac);
+                out.iterations = it;
+                out.max_abs_residual = err;
+                break;
+            }
+
+            // Newton step: J dx = -r
+            std::vector<double> rhs(n);
+            for (std::size_t i = 0; i < n; ++i) rhs[i] = -r[i];
+            auto dx = ir::utils::solve(jac, std::move(rhs));
+            if (!dx.has_value()) return dx.error();
+
+            // Backtrack until nodes stay in [df_min, df_max] and the residual decreases
+            double lambda = 1.0;
+            bool accepted = false;
+            for (int k = 0; k < 30 && !accepted; ++k, lambda *= 0.5) {
+                bool in_range = true;
+                for (std::size_t i = 0; i < n; ++i) {
+                    x_trial[i] = x[i] + lambda * dx.value()[i];
+                    if (!(x_trial[i] >= opts.df_min && x_trial[i] <= opts.df_max)) in_range = false;
+                }
+                if (!in_range) continue;
+                if (!set_curves(x_trial).has_value()) continue;
+                if (!evaluate(r_trial, nullptr).has_value()) continue;
+                accepted = max_abs(r_trial) < err;
+            }
+            if (!accepted) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "bootstrap_curves_jointly: line search failed.");
+            }
+            x = x_trial;
+        }
+
+        auto final_disc = finalize_curve(std::move(disc), asof, disc_cfg);
+        if (!final_disc.has_value()) return final_disc.error();
+        auto final_fwd = finalize_curve(std::move(fwd), asof, fwd_cfg);
+        if (!final_fwd.has_value()) return final_fwd.error();
+
+        out.discount = std::move(final_disc.value());
+        out.forward = std::move(final_fwd.value());
+        return out;
     }
 
 } // namespace ir::market
@@ -1,89 +1,400 @@
 #include "ir/market/curves.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <tuple>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "ir/core/error.hpp"
 #include "ir/utils/interpolation.hpp"
 #include "ir/utils/piecewise_nodes.hpp"
 
 namespace ir::market {
 
+    // Shared by both piecewise curves: append to nodes and keep the kernel in sync.
+    // The kernel evaluates once it has 2 points.
+    static ir::Result<int> push_node_impl(ir::utils::Nodes1D& nodes,
+        ir::utils::LogLinearKernel& kernel,
+        double t, double v) {
+        if (!(v > 0.0)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "push_node: node value must be > 0.");
+        }
+        auto ok = nodes.push_back(t, v);
+        if (!ok.has_value()) return ok;
+
+        return kernel.push_back(t, v);
+    }
+
+    static ir::Result<int> set_last_value_impl(ir::utils::Nodes1D& nodes,
+        ir::utils::LogLinearKernel& kernel,
+        double v) {
+        if (!(v > 0.0)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "set_last_value: node value must be > 0.");
+        }
+        auto ok = nodes.set_last_value(v);
+        if (!ok.has_value()) return ok;
+
+        return kernel.set_last_value(v);
+    }
+
+    // In-place update of node i; the date cache follows over the node's support.
+    static ir::Result<int> set_node_value_impl(ir::utils::Nodes1D& nodes,
+        ir::utils::LogLinearKernel& kernel,
+        DateCache& cache,
+        std::size_t i, double v) {
+        if (!(v > 0.0)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "set_node_value: node value must be > 0.");
+        }
+        if (i >= nodes.v.size()) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "set_node_value: node index out of range.");
+        }
+        auto ok = kernel.set_value(i, v);
+        if (!ok.has_value()) return ok;
+        nodes.v[i] = v;
+
+        // Values are flat beyond the last node, so it moves everything after t(n-2)
+        const double lo = (i == 0) ? -std::numeric_limits<double>::infinity() : nodes.t[i - 1];
+        const double hi = (i + 1 == nodes.t.size()) ? std::numeric_limits<double>::infinity() : nodes.t[i + 1];
+        cache.refresh_values(kernel, lo, hi);
+        return 0;
+    }
+
+    // Kernel batch evaluation with the curve convention value(t <= 0) = 1.
+    static void batch_impl(const ir::utils::LogLinearKernel& kernel,
+        std::span<const double> t, std::span<double> out, const char* who) {
+        if (t.size() != out.size()) {
+            throw std::runtime_error(std::string(who) + ": input and output sizes differ.");
+        }
+        if (!kernel.ready()) {
+            throw std::runtime_error(std::string(who) + ": curve has no nodes/interpolator.");
+        }
+        kernel.values(t, out);
+        for (std::size_t i = 0; i < t.size(); ++i) {
+            if (t[i] <= 0.0) out[i] = 1.0;
+        }
+    }
+
+    // =============================
+    // DateCache
+    // =============================
+
+    // t tables keyed by (asof serial, dc, days). Curves hold shared_ptrs; the registry
+    // only keeps weak references, so a table is freed with the last curve using it and
+    // its entry is dropped on the next miss.
+    static std::shared_ptr<const std::vector<double>> shared_time_table(const ir::Date& asof,
+        ir::DayCount dc, int days) {
+        using Key = std::tuple<long long, int, int>;
+        static std::mutex mtx;
+        static std::map<Key, std::weak_ptr<const std::vector<double>>> registry;
+
+        const Key key{ asof.raw().time_since_epoch().count(), static_cast<int>(dc), days };
+        std::lock_guard<std::mutex> lock(mtx);
+        if (auto it = registry.find(key); it != registry.end()) {
+            if (auto sp = it->second.lock()) return sp;
+        }
+
+        auto table = std::make_shared<std::vector<double>>(static_cast<std::size_t>(days));
+        for (int i = 0; i < days; ++i) {
+            (*table)[static_cast<std::size_t>(i)] = ir::year_fraction(asof, asof + std::chrono::days{ i }, dc);
+        }
+        // A miss already costs O(days), so sweep tables whose curves are all gone here
+        std::erase_if(registry, [](const auto& kv) { return kv.second.expired(); });
+        registry[key] = table;
+        return table;
+    }
+
+    void DateCache::init(const ir::Date& asof, ir::DayCount dc, int days) {
+        v_.clear();
+        t_ = days > 0 ? shared_time_table(asof, dc, days) : nullptr;
+    }
+
+    void DateCache::rebuild_values(const ir::utils::LogLinearKernel& kernel) {
+        if (!t_) return;
+        v_.resize(t_->size());
+        batch_impl(kernel, *t_, v_, "DateCache::rebuild_values");
+    }
+
+    bool DateCache::adopt_values(std::span<const double> v, const ir::utils::LogLinearKernel& kernel) {
+        v_.clear();
+        if (!t_ || !kernel.ready() || v.size() != t_->size()) return false;
+        // Spot-check the ends and the middle against the kernel
+        for (std::size_t i : { std::size_t{ 0 }, v.size() / 2, v.size() - 1 }) {
+            const double expected = kernel.value((*t_)[i]);
+            if (!(std::abs(v[i] - expected) <= 1e-12 * std::abs(expected))) return false;
+        }
+        v_.assign(v.begin(), v.end());
+        return true;
+    }
+
+    void DateCache::refresh_values(const ir::utils::LogLinearKernel& kernel, double t_lo, double t_hi) {
+        if (!t_ || v_.empty()) return;
+        const auto b = std::lower_bound(t_->begin(), t_->end(), t_lo) - t_->begin();
+        const auto e = std::upper_bound(t_->begin(), t_->end(), t_hi) - t_->begin();
+        if (b >= e) return;
+        const std::span<const double> t(t_->data() + b, static_cast<std::size_t>(e - b));
+        batch_impl(kernel, t, std::span<double>(v_.data() + b, t.size()), "DateCache::refresh_values");
+    }
+
+    std::size_t DateCache::bytes() const {
+        return (t_ ? t_->size() * sizeof(double) : 0) + v_.size() * sizeof(double);
+    }
+
+    // =============================
+    // DiscountCurve
+    // =============================
+
+    void DiscountCurve::df_batch(std::span<const double> t, std::span<double> out) const {
+        if (t.size() != out.size()) {
+            throw std::runtime_error("DiscountCurve::df_batch: input and output sizes differ.");
+        }
+        for (std::size_t i = 0; i < t.size(); ++i) out[i] = df(t[i]);
+    }
+
+    void DiscountCurve::df_batch(std::span<const ir::Date> d, std::span<double> out) const {
+        if (d.size() != out.size()) {
+            throw std::runtime_error("DiscountCurve::df_batch: input and output sizes differ.");
+        }
+        for (std::size_t i = 0; i < d.size(); ++i) out[i] = df(d[i]);
+    }
+
     // =============================
     // PiecewiseDiscountCurve
     // =============================
 
     PiecewiseDiscountCurve::PiecewiseDiscountCurve(const ir::Date& asof, Config cfg)
         : DiscountCurve(asof), cfg_(std::move(cfg)) {
+        date_cache_.init(asof_, cfg_.dc, cfg_.date_cache_days);
     }
 
     ir::Result<int> PiecewiseDiscountCurve::set_nodes(ir::utils::Nodes1D nodes_df) {
-        // Build interpolator on DF
-        ir::utils::Interp1DData data;
-        data.x = nodes_df.t;
-        data.y = nodes_df.v;
-
-        // validate_xy returns Result<void>, but LogLinearInterpolator ctor may also validate.
-        auto vxy = ir::utils::validate_xy(data);
-        if (!vxy.has_value()) return vxy;
+        // Build log-linear kernel on DF (validates ordering and positivity)
+        auto ok = kernel_.assign(nodes_df.t, nodes_df.v);
+        if (!ok.has_value()) return ok;
 
         nodes_df_ = std::move(nodes_df);
-        interp_ = std::make_unique<ir::utils::LogLinearInterpolator>(
-            std::move(data)
-        );
+        if (cfg_.date_cache_values) rebuild_date_cache();
+        return 0;
+    }
 
+    ir::Result<int> PiecewiseDiscountCurve::set_nodes(ir::utils::Nodes1D nodes_df,
+        std::span<const double> date_cache_values) {
+        auto ok = kernel_.assign(nodes_df.t, nodes_df.v);
+        if (!ok.has_value()) return ok;
+
+        nodes_df_ = std::move(nodes_df);
+        if (cfg_.date_cache_values && !date_cache_.adopt_values(date_cache_values, kernel_)) {
+            rebuild_date_cache();
+        }
         return 0;
     }
 
+    ir::Result<int> PiecewiseDiscountCurve::push_node(double t, double df) {
+        date_cache_.clear_values();
+        return push_node_impl(nodes_df_, kernel_, t, df);
+    }
+
+    ir::Result<int> PiecewiseDiscountCurve::set_last_value(double df) {
+        date_cache_.clear_values();
+        return set_last_value_impl(nodes_df_, kernel_, df);
+    }
+
+    ir::Result<int> PiecewiseDiscountCurve::set_node_value(std::size_t i, double v) {
+        return set_node_value_impl(nodes_df_, kernel_, date_cache_, i, v);
+    }
+
+    void PiecewiseDiscountCurve::rebuild_date_cache() {
+        if (cfg_.date_cache_values && kernel_.ready()) date_cache_.rebuild_values(kernel_);
+    }
+
+    double PiecewiseDiscountCurve::time_of(const ir::Date& d) const {
+        const auto i = date_cache_.offset(asof_, d);
+        return i >= 0 ? date_cache_.t(i) : ir::year_fraction(asof_, d, cfg_.dc);
+    }
+
     double PiecewiseDiscountCurve::df(const ir::Date& d) const {
-        const double t = ir::year_fraction(asof_, d, cfg_.dc);
-        return df(t);
+        const auto i = date_cache_.offset(asof_, d);
+        if (i >= 0 && date_cache_.has_values()) return date_cache_.value(i);
+
+        return df(i >= 0 ? date_cache_.t(i) : ir::year_fraction(asof_, d, cfg_.dc));
     }
 
     double PiecewiseDiscountCurve::df(double t) const {
         // Convention: df(0)=1.0
         if (t <= 0.0) return 1.0;
 
-        if (!interp_) {
+        if (!kernel_.ready()) {
             // If called before set_nodes, this is a programmer error.
             throw std::runtime_error("PiecewiseDiscountCurve::df: curve has no nodes/interpolator.");
         }
 
-        const double out = (*interp_)(t);
+        const double out = kernel_.value(t);
         // Safety: should remain positive due to log-linear
         return out;
     }
 
+    double PiecewiseDiscountCurve::df(double t, std::size_t& hint) const {
+        if (t <= 0.0) return 1.0;
+
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseDiscountCurve::df: curve has no nodes/interpolator.");
+        }
+        return kernel_.value(t, hint);
+    }
+
+    void PiecewiseDiscountCurve::df_batch(std::span<const double> t, std::span<double> out) const {
+        batch_impl(kernel_, t, out, "PiecewiseDiscountCurve::df_batch");
+    }
+
+    void PiecewiseDiscountCurve::df_batch(std::span<const ir::Date> d, std::span<double> out) const {
+        if (d.size() != out.size()) {
+            throw std::runtime_error("PiecewiseDiscountCurve::df_batch: input and output sizes differ.");
+        }
+        if (date_cache_.has_values()) {
+            std::size_t misses = 0;
+            for (std::size_t i = 0; i < d.size(); ++i) {
+                const auto k = date_cache_.offset(asof_, d[i]);
+                if (k >= 0) out[i] = date_cache_.value(k);
+                else ++misses;
+            }
+            if (misses == 0) return;
+        }
+        std::vector<double> t(d.size());
+        for (std::size_t i = 0; i < d.size(); ++i) t[i] = time_of(d[i]);
+        batch_impl(kernel_, t, out, "PiecewiseDiscountCurve::df_batch");
+    }
+
+    ir::utils::NodeGradient PiecewiseDiscountCurve::df_gradient(double t) const {
+        // df(0)=1 is fixed: no node dependence
+        if (t <= 0.0) return ir::utils::NodeGradient{ 1.0 };
+
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseDiscountCurve::df_gradient: curve has no nodes/interpolator.");
+        }
+        return kernel_.value_and_gradient(t);
+    }
+
+    ir::utils::NodeGradient PiecewiseDiscountCurve::df_gradient(double t, std::size_t& hint) const {
+        if (t <= 0.0) return ir::utils::NodeGradient{ 1.0 };
+
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseDiscountCurve::df_gradient: curve has no nodes/interpolator.");
+        }
+        return kernel_.value_and_gradient(t, hint);
+    }
+
+    ir::utils::NodeGradient PiecewiseDiscountCurve::df_gradient(const ir::Date& d) const {
+        return df_gradient(time_of(d));
+    }
+
     // =============================
     // PiecewiseForwardCurve (pseudo-discount curve)
     // =============================
 
     PiecewiseForwardCurve::PiecewiseForwardCurve(const ir::Date& asof, Config cfg)
         : ForwardCurve(asof), cfg_(std::move(cfg)) {
+        date_cache_.init(asof_, cfg_.dc, cfg_.date_cache_days);
     }
 
     ir::Result<int> PiecewiseForwardCurve::set_nodes(ir::utils::Nodes1D nodes_pf) {
-        ir::utils::Interp1DData data;
-        data.x = nodes_pf.t;
-        data.y = nodes_pf.v;
-
-        auto vxy = ir::utils::validate_xy(data);
-        if (!vxy.has_value()) return vxy;
+        auto ok = kernel_.assign(nodes_pf.t, nodes_pf.v);
+        if (!ok.has_value()) return ok;
 
         nodes_pf_ = std::move(nodes_pf);
-        interp_ = std::make_unique<ir::utils::LogLinearInterpolator>(
-            std::move(data));
+        if (cfg_.date_cache_values) rebuild_date_cache();
+        return 0;
+    }
 
+    ir::Result<int> PiecewiseForwardCurve::set_nodes(ir::utils::Nodes1D nodes_pf,
+        std::span<const double> date_cache_values) {
+        auto ok = kernel_.assign(nodes_pf.t, nodes_pf.v);
+        if (!ok.has_value()) return ok;
+
+        nodes_pf_ = std::move(nodes_pf);
+        if (cfg_.date_cache_values && !date_cache_.adopt_values(date_cache_values, kernel_)) {
+            rebuild_date_cache();
+        }
         return 0;
     }
 
+    ir::Result<int> PiecewiseForwardCurve::push_node(double t, double pf) {
+        date_cache_.clear_values();
+        return push_node_impl(nodes_pf_, kernel_, t, pf);
+    }
+
+    ir::Result<int> PiecewiseForwardCurve::set_last_value(double pf) {
+        date_cache_.clear_values();
+        return set_last_value_impl(nodes_pf_, kernel_, pf);
+    }
+
+    ir::Result<int> PiecewiseForwardCurve::set_node_value(std::size_t i, double v) {
+        return set_node_value_impl(nodes_pf_, kernel_, date_cache_, i, v);
+    }
+
+    void PiecewiseForwardCurve::rebuild_date_cache() {
+        if (cfg_.date_cache_values && kernel_.ready()) date_cache_.rebuild_values(kernel_);
+    }
+
+    double PiecewiseForwardCurve::pf(const ir::Date& d) const {
+        const auto i = date_cache_.offset(asof_, d);
+        if (i >= 0 && date_cache_.has_values()) return date_cache_.value(i);
+
+        return pf(i >= 0 ? date_cache_.t(i) : ir::year_fraction(asof_, d, cfg_.dc));
+    }
+
     double PiecewiseForwardCurve::pf(double t) const {
         if (t <= 0.0) return 1.0;
 
-        if (!interp_) {
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseForwardCurve::pf: curve has no nodes/interpolator.");
+        }
+        return kernel_.value(t);
+    }
+
+    double PiecewiseForwardCurve::pf(double t, std::size_t& hint) const {
+        if (t <= 0.0) return 1.0;
+
+        if (!kernel_.ready()) {
             throw std::runtime_error("PiecewiseForwardCurve::pf: curve has no nodes/interpolator.");
         }
-        return (*interp_)(t);
+        return kernel_.value(t, hint);
+    }
+
+    void PiecewiseForwardCurve::pf_batch(std::span<const double> t, std::span<double> out) const {
+        batch_impl(kernel_, t, out, "PiecewiseForwardCurve::pf_batch");
+    }
+
+    ir::utils::NodeGradient PiecewiseForwardCurve::pf_gradient(double t) const {
+        if (t <= 0.0) return ir::utils::NodeGradient{ 1.0 };
+
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseForwardCurve::pf_gradient: curve has no nodes/interpolator.");
+        }
+        return kernel_.value_and_gradient(t);
+    }
+
+    ir::utils::NodeGradient PiecewiseForwardCurve::pf_gradient(double t, std::size_t& hint) const {
+        if (t <= 0.0) return ir::utils::NodeGradient{ 1.0 };
+
+        if (!kernel_.ready()) {
+            throw std::runtime_error("PiecewiseForwardCurve::pf_gradient: curve has no nodes/interpolator.");
+        }
+        return kernel_.value_and_gradient(t, hint);
+    }
+
+    ir::utils::NodeGradient PiecewiseForwardCurve::pf_gradient(const ir::Date& d) const {
+        const auto i = date_cache_.offset(asof_, d);
+        return pf_gradient(i >= 0 ? date_cache_.t(i) : ir::year_fraction(asof_, d, cfg_.dc));
     }
 
     double PiecewiseForwardCurve::forward_rate(const ir::Date& start,
@@ -91,17 +402,14 @@ namespace ir::market {
         ir::DayCount dc) const {
         // Compute forward over [start,end] via pseudo DFs:
         // F = (P_f(t1)/P_f(t2) - 1) / tau
-        const double t1 = ir::year_fraction(asof_, start, cfg_.dc);
-        const double t2 = ir::year_fraction(asof_, end, cfg_.dc);
-
         const double tau = ir::year_fraction(start, end, dc);
         if (tau <= 0.0) {
             // You can throw or return 0; throwing is safer to detect bugs.
             throw std::runtime_error("PiecewiseForwardCurve::forward_rate: non-positive accrual tau.");
         }
 
-        const double p1 = pf(t1);
-        const double p2 = pf(t2);
+        const double p1 = pf(start);
+        const double p2 = pf(end);
 
         return (p1 / p2 - 1.0) / tau;
     }
@@ -5,6 +5,13 @@
 
 namespace ir::market {
 
+    MarketData MarketData::overlay(const MarketData& base) {
+        MarketData md(base.asof_);
+        md.fixings_ = base.fixings_;
+        md.base_ = &base;
+        return md;
+    }
+
     // -------------------- Curves --------------------
 
     void MarketData::set_discount_curve(const ir::CurveId& id,
@@ -25,6 +32,7 @@ namespace ir::market {
 
     const DiscountCurve& MarketData::discount_curve(const ir::CurveId& id) const {
         auto it = discount_.find(id.value);
+        if (it == discount_.end() && base_) return base_->discount_curve(id);
         if (it == discount_.end() || !it->second) {
             throw std::out_of_range("MarketData::discount_curve: curve id not found: " + id.value);
         }
@@ -33,12 +41,35 @@ namespace ir::market {
 
     const ForwardCurve& MarketData::forward_curve(const ir::CurveId& id) const {
         auto it = forward_.find(id.value);
+        if (it == forward_.end() && base_) return base_->forward_curve(id);
         if (it == forward_.end() || !it->second) {
             throw std::out_of_range("MarketData::forward_curve: curve id not found: " + id.value);
         }
         return *(it->second);
     }
 
+    std::vector<ir::CurveId> MarketData::discount_curve_ids() const {
+        std::vector<ir::CurveId> out;
+        if (base_) {
+            for (auto& id : base_->discount_curve_ids()) {
+                if (!discount_.contains(id.value)) out.push_back(std::move(id));
+            }
+        }
+        for (const auto& [id, c] : discount_) out.push_back(ir::CurveId{ id });
+        return out;
+    }
+
+    std::vector<ir::CurveId> MarketData::forward_curve_ids() const {
+        std::vector<ir::CurveId> out;
+        if (base_) {
+            for (auto& id : base_->forward_curve_ids()) {
+                if (!forward_.contains(id.value)) out.push_back(std::move(id));
+            }
+        }
+        for (const auto& [id, c] : forward_) out.push_back(ir::CurveId{ id });
+        return out;
+    }
+
     // -------------------- Quotes --------------------
 
     void MarketData::set_quote(const QuoteId& id, Quote q) {
@@ -47,7 +78,7 @@ namespace ir::market {
 
     std::optional<Quote> MarketData::quote(const QuoteId& id) const {
         auto it = quotes_.find(id);
-        if (it == quotes_.end()) return std::nullopt;
+        if (it == quotes_.end()) return base_ ? base_->quote(id) : std::nullopt;
         return it->second;
     }
 
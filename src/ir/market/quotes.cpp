@@ -1,24 +1,124 @@
 #include "ir/market/quotes.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cmath>
+#include <limits>
 #include <string>
+#include <utility>
 
 namespace ir::market {
 
-	std::string FixingStore::key(const ir::IndexId& index, const ir::Date& d) {
-		// Deterministic, easy-to-debug key.
-		// Requires Date::to_iso() in your core/date.hpp
-		return index.value + "|" + d.to_iso();
-	}
+	static constexpr double kMissing = std::numeric_limits<double>::quiet_NaN();
 
 	void FixingStore::add(const ir::IndexId& index, const ir::Date& d, double fixing) {
-		fixings_[key(index, d)] = fixing;
+		auto [it, inserted] = handles_.try_emplace(index.value, static_cast<Handle>(series_.size()));
+		if (inserted) series_.emplace_back();
+		Series& s = series_[it->second];
+
+		const long long day = serial(d);
+		if (s.size() == 0) {
+			if (std::isnan(fixing)) return;
+			s.first_day = day;
+			s.values.assign(s.head + 1, kMissing);
+			s.values[s.head] = fixing;
+			return;
+		}
+
+		if (day < s.first_day) {
+			if (std::isnan(fixing)) return;
+			const auto need = static_cast<std::size_t>(s.first_day - day);
+			if (need > s.head) {
+				// Regrow with at least as much free room in front as there is history
+				const std::size_t room = std::max(need, s.size());
+				std::vector<double> grown(room + s.size(), kMissing);
+				std::copy(s.values.begin() + static_cast<std::ptrdiff_t>(s.head), s.values.end(),
+					grown.begin() + static_cast<std::ptrdiff_t>(room));
+				s.values = std::move(grown);
+				s.head = room;
+			}
+			s.head -= need;
+			s.first_day = day;
+		}
+		const auto i = s.head + static_cast<std::size_t>(day - s.first_day);
+		if (i >= s.values.size()) {
+			if (std::isnan(fixing)) return;
+			s.values.resize(i + 1, kMissing);
+		}
+		s.values[i] = fixing;
+	}
+
+	FixingStore::Handle FixingStore::handle(const ir::IndexId& index) const {
+		const auto it = handles_.find(index.value);
+		return it == handles_.end() ? kNoIndex : it->second;
+	}
+
+	std::optional<double> FixingStore::get(Handle h, const ir::Date& d) const {
+		if (h >= series_.size()) return std::nullopt;
+		const Series& s = series_[h];
+
+		const long long i = serial(d) - s.first_day;
+		if (i < 0 || i >= static_cast<long long>(s.size())) return std::nullopt;
+
+		const double v = s.values[s.head + static_cast<std::size_t>(i)];
+		if (std::isnan(v)) return std::nullopt;
+		return v;
 	}
 
 	std::optional<double> FixingStore::get(const ir::IndexId& index, const ir::Date& d) const {
-		const auto k = key(index, d);
-		const auto it = fixings_.find(k);
-		if (it == fixings_.end()) return std::nullopt;
-		return it->second;
+		return get(handle(index), d);
+	}
+
+	std::span<const double> FixingStore::get_range(Handle h, const ir::Date& d0, const ir::Date& d1) const {
+		if (h >= series_.size() || !(d0 < d1)) return {};
+		const Series& s = series_[h];
+
+		const long long i0 = serial(d0) - s.first_day;
+		const long long i1 = serial(d1) - s.first_day;
+		if (i0 < 0 || i1 > static_cast<long long>(s.size())) return {};
+
+		return s.days().subspan(static_cast<std::size_t>(i0),
+			static_cast<std::size_t>(i1 - i0));
+	}
+
+	void FixingStore::add_series(const ir::IndexId& index, const ir::Date& first, std::span<const double> per_day) {
+		// Trim leading/trailing gaps so the stored history starts and ends on a fixing
+		std::size_t b = 0;
+		std::size_t e = per_day.size();
+		while (b < e && std::isnan(per_day[b])) ++b;
+		while (e > b && std::isnan(per_day[e - 1])) --e;
+		if (b == e) return;
+
+		auto [it, inserted] = handles_.try_emplace(index.value, static_cast<Handle>(series_.size()));
+		if (inserted) series_.emplace_back();
+		Series& s = series_[it->second];
+
+		if (s.size() == 0) {
+			s.first_day = serial(first) + static_cast<long long>(b);
+			s.head = 0;
+			s.values.assign(per_day.begin() + b, per_day.begin() + e);
+			return;
+		}
+		for (std::size_t i = b; i < e; ++i) {
+			if (!std::isnan(per_day[i])) add(index, first + std::chrono::days{ static_cast<long long>(i) }, per_day[i]);
+		}
+	}
+
+	std::vector<ir::IndexId> FixingStore::indices() const {
+		std::vector<ir::IndexId> out(series_.size());
+		for (const auto& [name, h] : handles_) out[h] = ir::IndexId{ name };
+		return out;
+	}
+
+	ir::Date FixingStore::first_date(Handle h) const {
+		if (h >= series_.size()) return ir::Date{};
+		return ir::Date{ ir::Date::sys_days{ std::chrono::days{ series_[h].first_day } } };
+	}
+
+	std::span<const double> FixingStore::history(Handle h) const {
+		if (h >= series_.size()) return {};
+		return series_[h].days();
 	}
 
 } // namespace ir::market
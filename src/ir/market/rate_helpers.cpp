@@ -1,9 +1,13 @@
 #include "ir/market/rate_helpers.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "ir/core/date.hpp"
 #include "ir/core/error.hpp"
+#include "ir/core/schedule_cache.hpp"
 #include "ir/market/curves.hpp"
 
 namespace ir::market {
@@ -23,7 +27,25 @@ namespace ir::market {
         }
     }
 
-    static ir::Result<ir::Schedule> make_leg_schedule(const ir::Date& start,
+    // Gradient outputs: either empty (not requested) or one entry per curve node.
+    static ir::Result<int> reset_gradient(std::span<double> g, std::size_t n_nodes, const char* who) {
+        if (g.empty()) return 0;
+        if (g.size() != n_nodes) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                std::string(who) + ": gradient size does not match number of curve nodes.");
+        }
+        std::fill(g.begin(), g.end(), 0.0);
+        return 0;
+    }
+
+    static void accumulate(std::span<double> g, const ir::utils::NodeGradient& ng, double scale) {
+        if (g.empty()) return;
+        g[ng.i0] += scale * ng.d0;
+        g[ng.i1] += scale * ng.d1;
+    }
+
+    // The cached schedule itself, shared with every other helper on the same grid
+    static ir::Result<std::shared_ptr<const ir::Schedule>> make_leg_schedule(const ir::Date& start,
         const ir::Date& end,
         const ir::Tenor& tenor,
         const ir::Calendar& cal,
@@ -38,7 +60,7 @@ namespace ir::market {
         //sc.stub = ir::StubType::None;
         sc.end_of_month = false;
 
-        return ir::make_schedule(sc);
+        return ir::ScheduleCache::global().get(sc);
     }
 
     // ============================
@@ -46,27 +68,53 @@ namespace ir::market {
     // ============================
     
 
-    ir::Result<double> OisSwapHelper::implied_par_rate(const PiecewiseDiscountCurve& disc) const {
-        // Fixed leg schedule
-        auto ten = tenor_from_frequency(cfg_.fixed_freq);
-        if (!ten.has_value()) return ten.error();
+    ir::Result<int> OisSwapHelper::ensure_cache(const PiecewiseDiscountCurve& disc) const {
+        if (!cache_.has_schedule) {
+            // Fixed leg schedule
+            auto ten = tenor_from_frequency(cfg_.fixed_freq);
+            if (!ten.has_value()) return ten.error();
 
-        auto sched = make_leg_schedule(start_, end_, ten.value(), cfg_.calendar, cfg_.bdc);
-        if (!sched.has_value()) return sched.error();
+            auto sched = make_leg_schedule(start_, end_, ten.value(), cfg_.calendar, cfg_.bdc);
+            if (!sched.has_value()) return sched.error();
 
-        const auto& dates = sched.value().dates;
-        if (dates.size() < 2) {
-            return ir::Error::make(ir::ErrorCode::ScheduleError,
-                "OisSwapHelper: schedule has < 2 dates.");
+            const auto& dates = sched.value()->dates;
+            if (dates.size() < 2) {
+                return ir::Error::make(ir::ErrorCode::ScheduleError,
+                    "OisSwapHelper: schedule has < 2 dates.");
+            }
+
+            cache_.pay_dates.assign(dates.begin() + 1, dates.end());
+            cache_.tau.resize(dates.size() - 1);
+            for (std::size_t i = 1; i < dates.size(); ++i) {
+                cache_.tau[i - 1] = ir::year_fraction(dates[i - 1], dates[i], cfg_.fixed_dc);
+            }
+            cache_.has_schedule = true;
         }
 
-        // Annuity = sum DF(t_i) * tau_{i-1,i}
+        const auto& cc = disc.config();
+        if (!cache_.has_times || !(cache_.asof == disc.asof()) || cache_.dc != cc.dc) {
+            cache_.pay_t.resize(cache_.pay_dates.size());
+            for (std::size_t i = 0; i < cache_.pay_dates.size(); ++i) {
+                cache_.pay_t[i] = ir::year_fraction(disc.asof(), cache_.pay_dates[i], cc.dc);
+            }
+            cache_.t_start = ir::year_fraction(disc.asof(), start_, cc.dc);
+            cache_.t_end = ir::year_fraction(disc.asof(), end_, cc.dc);
+            cache_.asof = disc.asof();
+            cache_.dc = cc.dc;
+            cache_.has_times = true;
+        }
+        return 0;
+    }
+
+    ir::Result<double> OisSwapHelper::implied_par_rate(const PiecewiseDiscountCurve& disc) const {
+        auto ok = ensure_cache(disc);
+        if (!ok.has_value()) return ok.error();
+
+        // Annuity = sum DF(t_i) * tau_{i-1,i}; pay times are increasing
         double annuity = 0.0;
-        for (std::size_t i = 1; i < dates.size(); ++i) {
-            const auto& d0 = dates[i - 1];
-            const auto& d1 = dates[i];
-            const double tau = ir::year_fraction(d0, d1, cfg_.fixed_dc);
-            annuity += disc.df(d1) * tau;
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < cache_.pay_t.size(); ++i) {
+            annuity += disc.df(cache_.pay_t[i], hint) * cache_.tau[i];
         }
 
         if (!(annuity > 0.0)) {
@@ -76,10 +124,49 @@ namespace ir::market {
 
         // Float PV for par OIS (simplified): DF(start) - DF(end)
         // Works for standard par swap with no spreads, no stubs complexity.
-        const double numer = disc.df(start_) - disc.df(end_);
+        const double numer = disc.df(cache_.t_start) - disc.df(cache_.t_end);
         return numer / annuity;
     }
 
+    ir::Result<double> OisSwapHelper::implied_par_rate(const PiecewiseDiscountCurve& disc,
+        std::span<double> d_disc) const {
+        if (d_disc.empty()) return implied_par_rate(disc);
+
+        auto ok = ensure_cache(disc);
+        if (!ok.has_value()) return ok.error();
+        auto g = reset_gradient(d_disc, disc.nodes().t.size(), "OisSwapHelper");
+        if (!g.has_value()) return g.error();
+
+        // Single pass over the curve: keep per-date gradients, scale once par is known.
+        auto& grad = cache_.grad;
+        grad.resize(cache_.pay_t.size());
+
+        double annuity = 0.0;
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < cache_.pay_t.size(); ++i) {
+            grad[i] = disc.df_gradient(cache_.pay_t[i], hint);
+            annuity += grad[i].value * cache_.tau[i];
+        }
+        if (!(annuity > 0.0)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "OisSwapHelper: non-positive annuity.");
+        }
+
+        const auto g_start = disc.df_gradient(cache_.t_start);
+        const auto g_end = disc.df_gradient(cache_.t_end);
+        const double inv_a = 1.0 / annuity;
+        const double par = (g_start.value - g_end.value) * inv_a;
+
+        // par = N / A  =>  dpar = (dN - par * dA) / A
+        for (std::size_t i = 0; i < grad.size(); ++i) {
+            accumulate(d_disc, grad[i], -par * cache_.tau[i] * inv_a);
+        }
+        accumulate(d_disc, g_start, inv_a);
+        accumulate(d_disc, g_end, -inv_a);
+
+        return par;
+    }
+
     // ============================
     // FraHelper
     // ============================
@@ -95,56 +182,184 @@ namespace ir::market {
         return r;
     }
 
+    ir::Result<double> FraHelper::implied_fra_rate(const PiecewiseForwardCurve& fwd,
+        std::span<double> d_fwd) const {
+        auto r = implied_fra_rate(fwd);
+        if (!r.has_value()) return r;
+
+        auto g = reset_gradient(d_fwd, fwd.nodes().t.size(), "FraHelper");
+        if (!g.has_value()) return g.error();
+        if (d_fwd.empty()) return r;
+
+        // r = (P1/P2 - 1) / tau
+        const double tau = ir::year_fraction(start_, end_, cfg_.dc);
+        const auto g1 = fwd.pf_gradient(ir::year_fraction(fwd.asof(), start_, fwd.config().dc));
+        const auto g2 = fwd.pf_gradient(ir::year_fraction(fwd.asof(), end_, fwd.config().dc));
+
+        accumulate(d_fwd, g1, 1.0 / (g2.value * tau));
+        accumulate(d_fwd, g2, -g1.value / (g2.value * g2.value * tau));
+
+        return r;
+    }
+
     // ============================
     // IrsHelper
     // ============================
 
 
-    ir::Result<double> IrsHelper::implied_par_rate(const PiecewiseDiscountCurve& disc,
+    ir::Result<int> IrsHelper::ensure_cache(const PiecewiseDiscountCurve& disc,
         const PiecewiseForwardCurve& fwd) const {
-        // Fixed leg schedule
-        auto fixTen = tenor_from_frequency(cfg_.fixed_freq);
-        if (!fixTen.has_value()) return fixTen.error();
-        auto fixSched = make_leg_schedule(start_, end_, fixTen.value(), cfg_.calendar, cfg_.bdc);
-        if (!fixSched.has_value()) return fixSched.error();
+        if (!cache_.has_schedule) {
+            // Fixed leg schedule
+            auto fixTen = tenor_from_frequency(cfg_.fixed_freq);
+            if (!fixTen.has_value()) return fixTen.error();
+            auto fixSched = make_leg_schedule(start_, end_, fixTen.value(), cfg_.calendar, cfg_.bdc);
+            if (!fixSched.has_value()) return fixSched.error();
+
+            // Float leg schedule
+            auto fltTen = tenor_from_frequency(cfg_.float_freq);
+            if (!fltTen.has_value()) return fltTen.error();
+            auto fltSched = make_leg_schedule(start_, end_, fltTen.value(), cfg_.calendar, cfg_.bdc);
+            if (!fltSched.has_value()) return fltSched.error();
+
+            const auto& fd = fixSched.value()->dates;
+            const auto& ld = fltSched.value()->dates;
 
-        // Float leg schedule
-        auto fltTen = tenor_from_frequency(cfg_.float_freq);
-        if (!fltTen.has_value()) return fltTen.error();
-        auto fltSched = make_leg_schedule(start_, end_, fltTen.value(), cfg_.calendar, cfg_.bdc);
-        if (!fltSched.has_value()) return fltSched.error();
+            if (fd.size() < 2 || ld.size() < 2) {
+                return ir::Error::make(ir::ErrorCode::ScheduleError,
+                    "IrsHelper: schedule has < 2 dates.");
+            }
 
-        const auto& fd = fixSched.value().dates;
-        const auto& ld = fltSched.value().dates;
+            cache_.fixed_pay.assign(fd.begin() + 1, fd.end());
+            cache_.fixed_tau.resize(fd.size() - 1);
+            for (std::size_t i = 1; i < fd.size(); ++i) {
+                cache_.fixed_tau[i - 1] = ir::year_fraction(fd[i - 1], fd[i], cfg_.fixed_dc);
+            }
 
-        if (fd.size() < 2 || ld.size() < 2) {
-            return ir::Error::make(ir::ErrorCode::ScheduleError,
-                "IrsHelper: schedule has < 2 dates.");
+            for (std::size_t i = 1; i < ld.size(); ++i) {
+                if (!(ir::year_fraction(ld[i - 1], ld[i], cfg_.float_dc) > 0.0)) {
+                    return ir::Error::make(ir::ErrorCode::ScheduleError,
+                        "IrsHelper: non-positive float accrual tau.");
+                }
+            }
+            cache_.float_dates = ld;
+            cache_.has_schedule = true;
         }
 
+        const auto& dc = disc.config();
+        const auto& fc = fwd.config();
+        if (!cache_.has_times
+            || !(cache_.disc_asof == disc.asof()) || cache_.disc_dc != dc.dc
+            || !(cache_.fwd_asof == fwd.asof()) || cache_.fwd_dc != fc.dc) {
+            const auto& fp = cache_.fixed_pay;
+            const auto& ld = cache_.float_dates;
+
+            cache_.fixed_pay_t.resize(fp.size());
+            for (std::size_t i = 0; i < fp.size(); ++i) {
+                cache_.fixed_pay_t[i] = ir::year_fraction(disc.asof(), fp[i], dc.dc);
+            }
+            cache_.float_pay_t.resize(ld.size() - 1);
+            cache_.float_t.resize(ld.size());
+            for (std::size_t i = 0; i < ld.size(); ++i) {
+                cache_.float_t[i] = ir::year_fraction(fwd.asof(), ld[i], fc.dc);
+                if (i > 0) cache_.float_pay_t[i - 1] = ir::year_fraction(disc.asof(), ld[i], dc.dc);
+            }
+
+            cache_.disc_asof = disc.asof();
+            cache_.disc_dc = dc.dc;
+            cache_.fwd_asof = fwd.asof();
+            cache_.fwd_dc = fc.dc;
+            cache_.has_times = true;
+        }
+        return 0;
+    }
+
+    ir::Result<double> IrsHelper::implied_par_rate(const PiecewiseDiscountCurve& disc,
+        const PiecewiseForwardCurve& fwd) const {
+        auto ok = ensure_cache(disc, fwd);
+        if (!ok.has_value()) return ok.error();
+
         // Fixed annuity
         double annuity = 0.0;
-        for (std::size_t i = 1; i < fd.size(); ++i) {
-            const double tau = ir::year_fraction(fd[i - 1], fd[i], cfg_.fixed_dc);
-            annuity += disc.df(fd[i]) * tau;
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < cache_.fixed_pay_t.size(); ++i) {
+            annuity += disc.df(cache_.fixed_pay_t[i], hint) * cache_.fixed_tau[i];
         }
         if (!(annuity > 0.0)) {
             return ir::Error::make(ir::ErrorCode::InvalidArgument,
                 "IrsHelper: non-positive fixed annuity.");
         }
 
-        // Float PV: sum DF(pay) * F(reset,pay) * tau
+        // Float PV: sum DF(pay) * F(reset,pay) * tau, with F * tau = Pf(t0)/Pf(t1) - 1
         double pv_float = 0.0;
-        for (std::size_t i = 1; i < ld.size(); ++i) {
-            const auto& d0 = ld[i - 1];
-            const auto& d1 = ld[i];
-            const double tau = ir::year_fraction(d0, d1, cfg_.float_dc);
-            const double F = fwd.forward_rate(d0, d1, cfg_.float_dc);
-            pv_float += disc.df(d1) * F * tau;
+        std::size_t hint_pf = 0, hint_df = 0;
+        double pf0 = fwd.pf(cache_.float_t[0], hint_pf);
+        for (std::size_t i = 1; i < cache_.float_t.size(); ++i) {
+            const double pf1 = fwd.pf(cache_.float_t[i], hint_pf);
+            pv_float += disc.df(cache_.float_pay_t[i - 1], hint_df) * (pf0 / pf1 - 1.0);
+            pf0 = pf1;
         }
 
         // Par rate = PV_float / annuity
         return pv_float / annuity;
     }
 
+    ir::Result<double> IrsHelper::implied_par_rate(const PiecewiseDiscountCurve& disc,
+        const PiecewiseForwardCurve& fwd,
+        std::span<double> d_disc,
+        std::span<double> d_fwd) const {
+        if (d_disc.empty() && d_fwd.empty()) return implied_par_rate(disc, fwd);
+
+        auto ok = ensure_cache(disc, fwd);
+        if (!ok.has_value()) return ok.error();
+        auto gd = reset_gradient(d_disc, disc.nodes().t.size(), "IrsHelper");
+        if (!gd.has_value()) return gd.error();
+        auto gf = reset_gradient(d_fwd, fwd.nodes().t.size(), "IrsHelper");
+        if (!gf.has_value()) return gf.error();
+
+        // Fixed annuity, keeping per-date gradients until par is known
+        auto& fixed_grad = cache_.fixed_grad;
+        fixed_grad.resize(cache_.fixed_pay_t.size());
+
+        double annuity = 0.0;
+        std::size_t hint = 0;
+        for (std::size_t i = 0; i < cache_.fixed_pay_t.size(); ++i) {
+            fixed_grad[i] = disc.df_gradient(cache_.fixed_pay_t[i], hint);
+            annuity += fixed_grad[i].value * cache_.fixed_tau[i];
+        }
+        if (!(annuity > 0.0)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "IrsHelper: non-positive fixed annuity.");
+        }
+        const double inv_a = 1.0 / annuity;
+
+        // Float PV: sum DF_pay * (P0/P1 - 1); its gradient only needs 1/A
+        double pv_float = 0.0;
+        std::size_t hint_pf = 0, hint_df = 0;
+        auto g0 = fwd.pf_gradient(cache_.float_t[0], hint_pf);
+        for (std::size_t i = 1; i < cache_.float_t.size(); ++i) {
+            const auto g1 = fwd.pf_gradient(cache_.float_t[i], hint_pf);
+            const auto gp = disc.df_gradient(cache_.float_pay_t[i - 1], hint_df);
+            const double ratio = g0.value / g1.value;
+
+            pv_float += gp.value * (ratio - 1.0);
+
+            accumulate(d_disc, gp, (ratio - 1.0) * inv_a);
+            accumulate(d_fwd, g0, gp.value / g1.value * inv_a);
+            accumulate(d_fwd, g1, -gp.value * ratio / g1.value * inv_a);
+
+            g0 = g1;
+        }
+
+        // par = PV_float / A  =>  dpar = (dPV_float - par * dA) / A
+        const double par = pv_float * inv_a;
+        if (!d_disc.empty()) {
+            for (std::size_t i = 0; i < fixed_grad.size(); ++i) {
+                accumulate(d_disc, fixed_grad[i], -par * cache_.fixed_tau[i] * inv_a);
+            }
+        }
+
+        return par;
+    }
+
 } // namespace ir::market
@@ -0,0 +1,295 @@
+#include "ir/pricers/cashflow_plan.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include "ir/core/error.hpp"
+#include "ir/instruments/coupons.hpp"
+
+namespace ir::pricers {
+
+    namespace {
+
+        using ir::instruments::CashflowType;
+        using ir::instruments::Leg;
+        using ir::market::PiecewiseDiscountCurve;
+        using ir::market::PiecewiseForwardCurve;
+
+        ir::Error error(const std::string& what) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "CashflowPlan: " + what);
+        }
+
+        ir::Result<CurveAxis> discount_axis(const ir::market::MarketData& md, const ir::CurveId& id) {
+            try {
+                const auto* c = dynamic_cast<const PiecewiseDiscountCurve*>(&md.discount_curve(id));
+                if (!c) return error("no piecewise discount curve " + id.value);
+                return CurveAxis{ c->asof(), c->config().dc };
+            }
+            catch (const std::exception& e) {
+                return error(e.what());
+            }
+        }
+
+        ir::Result<CurveAxis> forward_axis(const ir::market::MarketData& md, const ir::CurveId& id) {
+            try {
+                const auto* c = dynamic_cast<const PiecewiseForwardCurve*>(&md.forward_curve(id));
+                if (!c) return error("no piecewise forward curve " + id.value);
+                return CurveAxis{ c->asof(), c->config().dc };
+            }
+            catch (const std::exception& e) {
+                return error(e.what());
+            }
+        }
+
+        double time(const CurveAxis& axis, const ir::Date& d) {
+            return ir::year_fraction(axis.asof, d, axis.dc);
+        }
+
+        // Appends one leg; mirrors pv_leg_single_curve / pv_leg_multi_curve
+        ir::Result<int> compile_leg(const Leg& leg,
+            const ir::market::MarketData& md,
+            const PricingContext& ctx,
+            CashflowPlan& plan) {
+            const ir::market::FixingStore& fixings = *md.fixings();
+            const bool single = (ctx.framework == PricingFramework::SingleCurve);
+            const double sgn = leg_sign(leg.direction);
+            const auto leg_index = static_cast<std::uint8_t>(plan.legs++);
+
+            // Axis of a projection curve, looked up on first use
+            auto projection = [&](PlanCurve c) -> ir::Result<const CurveAxis*> {
+                if (single) return &plan.discount_axis;
+                bool& used = (c == PlanCurve::Ibor) ? plan.uses_ibor : plan.uses_rfr;
+                CurveAxis& axis = (c == PlanCurve::Ibor) ? plan.ibor_axis : plan.rfr_axis;
+                if (!used) {
+                    auto a = forward_axis(md, c == PlanCurve::Ibor ? plan.ibor_forward_curve : plan.rfr_forward_curve);
+                    if (!a.has_value()) return a.error();
+                    axis = a.value();
+                    used = true;
+                }
+                return &axis;
+            };
+
+            for (const auto& cfptr : leg.cashflows) {
+                if (!cfptr) continue;
+
+                const auto pay = cfptr->pay_date();
+                if (!(ctx.valuation_date < pay)) continue;
+
+                PlanCurve curve = PlanCurve::None;
+                double t_start = 0.0, t_end = 0.0, tau = 0.0, notional = 0.0, spread = 0.0;
+                double realised = 1.0, known = 0.0;
+
+                switch (cfptr->type()) {
+
+                case CashflowType::Fixed: {
+                    auto amount = cfptr->amount_if_known(&fixings);
+                    if (!amount.has_value()) return error("fixed cashflow amount unknown.");
+                    known = sgn * amount.value();
+                    break;
+                }
+
+                case CashflowType::IborCoupon: {
+                    auto amount = cfptr->amount_if_known(&fixings);
+                    if (amount.has_value()) {
+                        known = sgn * amount.value();
+                        break;
+                    }
+
+                    const auto* cpn = dynamic_cast<const ir::instruments::IborCoupon*>(cfptr.get());
+                    if (!cpn) return error("cashflow type mismatch (IborCoupon).");
+                    auto axis = projection(PlanCurve::Ibor);
+                    if (!axis.has_value()) return axis.error();
+
+                    const auto& obs = cpn->observation();
+                    tau = ir::year_fraction(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
+                    if (!(tau > 0.0)) return error("invalid IBOR accrual year fraction.");
+
+                    curve = PlanCurve::Ibor;
+                    t_start = time(*axis.value(), obs.accrual_start);
+                    t_end = time(*axis.value(), obs.accrual_end);
+                    notional = sgn * cpn->notional();
+                    spread = cpn->spread();
+                    break;
+                }
+
+                case CashflowType::RfrCoupon: {
+                    const auto* cpn = dynamic_cast<const ir::instruments::RfrCompoundCoupon*>(cfptr.get());
+                    if (!cpn) return error("cashflow type mismatch (RfrCompoundCoupon).");
+
+                    const auto& obs = cpn->observation();
+                    tau = ir::year_fraction(obs.start, obs.end, obs.accrual_dc);
+                    if (!(tau > 0.0)) return error("invalid RFR accrual year fraction.");
+
+                    // Realised days before the valuation date, projected days from there on
+                    const ir::Date proj_start = (obs.start < ctx.valuation_date)
+                        ? std::min(ctx.valuation_date, obs.end) : obs.start;
+                    const auto r = ir::instruments::realised_rfr_compound(obs, fixings, proj_start);
+                    if (!r.has_value()) return error("missing historical RFR fixing.");
+
+                    if (!(proj_start < obs.end)) {
+                        known = sgn * (cpn->notional() * (r.value() - 1.0) + cpn->notional() * cpn->spread() * tau);
+                        break;
+                    }
+                    auto axis = projection(PlanCurve::Rfr);
+                    if (!axis.has_value()) return axis.error();
+
+                    curve = PlanCurve::Rfr;
+                    t_start = time(*axis.value(), proj_start);
+                    t_end = time(*axis.value(), obs.end);
+                    notional = sgn * cpn->notional();
+                    spread = cpn->spread();
+                    realised = r.value();
+                    break;
+                }
+
+                default:
+                    return error("unsupported cashflow type.");
+                }
+
+                plan.leg.push_back(leg_index);
+                plan.type.push_back(cfptr->type());
+                plan.curve.push_back(curve);
+                plan.t_pay.push_back(time(plan.discount_axis, pay));
+                plan.t_start.push_back(t_start);
+                plan.t_end.push_back(t_end);
+                plan.tau.push_back(tau);
+                plan.notional.push_back(notional);
+                plan.spread.push_back(spread);
+                plan.realised.push_back(realised);
+                plan.known_amount.push_back(known);
+            }
+            return 0;
+        }
+
+        ir::Result<CashflowPlan> compile(std::span<const Leg* const> legs,
+            const ir::market::MarketData& md,
+            const PricingContext& ctx) {
+            if (md.fixings() == nullptr) return error("MarketData fixings store is null.");
+
+            CashflowPlan plan;
+            plan.framework = ctx.framework;
+            plan.discount_curve = ctx.discount_curve;
+            plan.ibor_forward_curve = ctx.ibor_forward_curve;
+            plan.rfr_forward_curve = ctx.rfr_forward_curve;
+
+            auto axis = discount_axis(md, ctx.discount_curve);
+            if (!axis.has_value()) return axis.error();
+            plan.discount_axis = axis.value();
+
+            for (const Leg* leg : legs) {
+                auto ok = compile_leg(*leg, md, ctx, plan);
+                if (!ok.has_value()) return ok.error();
+            }
+            return plan;
+        }
+
+    } // namespace
+
+    ir::Result<CashflowPlan> compile_plan(const PortfolioTrade& trade,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx) {
+        std::vector<const Leg*> legs;
+        std::visit([&](const auto& p) {
+            using T = std::decay_t<decltype(p)>;
+            if constexpr (std::is_same_v<T, ir::instruments::InterestRateSwap>) {
+                legs = { &p.fixed_leg(), &p.float_leg() };
+            }
+            else if constexpr (std::is_same_v<T, ir::instruments::OisSwap>) {
+                legs = { &p.fixed_leg(), &p.rfr_leg() };
+            }
+            else {
+                legs = { &p };
+            }
+            }, trade.product);
+        return compile(legs, md, trade.ctx ? *trade.ctx : ctx);
+    }
+
+    ir::Result<CashflowPlan> compile_plan(const Leg& leg,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx) {
+        const Leg* legs[] = { &leg };
+        return compile(legs, md, ctx);
+    }
+
+    ir::Result<PlanCurves> plan_curves(const CashflowPlan& plan, const ir::market::MarketData& md) {
+        auto off_axis = [](const ir::CurveId& id) { return error("curve " + id.value + " is not on the plan's time axis."); };
+
+        PlanCurves out;
+        try {
+            out.discount = dynamic_cast<const PiecewiseDiscountCurve*>(&md.discount_curve(plan.discount_curve));
+            if (!out.discount) return error("no piecewise discount curve " + plan.discount_curve.value);
+            if (!(CurveAxis{ out.discount->asof(), out.discount->config().dc } == plan.discount_axis)) {
+                return off_axis(plan.discount_curve);
+            }
+
+            auto forward = [&](const ir::CurveId& id, const CurveAxis& axis) -> ir::Result<const PiecewiseForwardCurve*> {
+                const auto* c = dynamic_cast<const PiecewiseForwardCurve*>(&md.forward_curve(id));
+                if (!c) return error("no piecewise forward curve " + id.value);
+                if (!(CurveAxis{ c->asof(), c->config().dc } == axis)) return off_axis(id);
+                return c;
+            };
+            if (plan.uses_ibor) {
+                auto c = forward(plan.ibor_forward_curve, plan.ibor_axis);
+                if (!c.has_value()) return c.error();
+                out.ibor = c.value();
+            }
+            if (plan.uses_rfr) {
+                auto c = forward(plan.rfr_forward_curve, plan.rfr_axis);
+                if (!c.has_value()) return c.error();
+                out.rfr = c.value();
+            }
+        }
+        catch (const std::exception& e) {
+            return error(e.what());
+        }
+        return out;
+    }
+
+    PricingResult price_plan(const CashflowPlan& plan, const PlanCurves& curves) {
+        const bool single = (plan.framework == PricingFramework::SingleCurve);
+        const PiecewiseDiscountCurve& disc = *curves.discount;
+
+        // Hinted lookups: each leg walks each curve forwards
+        std::size_t disc_hint = 0, ibor_hint = 0, rfr_hint = 0;
+        auto projected = [&](PlanCurve c, double t) {
+            if (single) return disc.df(t, c == PlanCurve::Ibor ? ibor_hint : rfr_hint);
+            return c == PlanCurve::Ibor ? curves.ibor->pf(t, ibor_hint) : curves.rfr->pf(t, rfr_hint);
+        };
+
+        double leg_pv[2] = { 0.0, 0.0 };
+        const std::size_t n = plan.size();
+        for (std::size_t k = 0; k < n; ++k) {
+            double amt = plan.known_amount[k];
+            const PlanCurve c = plan.curve[k];
+            if (c != PlanCurve::None) {
+                const double p0 = projected(c, plan.t_start[k]);
+                const double p1 = projected(c, plan.t_end[k]);
+                const double tau = plan.tau[k];
+                if (c == PlanCurve::Ibor) {
+                    const double fwd = (p0 / p1 - 1.0) / tau;
+                    amt = plan.notional[k] * (fwd + plan.spread[k]) * tau;
+                }
+                else {
+                    amt = plan.notional[k] * (plan.realised[k] * p0 / p1 - 1.0) + plan.notional[k] * plan.spread[k] * tau;
+                }
+            }
+            leg_pv[plan.leg[k]] += amt * disc.df(plan.t_pay[k], disc_hint);
+        }
+
+        PricingResult out;
+        out.pv = leg_pv[0] + leg_pv[1];
+        if (plan.legs == 2) {
+            out.pv_fixed_leg = leg_pv[0];
+            out.pv_float_leg = leg_pv[1];
+        }
+        return out;
+    }
+
+} // namespace ir::pricers
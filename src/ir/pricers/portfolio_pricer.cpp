@@ -0,0 +1,89 @@
+#include "ir/pricers/portfolio_pricer.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ir::pricers {
+
+    // Wraps a single leg result so every trade reports a PricingResult.
+    static ir::Result<PricingResult> leg_as_result(ir::Result<LegPVResult> leg) {
+        if (!leg.has_value()) return leg.error();
+        PricingResult out;
+        out.pv = leg.value().pv;
+        out.lines = std::move(leg.value().lines);
+        return out;
+    }
+
+    template <class Pricer>
+    static ir::Result<PricingResult> price_product(const Pricer& pricer,
+        const PortfolioProduct& product,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx) {
+        return std::visit([&](const auto& p) -> ir::Result<PricingResult> {
+            using T = std::decay_t<decltype(p)>;
+            if constexpr (std::is_same_v<T, ir::instruments::Leg>) {
+                return leg_as_result(pricer.price_leg(p, md, ctx));
+            }
+            else {
+                return pricer.price(p, md, ctx);
+            }
+            }, product);
+    }
+
+    PortfolioPricer::PortfolioPricer(PortfolioOptions opts) : opts_(opts) {
+        if (opts_.threads != 1) {
+            pool_ = std::make_unique<ir::utils::ThreadPool>(opts_.threads);
+            if (pool_->size() == 1) pool_.reset();
+        }
+    }
+
+    std::vector<ir::Result<PricingResult>>
+        PortfolioPricer::price(std::span<const PortfolioTrade> trades,
+            const ir::market::MarketData& md,
+            const PricingContext& ctx) const {
+        std::vector<ir::Result<PricingResult>> out(trades.size(),
+            ir::Error::make(ir::ErrorCode::InvalidArgument, "PortfolioPricer: trade not priced."));
+
+        // keep_lines = false: do not build the lines at all
+        auto without_lines = [&](PricingContext c) {
+            if (!opts_.keep_lines && c.detail == PricingDetail::Cashflows) c.detail = PricingDetail::Aggregates;
+            return c;
+        };
+        const PricingContext portfolio_ctx = without_lines(ctx);
+
+        // Each index is written by exactly one task, so out needs no locking.
+        auto run = [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                try {
+                    std::optional<PricingContext> own;
+                    if (trades[i].ctx && !opts_.keep_lines) own = without_lines(*trades[i].ctx);
+                    const PricingContext& c = own ? *own : trades[i].ctx ? *trades[i].ctx : portfolio_ctx;
+                    out[i] = (c.framework == PricingFramework::SingleCurve)
+                        ? price_product(single_curve_, trades[i].product, md, c)
+                        : price_product(multi_curve_, trades[i].product, md, c);
+                }
+                catch (const std::exception& e) {
+                    out[i] = ir::Error::make(ir::ErrorCode::InvalidArgument,
+                        "PortfolioPricer: trade " + std::to_string(i) + ": " + e.what());
+                }
+            }
+        };
+
+        if (!pool_ || trades.size() <= 1) {
+            run(0, trades.size());
+            return out;
+        }
+
+        // Default grain: ~8 tasks per worker so stealing can even out uneven trades.
+        const std::size_t grain = opts_.grain > 0
+            ? opts_.grain
+            : std::max<std::size_t>(1, trades.size() / (8 * pool_->size()));
+        pool_->parallel_for(trades.size(), grain, run);
+        return out;
+    }
+
+} // namespace ir::pricers
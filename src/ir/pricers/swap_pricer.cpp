@@ -1,14 +1,18 @@
 #include "ir/pricers/swap_pricer.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "ir/core/date.hpp"
 #include "ir/core/error.hpp"
+#include "ir/pricers/leg_pv.hpp"
 
 namespace ir::pricers {
 
@@ -18,6 +22,14 @@ namespace ir::pricers {
         return (dir == ir::instruments::PayReceive::Pay) ? -1.0 : +1.0;
     }
 
+    const char* cashflow_label(ir::instruments::CashflowType type) {
+        switch (type) {
+        case ir::instruments::CashflowType::Fixed: return "FIXED";
+        case ir::instruments::CashflowType::IborCoupon: return "IBOR";
+        default: return "RFR";
+        }
+    }
+
     std::optional<double> signed_amount_if_known(
         const ir::instruments::Cashflow& cf,
         ir::instruments::PayReceive dir,
@@ -83,208 +95,123 @@ namespace ir::pricers {
         return (val < pay);
     }
 
-    static std::optional<double> rfr_amount_single_curve_with_cutoff(
-        const ir::instruments::RfrCompoundCoupon& cf,
-        const ir::market::FixingStore& fixings,
-        const ir::Date& valuation_date,
-        const ir::market::DiscountCurve& disc) {
-
-        const auto& obs = cf.observation();
-        const ir::Date start = obs.start;
-        const ir::Date end = obs.end;
-
-        const double tau_total = ir::year_fraction(start, end, obs.accrual_dc);
-        if (!(tau_total > 0.0)) {
-            return std::nullopt;
-        }
-
-        double compound = 1.0;
-
-        for (ir::Date d = start; d < end; d = d + std::chrono::days{ 1 }) {
-            ir::Date d_next = d + std::chrono::days{ 1 };
-            if (end < d_next) {
-                d_next = end;
-            }
-
-            const double dt = ir::year_fraction(d, d_next, obs.accrual_dc);
-            if (dt < 0.0) {
-                return std::nullopt;
-            }
-
-            double r = 0.0;
-
-            if (d < valuation_date) {
-                auto fx = fixings.get(obs.index, d);
-                if (!fx.has_value()) {
-                    return std::nullopt;
-                }
-                r = fx.value();
-            }
-            else {
-                r = forward_from_discount_curve(disc, d, d_next, obs.accrual_dc);
+    // DFs of the leg's payable cashflows (in leg order), evaluated in one batch call.
+    static std::vector<double> payable_dfs(const ir::instruments::Leg& leg,
+        const ir::market::DiscountCurve& disc,
+        const ir::Date& valuation_date) {
+        std::vector<ir::Date> pay_dates;
+        pay_dates.reserve(leg.cashflows.size());
+        for (const auto& cfptr : leg.cashflows) {
+            if (cfptr && is_payable_after_valuation(cfptr->pay_date(), valuation_date)) {
+                pay_dates.push_back(cfptr->pay_date());
             }
-
-            compound *= (1.0 + r * dt);
         }
-
-        return cf.notional() * (compound - 1.0)
-            + cf.notional() * cf.spread() * tau_total;
+        std::vector<double> dfs(pay_dates.size());
+        disc.df_batch(pay_dates, dfs);
+        return dfs;
     }
 
+    // Single-curve market view for pv_leg_cashflows: IBOR and RFR coupons project
+    // off the discount curve.
+    struct SingleCurveView {
+        const char* who;
+        const ir::market::DiscountCurve& disc;
+        const std::vector<double>& dfs;   // payable_dfs of the leg
+        bool exact_daily{ false };
 
-    static ir::Result<LegPVResult> pv_leg_single_curve(
-        const ir::instruments::Leg& leg,
-        const ir::market::DiscountCurve& disc,
-        const ir::market::FixingStore& fixings,
-        const PricingContext& ctx) {
-
-        LegPVResult out;
-        const double sgn = leg_sign(leg.direction);
-
-        for (const auto& cfptr : leg.cashflows) {
-            if (!cfptr) continue;
-
-            const auto pay = cfptr->pay_date();
-            if (!is_payable_after_valuation(pay, ctx.valuation_date)) continue;
-
-            const double df = disc.df(pay);
-            double amt = 0.0;
-
-            switch (cfptr->type()) {
-
-            case ir::instruments::CashflowType::Fixed: {
-                auto known = cfptr->amount_if_known(&fixings);
-                if (!known.has_value()) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "SingleCurve pricer: fixed cashflow amount unknown.");
-                }
-                amt = known.value();
-                break;
-            }
-
-            case ir::instruments::CashflowType::IborCoupon: {
-                auto known = cfptr->amount_if_known(&fixings);
+        double df(std::size_t k, const ir::Date&) const { return dfs[k]; }
 
-                if (known.has_value()) {
-                    amt = known.value();
-                }
-                else {
-                    auto cpn = std::dynamic_pointer_cast<ir::instruments::IborCoupon>(cfptr);
-                    if (!cpn) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "SingleCurve pricer: cashflow type mismatch (IborCoupon).");
-                    }
-
-                    const auto& obs = cpn->observation();
-                    const double tau =
-                        ir::year_fraction(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
-
-                    if (!(tau > 0.0)) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "SingleCurve pricer: invalid IBOR accrual year fraction.");
-                    }
-
-                    const double fwd =
-                        forward_from_discount_curve(
-                            disc,
-                            obs.accrual_start,
-                            obs.accrual_end,
-                            obs.accrual_dc);
-
-                    amt = cpn->notional() * (fwd + cpn->spread()) * tau;
-                }
-                break;
-            }
+        ir::Result<double> ibor_forward(const ir::instruments::IborObservation& obs, double) const {
+            return forward_from_discount_curve(disc, obs.accrual_start, obs.accrual_end, obs.accrual_dc);
+        }
 
-            case ir::instruments::CashflowType::RfrCoupon: {
-                auto cpn = std::dynamic_pointer_cast<ir::instruments::RfrCompoundCoupon>(cfptr);
-                if (!cpn) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "SingleCurve pricer: cashflow type mismatch (RfrCompoundCoupon).");
+        // Projected days use the forward implied by the discount curve,
+        // (1 + F dt) = DF(d)/DF(d+1), which telescopes to DF(from)/DF(end): two lookups
+        // instead of two per day unless exact_daily.
+        ir::Result<double> rfr_growth(const ir::instruments::RfrObservation& obs, const ir::Date& from) const {
+            if (!exact_daily) return disc.df(from) / disc.df(obs.end);
+
+            // Projected days, day by day (validation path)
+            double growth = 1.0;
+            for (ir::Date d = from; d < obs.end; d = d + std::chrono::days{ 1 }) {
+                ir::Date d_next = d + std::chrono::days{ 1 };
+                if (obs.end < d_next) {
+                    d_next = obs.end;
                 }
 
-                const auto& obs = cpn->observation();
-                const ir::Date start = obs.start;
-                const ir::Date end = obs.end;
-
-                const double tau_total =
-                    ir::year_fraction(start, end, obs.accrual_dc);
-
-                if (!(tau_total > 0.0)) {
+                const double dt = ir::year_fraction(d, d_next, obs.accrual_dc);
+                if (dt < 0.0) {
                     return ir::Error::make(
                         ir::ErrorCode::InvalidArgument,
-                        "SingleCurve pricer: invalid RFR accrual year fraction.");
-                }
-
-                double compound = 1.0;
-
-                for (ir::Date d = start; d < end; d = d + std::chrono::days{ 1 }) {
-                    ir::Date d_next = d + std::chrono::days{ 1 };
-                    if (end < d_next) {
-                        d_next = end;
-                    }
-
-                    const double dt = ir::year_fraction(d, d_next, obs.accrual_dc);
-                    if (dt < 0.0) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "SingleCurve pricer: invalid RFR daily accrual fraction.");
-                    }
-
-                    double r = 0.0;
-
-                    if (d < ctx.valuation_date) {
-                        auto fx = fixings.get(obs.index, d);
-                        if (!fx.has_value()) {
-                            return ir::Error::make(
-                                ir::ErrorCode::InvalidArgument,
-                                "SingleCurve pricer: missing historical RFR fixing.");
-                        }
-                        r = fx.value();
-                    }
-                    else {
-                        r = forward_from_discount_curve(disc, d, d_next, obs.accrual_dc);
-                    }
-
-                    compound *= (1.0 + r * dt);
+                        "SingleCurve pricer: invalid RFR daily accrual fraction.");
                 }
 
-                amt = cpn->notional() * (compound - 1.0)
-                    + cpn->notional() * cpn->spread() * tau_total;
-
-                break;
+                const double r = forward_from_discount_curve(disc, d, d_next, obs.accrual_dc);
+                growth *= (1.0 + r * dt);
             }
-
-            default:
-                return ir::Error::make(
-                    ir::ErrorCode::InvalidArgument,
-                    "SingleCurve pricer: unsupported cashflow type.");
+            return growth;
+        }
+    };
+
+    // Multi-curve market view: IBOR and RFR coupons project off their forward curves
+    // (null when the leg has no coupons of that kind).
+    struct MultiCurveView {
+        const char* who;
+        const std::vector<double>& dfs;
+        const ir::market::ForwardCurve* ibor_fwd{ nullptr };
+        const ir::market::ForwardCurve* rfr_fwd{ nullptr };
+
+        double df(std::size_t k, const ir::Date&) const { return dfs[k]; }
+
+        ir::Result<double> ibor_forward(const ir::instruments::IborObservation& obs, double) const {
+            if (!ibor_fwd) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "MultiCurve pricer: IBOR forward curve is null.");
             }
+            return ibor_fwd->forward_rate(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
+        }
 
-            const double signed_amt = sgn * amt;
-            const double pv = signed_amt * df;
-
-            out.pv += pv;
-
-            CashflowPVLine line;
-            line.pay_date = pay;
-            line.amount = signed_amt;
-            line.df = df;
-            line.pv = pv;
-            line.label = (cfptr->type() == ir::instruments::CashflowType::Fixed) ? "FIXED" :
-                (cfptr->type() == ir::instruments::CashflowType::IborCoupon) ? "IBOR" :
-                "RFR";
-            line.leg_id = leg.leg_id;
-            out.lines.push_back(std::move(line));
+        // One simple forward over [from, end], as RfrCompoundCoupon::amount_if_known
+        ir::Result<double> rfr_growth(const ir::instruments::RfrObservation& obs, const ir::Date& from) const {
+            if (!rfr_fwd) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                    "MultiCurve pricer: RFR forward curve is null.");
+            }
+            const double tau_f = ir::year_fraction(from, obs.end, obs.accrual_dc);
+            return 1.0 + rfr_fwd->forward_rate(from, obs.end, obs.accrual_dc) * tau_f;
         }
+    };
 
+    template <class Curves>
+    static ir::Result<LegPVResult> pv_leg(const ir::instruments::Leg& leg,
+        const ir::market::FixingStore& fixings,
+        const PricingContext& ctx,
+        const Curves& curves,
+        std::size_t payable) {
+
+        LegPVResult out;
+        const bool with_lines = (ctx.detail == PricingDetail::Cashflows);
+        if (with_lines) out.lines.reserve(payable);
+
+        auto pv = pv_leg_cashflows<double>(leg, fixings, ctx.valuation_date, curves,
+            [&](const ir::instruments::Cashflow& cf, double amt, double df, double cf_pv) {
+                if (with_lines) out.lines.push_back(CashflowPVLine{ cf.pay_date(), amt, df, cf_pv, cf.type(), 0 });
+            });
+        if (!pv.has_value()) return pv.error();
+        out.pv = pv.value();
         return out;
     }
 
+    static ir::Result<LegPVResult> pv_leg_single_curve(
+        const ir::instruments::Leg& leg,
+        const ir::market::DiscountCurve& disc,
+        const ir::market::FixingStore& fixings,
+        const PricingContext& ctx) {
+        const std::vector<double> dfs = payable_dfs(leg, disc, ctx.valuation_date);
+        return pv_leg(leg, fixings, ctx,
+            SingleCurveView{ "SingleCurve pricer", disc, dfs, ctx.rfr_exact_daily_projection }, dfs.size());
+    }
+
     static ir::Result<LegPVResult> pv_leg_multi_curve(
         const ir::instruments::Leg& leg,
         const ir::market::DiscountCurve& disc,
@@ -292,123 +219,8 @@ namespace ir::pricers {
         const ir::market::ForwardCurve* rfr_fwd,
         const ir::market::FixingStore& fixings,
         const PricingContext& ctx) {
-
-        LegPVResult out;
-        const double sgn = leg_sign(leg.direction);
-
-        for (const auto& cfptr : leg.cashflows) {
-            if (!cfptr) continue;
-
-            const auto pay = cfptr->pay_date();
-            if (!is_payable_after_valuation(pay, ctx.valuation_date)) continue;
-
-            const double df = disc.df(pay);
-            double amt = 0.0;
-
-            switch (cfptr->type()) {
-
-            case ir::instruments::CashflowType::Fixed: {
-                auto known = cfptr->amount_if_known(&fixings);
-                if (!known.has_value()) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "MultiCurve pricer: fixed cashflow amount unknown.");
-                }
-                amt = known.value();
-                break;
-            }
-
-            case ir::instruments::CashflowType::IborCoupon: {
-                auto known = cfptr->amount_if_known(&fixings);
-
-                if (known.has_value()) {
-                    amt = known.value();
-                }
-                else {
-                    auto cpn = std::dynamic_pointer_cast<ir::instruments::IborCoupon>(cfptr);
-                    if (!cpn) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "MultiCurve pricer: cashflow type mismatch (IborCoupon).");
-                    }
-
-                    if (!ibor_fwd) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "MultiCurve pricer: IBOR forward curve is null.");
-                    }
-
-                    const auto& obs = cpn->observation();
-                    const double tau =
-                        ir::year_fraction(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
-
-                    if (!(tau > 0.0)) {
-                        return ir::Error::make(
-                            ir::ErrorCode::InvalidArgument,
-                            "MultiCurve pricer: invalid IBOR accrual year fraction.");
-                    }
-
-                    const double fwd =
-                        ibor_fwd->forward_rate(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
-
-                    amt = cpn->notional() * (fwd + cpn->spread()) * tau;
-                }
-                break;
-            }
-
-            case ir::instruments::CashflowType::RfrCoupon: {
-                auto cpn = std::dynamic_pointer_cast<ir::instruments::RfrCompoundCoupon>(cfptr);
-                if (!cpn) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "MultiCurve pricer: cashflow type mismatch (RfrCompoundCoupon).");
-                }
-
-                if (!rfr_fwd) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "MultiCurve pricer: RFR forward curve is null.");
-                }
-
-                // Hybrid logic:
-                // - use fixings for d < valuation_date
-                // - use forward projection for d >= valuation_date
-                auto hybrid_amt = cpn->amount_if_known(&fixings, ctx.valuation_date, rfr_fwd);
-
-                if (!hybrid_amt.has_value()) {
-                    return ir::Error::make(
-                        ir::ErrorCode::InvalidArgument,
-                        "MultiCurve pricer: unable to determine/project RFR coupon amount.");
-                }
-
-                amt = hybrid_amt.value();
-                break;
-            }
-
-            default:
-                return ir::Error::make(
-                    ir::ErrorCode::InvalidArgument,
-                    "MultiCurve pricer: unsupported cashflow type.");
-            }
-
-            const double signed_amt = sgn * amt;
-            const double pv = signed_amt * df;
-
-            out.pv += pv;
-
-            CashflowPVLine line;
-            line.pay_date = pay;
-            line.amount = signed_amt;
-            line.df = df;
-            line.pv = pv;
-            line.label = (cfptr->type() == ir::instruments::CashflowType::Fixed) ? "FIXED" :
-                (cfptr->type() == ir::instruments::CashflowType::IborCoupon) ? "IBOR" :
-                "RFR";
-            line.leg_id = leg.leg_id;
-            out.lines.push_back(std::move(line));
-        }
-
-        return out;
+        const std::vector<double> dfs = payable_dfs(leg, disc, ctx.valuation_date);
+        return pv_leg(leg, fixings, ctx, MultiCurveView{ "MultiCurve pricer", dfs, ibor_fwd, rfr_fwd }, dfs.size());
     }
 
     // ------------------------ Leg Pricer -----------------------------------
@@ -477,6 +289,21 @@ namespace ir::pricers {
     }
 
 
+    // Swap result from its fixed (leg 0) and float (leg 1) leg results; lines are moved.
+    static PricingResult combine_legs(LegPVResult&& fixed, LegPVResult&& flt, const PricingContext& ctx) {
+        PricingResult res;
+        res.pv = fixed.pv + flt.pv;
+        if (ctx.detail == PricingDetail::PvOnly) return res;
+
+        res.pv_fixed_leg = fixed.pv;
+        res.pv_float_leg = flt.pv;
+
+        res.lines = std::move(fixed.lines);
+        for (auto& line : flt.lines) line.leg = 1;
+        res.lines.insert(res.lines.end(), flt.lines.begin(), flt.lines.end());
+        return res;
+    }
+
     // ------------------------ DiscountingSwapPricer ------------------------
 
     ir::Result<PricingResult>
@@ -490,16 +317,7 @@ namespace ir::pricers {
         auto floatLeg = price_leg(swap.float_leg(), md, ctx);
         if (!floatLeg.has_value()) return floatLeg.error();
 
-        PricingResult res;
-        res.pv_fixed_leg = fixedLeg.value().pv;
-        res.pv_float_leg = floatLeg.value().pv;
-        res.pv = res.pv_fixed_leg + res.pv_float_leg;
-
-        res.lines.reserve(fixedLeg.value().lines.size() + floatLeg.value().lines.size());
-        res.lines.insert(res.lines.end(), fixedLeg.value().lines.begin(), fixedLeg.value().lines.end());
-        res.lines.insert(res.lines.end(), floatLeg.value().lines.begin(), floatLeg.value().lines.end());
-
-        return res;
+        return combine_legs(std::move(fixedLeg.value()), std::move(floatLeg.value()), ctx);
     }
 
     ir::Result<PricingResult>
@@ -513,16 +331,7 @@ namespace ir::pricers {
         auto rfrLeg = price_leg(swap.rfr_leg(), md, ctx);
         if (!rfrLeg.has_value()) return rfrLeg.error();
 
-        PricingResult res;
-        res.pv_fixed_leg = fixedLeg.value().pv;
-        res.pv_float_leg = rfrLeg.value().pv;
-        res.pv = res.pv_fixed_leg + res.pv_float_leg;
-
-        res.lines.reserve(fixedLeg.value().lines.size() + rfrLeg.value().lines.size());
-        res.lines.insert(res.lines.end(), fixedLeg.value().lines.begin(), fixedLeg.value().lines.end());
-        res.lines.insert(res.lines.end(), rfrLeg.value().lines.begin(), rfrLeg.value().lines.end());
-
-        return res;
+        return combine_legs(std::move(fixedLeg.value()), std::move(rfrLeg.value()), ctx);
     }
 
     // ------------------------ MultiCurveSwapPricer ------------------------
@@ -538,16 +347,7 @@ namespace ir::pricers {
         auto floatLeg = price_leg(swap.float_leg(), md, ctx);
         if (!floatLeg.has_value()) return floatLeg.error();
 
-        PricingResult res;
-        res.pv_fixed_leg = fixedLeg.value().pv;
-        res.pv_float_leg = floatLeg.value().pv;
-        res.pv = res.pv_fixed_leg + res.pv_float_leg;
-
-        res.lines.reserve(fixedLeg.value().lines.size() + floatLeg.value().lines.size());
-        res.lines.insert(res.lines.end(), fixedLeg.value().lines.begin(), fixedLeg.value().lines.end());
-        res.lines.insert(res.lines.end(), floatLeg.value().lines.begin(), floatLeg.value().lines.end());
-
-        return res;
+        return combine_legs(std::move(fixedLeg.value()), std::move(floatLeg.value()), ctx);
     }
 
     ir::Result<PricingResult>
@@ -561,16 +361,7 @@ namespace ir::pricers {
         auto rfrLeg = price_leg(swap.rfr_leg(), md, ctx);
         if (!rfrLeg.has_value()) return rfrLeg.error();
 
-        PricingResult res;
-        res.pv_fixed_leg = fixedLeg.value().pv;
-        res.pv_float_leg = rfrLeg.value().pv;
-        res.pv = res.pv_fixed_leg + res.pv_float_leg;
-
-        res.lines.reserve(fixedLeg.value().lines.size() + rfrLeg.value().lines.size());
-        res.lines.insert(res.lines.end(), fixedLeg.value().lines.begin(), fixedLeg.value().lines.end());
-        res.lines.insert(res.lines.end(), rfrLeg.value().lines.begin(), rfrLeg.value().lines.end());
-
-        return res;
+        return combine_legs(std::move(fixedLeg.value()), std::move(rfrLeg.value()), ctx);
     }
 
 } // namespace ir::pricers
\ No newline at end of file
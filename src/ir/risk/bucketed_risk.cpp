@@ -0,0 +1,321 @@
+#include "ir/risk/bucketed_risk.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "ir/core/date.hpp"
+#include "ir/core/error.hpp"
+#include "ir/instruments/coupons.hpp"
+#include "ir/market/curves.hpp"
+
+namespace ir::risk {
+
+    namespace {
+
+        using ir::instruments::Leg;
+        using ir::pricers::PricingContext;
+        using ir::pricers::PricingFramework;
+
+        struct LegRef {
+            const Leg* leg{ nullptr };
+            const PricingContext* ctx{ nullptr };
+        };
+
+        // Curve times [lo, hi] a cashflow reads from one curve.
+        struct TimeSpan {
+            double lo{ 0.0 };
+            double hi{ 0.0 };
+            void cover(double t) { lo = std::min(lo, t); hi = std::max(hi, t); }
+        };
+
+        // The cashflows of one leg that read a given curve.
+        struct CurveUse {
+            std::size_t leg{ 0 };
+            std::vector<std::pair<std::size_t, TimeSpan>> cashflows;   // (index in leg, times)
+        };
+
+        // One curve to bump, node by node.
+        struct CurveJob {
+            ir::CurveId id;
+            CurveRole role{ CurveRole::Discount };
+            const ir::market::PiecewiseDiscountCurve* disc{ nullptr };
+            const ir::market::PiecewiseForwardCurve* fwd{ nullptr };
+            std::vector<CurveUse> uses;
+
+            const ir::utils::Nodes1D& nodes() const { return disc ? disc->nodes() : fwd->nodes(); }
+            ir::Date asof() const { return disc ? disc->asof() : fwd->asof(); }
+            ir::DayCount dc() const { return disc ? disc->config().dc : fwd->config().dc; }
+        };
+
+        std::vector<ir::CurveId> sorted(std::vector<ir::CurveId> ids) {
+            std::sort(ids.begin(), ids.end(), [](const auto& a, const auto& b) { return a.value < b.value; });
+            return ids;
+        }
+
+        // Which cashflows of each leg read the job's curve, and over which times.
+        void collect_uses(CurveJob& job, const std::vector<LegRef>& legs) {
+            const ir::Date asof = job.asof();
+            const ir::DayCount dc = job.dc();
+            auto t_of = [&](const ir::Date& d) { return ir::year_fraction(asof, d, dc); };
+
+            for (std::size_t l = 0; l < legs.size(); ++l) {
+                const PricingContext& c = *legs[l].ctx;
+                const bool single = (c.framework == PricingFramework::SingleCurve);
+                if (job.role == CurveRole::Forward && single) continue;
+                if (job.role == CurveRole::Discount && !(c.discount_curve == job.id)) continue;
+
+                CurveUse use{ l, {} };
+                const auto& cfs = legs[l].leg->cashflows;
+                for (std::size_t k = 0; k < cfs.size(); ++k) {
+                    if (!cfs[k] || !(c.valuation_date < cfs[k]->pay_date())) continue;   // not priced
+
+                    // Observation period, if the cashflow projects a rate, and its curve
+                    const ir::Date* start = nullptr;
+                    const ir::Date* end = nullptr;
+                    const ir::CurveId* fwd_id = nullptr;
+                    if (const auto* ibor = dynamic_cast<const ir::instruments::IborCoupon*>(cfs[k].get())) {
+                        start = &ibor->observation().accrual_start;
+                        end = &ibor->observation().accrual_end;
+                        fwd_id = &c.ibor_forward_curve;
+                    }
+                    else if (const auto* rfr = dynamic_cast<const ir::instruments::RfrCompoundCoupon*>(cfs[k].get())) {
+                        start = &rfr->observation().start;
+                        end = &rfr->observation().end;
+                        fwd_id = &c.rfr_forward_curve;
+                    }
+
+                    const double t_pay = t_of(cfs[k]->pay_date());
+                    TimeSpan span{ t_pay, t_pay };
+                    bool reads = (job.role == CurveRole::Discount);
+                    const bool projects_here = start && (single
+                        ? job.role == CurveRole::Discount
+                        : job.role == CurveRole::Forward && *fwd_id == job.id);
+                    if (projects_here) {
+                        if (job.role == CurveRole::Forward) span = TimeSpan{ t_of(*start), t_of(*start) };
+                        span.cover(t_of(*start));
+                        span.cover(t_of(*end));
+                        reads = true;
+                    }
+                    if (reads) use.cashflows.emplace_back(k, span);
+                }
+                if (!use.cashflows.empty()) job.uses.push_back(std::move(use));
+            }
+        }
+
+    } // namespace
+
+    double BucketedRisk::trade_delta(std::size_t pillar, std::size_t trade) const {
+        double sum = 0.0;
+        for (std::size_t l = 0; l < legs.size(); ++l) {
+            if (legs[l].trade == trade) sum += leg_delta(pillar, l);
+        }
+        return sum;
+    }
+
+    BucketedRiskEngine::BucketedRiskEngine(BucketedRiskOptions opts) : opts_(opts) {
+        if (opts_.threads != 1) {
+            pool_ = std::make_unique<ir::utils::ThreadPool>(opts_.threads);
+            if (pool_->size() == 1) pool_.reset();
+        }
+    }
+
+    ir::Result<BucketedRisk> BucketedRiskEngine::compute(std::span<const ir::pricers::PortfolioTrade> trades,
+        const ir::market::MarketData& md,
+        const PricingContext& ctx) const {
+        BucketedRisk out;
+
+        // -------- Legs of all trades --------
+        // Only leg PVs are used: price without cashflow lines
+        std::vector<PricingContext> contexts;
+        contexts.reserve(trades.size());
+        std::vector<LegRef> legs;
+        for (std::size_t i = 0; i < trades.size(); ++i) {
+            contexts.push_back(trades[i].ctx ? *trades[i].ctx : ctx);
+            contexts.back().detail = ir::pricers::PricingDetail::PvOnly;
+            const PricingContext* c = &contexts.back();
+            auto add = [&](const Leg& leg) {
+                legs.push_back(LegRef{ &leg, c });
+                out.legs.push_back(RiskLeg{ i, leg.leg_id });
+            };
+            std::visit([&](const auto& p) {
+                using T = std::decay_t<decltype(p)>;
+                if constexpr (std::is_same_v<T, ir::instruments::InterestRateSwap>) {
+                    add(p.fixed_leg());
+                    add(p.float_leg());
+                }
+                else if constexpr (std::is_same_v<T, ir::instruments::OisSwap>) {
+                    add(p.fixed_leg());
+                    add(p.rfr_leg());
+                }
+                else {
+                    add(p);
+                }
+                }, trades[i].product);
+        }
+
+        auto price_leg = [&](const Leg& leg, const ir::market::MarketData& m, const PricingContext& c) {
+            return (c.framework == PricingFramework::SingleCurve)
+                ? single_curve_.price_leg(leg, m, c)
+                : multi_curve_.price_leg(leg, m, c);
+        };
+
+        // Base pricing surfaces input errors before any bumping. It keeps each leg's PV
+        // and the PV of each of its cashflows (0 for cashflows not priced), so a pillar
+        // only reprices the bumped market.
+        std::vector<double> leg_base_pv(legs.size(), 0.0);
+        std::vector<std::vector<double>> cashflow_base_pv(legs.size());
+        for (std::size_t l = 0; l < legs.size(); ++l) {
+            try {
+                PricingContext with_lines = *legs[l].ctx;
+                with_lines.detail = ir::pricers::PricingDetail::Cashflows;
+                auto base = price_leg(*legs[l].leg, md, with_lines);
+                if (!base.has_value()) {
+                    return ir::Error::make(base.error().code, "BucketedRiskEngine: trade "
+                        + std::to_string(out.legs[l].trade) + ": " + base.error().message);
+                }
+                leg_base_pv[l] = base.value().pv;
+
+                // Lines follow the leg's priced cashflows in order (see collect_uses)
+                const auto& cfs = legs[l].leg->cashflows;
+                auto& cf_pv = cashflow_base_pv[l];
+                cf_pv.assign(cfs.size(), 0.0);
+                std::size_t line = 0;
+                for (std::size_t k = 0; k < cfs.size() && line < base.value().lines.size(); ++k) {
+                    if (!cfs[k] || !(with_lines.valuation_date < cfs[k]->pay_date())) continue;
+                    cf_pv[k] = base.value().lines[line++].pv;
+                }
+            }
+            catch (const std::exception& e) {
+                return ir::Error::make(ir::ErrorCode::InvalidArgument, "BucketedRiskEngine: trade "
+                    + std::to_string(out.legs[l].trade) + ": " + e.what());
+            }
+        }
+
+        // -------- Curves and pillars --------
+        std::vector<CurveJob> jobs;
+        for (const auto& id : sorted(md.discount_curve_ids())) {
+            if (const auto* c = dynamic_cast<const ir::market::PiecewiseDiscountCurve*>(&md.discount_curve(id))) {
+                jobs.push_back(CurveJob{ id, CurveRole::Discount, c, nullptr, {} });
+            }
+        }
+        for (const auto& id : sorted(md.forward_curve_ids())) {
+            if (const auto* c = dynamic_cast<const ir::market::PiecewiseForwardCurve*>(&md.forward_curve(id))) {
+                jobs.push_back(CurveJob{ id, CurveRole::Forward, nullptr, c, {} });
+            }
+        }
+
+        std::vector<std::size_t> pillar_job;
+        for (std::size_t j = 0; j < jobs.size(); ++j) {
+            collect_uses(jobs[j], legs);
+            const auto& t = jobs[j].nodes().t;
+            for (std::size_t i = 0; i < t.size(); ++i) {
+                out.pillars.push_back(RiskPillar{ jobs[j].id, jobs[j].role, i, t[i] });
+                pillar_job.push_back(j);
+            }
+        }
+        out.deltas.assign(out.pillars.size() * legs.size(), 0.0);
+
+        // -------- Bump and reprice --------
+        std::atomic<std::size_t> repriced{ 0 };
+        auto run = [&](std::size_t begin, std::size_t end) {
+            ir::market::MarketData local = md;   // holds this task's working curve copies
+            std::size_t current = std::numeric_limits<std::size_t>::max();
+            std::shared_ptr<ir::market::PiecewiseDiscountCurve> work_disc;
+            std::shared_ptr<ir::market::PiecewiseForwardCurve> work_fwd;
+            std::size_t count = 0;
+
+            for (std::size_t p = begin; p < end; ++p) {
+                const CurveJob& job = jobs[pillar_job[p]];
+                if (pillar_job[p] != current) {
+                    // Copies equal the base curve between bumps, so they can stay in `local`
+                    current = pillar_job[p];
+                    if (job.disc) {
+                        work_disc = std::make_shared<ir::market::PiecewiseDiscountCurve>(*job.disc);
+                        local.set_discount_curve(job.id, work_disc);
+                    }
+                    else {
+                        work_fwd = std::make_shared<ir::market::PiecewiseForwardCurve>(*job.fwd);
+                        local.set_forward_curve(job.id, work_fwd);
+                    }
+                }
+
+                const auto& nodes = job.nodes();
+                const std::size_t i = out.pillars[p].node;
+                const double base_v = nodes.v[i];
+                const double bumped_v = base_v * std::exp(-opts_.bump * nodes.t[i]);
+                if (bumped_v == base_v) continue;   // node at t = 0
+
+                const double lo = (i == 0) ? -std::numeric_limits<double>::infinity() : nodes.t[i - 1];
+                const double hi = (i + 1 == nodes.t.size()) ? std::numeric_limits<double>::infinity() : nodes.t[i + 1];
+
+                // Sub-legs of the cashflows the bump can move, and their base PVs
+                std::vector<std::pair<std::size_t, Leg>> subs;
+                std::vector<double> base_pv;
+                if (opts_.skip_unaffected) {
+                    for (const auto& use : job.uses) {
+                        Leg sub{ legs[use.leg].leg->direction, {}, legs[use.leg].leg->leg_id };
+                        double pv = 0.0;
+                        for (const auto& [k, span] : use.cashflows) {
+                            if (!(span.lo < hi && span.hi > lo)) continue;
+                            sub.cashflows.push_back(legs[use.leg].leg->cashflows[k]);
+                            pv += cashflow_base_pv[use.leg][k];
+                        }
+                        if (sub.cashflows.empty()) continue;
+                        subs.emplace_back(use.leg, std::move(sub));
+                        base_pv.push_back(pv);
+                    }
+                }
+                else {
+                    for (std::size_t l = 0; l < legs.size(); ++l) {
+                        subs.emplace_back(l, *legs[l].leg);
+                        base_pv.push_back(leg_base_pv[l]);
+                    }
+                }
+                if (subs.empty()) continue;
+                for (const auto& sub : subs) count += sub.second.cashflows.size();
+
+                auto set = [&](double v) {
+                    auto ok = job.disc ? work_disc->set_node_value(i, v) : work_fwd->set_node_value(i, v);
+                    if (!ok.has_value()) throw std::runtime_error(ok.error().message);
+                };
+                set(bumped_v);
+                for (std::size_t s = 0; s < subs.size(); ++s) {
+                    auto r = price_leg(subs[s].second, local, *legs[subs[s].first].ctx);
+                    if (!r.has_value()) {
+                        set(base_v);
+                        throw std::runtime_error(r.error().message);
+                    }
+                    out.deltas[p * legs.size() + subs[s].first] = r.value().pv - base_pv[s];
+                }
+                set(base_v);
+            }
+            repriced.fetch_add(count, std::memory_order_relaxed);
+        };
+
+        try {
+            if (!pool_ || out.pillars.size() <= 1) {
+                run(0, out.pillars.size());
+            }
+            else {
+                const std::size_t grain = opts_.grain > 0
+                    ? opts_.grain
+                    : std::max<std::size_t>(1, out.pillars.size() / (8 * pool_->size()));
+                pool_->parallel_for(out.pillars.size(), grain, run);
+            }
+        }
+        catch (const std::exception& e) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, std::string("BucketedRiskEngine: ") + e.what());
+        }
+
+        out.cashflows_repriced = repriced.load(std::memory_order_relaxed);
+        return out;
+    }
+
+} // namespace ir::risk
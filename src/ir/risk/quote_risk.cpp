@@ -0,0 +1,99 @@
+#include "ir/risk/quote_risk.hpp"
+
+#include <string>
+#include <utility>
+
+#include "ir/core/error.hpp"
+
+namespace ir::risk {
+
+    const QuoteRiskMap::CurveRows* QuoteRiskMap::find(const ir::CurveId& id, CurveRole role) const {
+        for (const auto& c : curves_) {
+            if (c.id == id && c.role == role) return &c;
+        }
+        return nullptr;
+    }
+
+    ir::Result<int> QuoteRiskMap::add_discount_curve(const ir::CurveId& id,
+        const ir::market::BootstrapSensitivities& sens) {
+        return add(id, CurveRole::Discount, sens, nullptr);
+    }
+
+    ir::Result<int> QuoteRiskMap::add_forward_curve(const ir::CurveId& id,
+        const ir::market::BootstrapSensitivities& sens,
+        const ir::CurveId& discount_curve) {
+        const CurveRows* disc = find(discount_curve, CurveRole::Discount);
+        if (!disc) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "QuoteRiskMap: discount curve " + discount_curve.value + " must be added before " + id.value);
+        }
+        if (sens.d_node_d_discount.cols != disc->rows.size()
+            || sens.d_node_d_discount.rows != sens.d_node_d_quote.rows) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "QuoteRiskMap: " + id.value + " was not bootstrapped on " + discount_curve.value);
+        }
+        return add(id, CurveRole::Forward, sens, disc);
+    }
+
+    ir::Result<int> QuoteRiskMap::add(const ir::CurveId& id, CurveRole role,
+        const ir::market::BootstrapSensitivities& sens, const CurveRows* discount) {
+        const auto& dq = sens.d_node_d_quote;
+        if (dq.cols != sens.quote_maturities.size() || dq.row_ptr.size() != dq.rows + 1) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                "QuoteRiskMap: incomplete sensitivities for " + id.value);
+        }
+        if (find(id, role)) {
+            return ir::Error::make(ir::ErrorCode::InvalidArgument, "QuoteRiskMap: curve added twice: " + id.value);
+        }
+
+        const std::size_t first = quotes_.size();
+        const std::size_t cols = first + dq.cols;
+
+        CurveRows out{ id, role, std::vector<std::vector<double>>(dq.rows, std::vector<double>(cols, 0.0)) };
+        for (std::size_t i = 0; i < dq.rows; ++i) {
+            auto& row = out.rows[i];
+            for (std::size_t k = dq.row_ptr[i]; k < dq.row_ptr[i + 1]; ++k) {
+                row[first + dq.col[k]] = dq.val[k];
+            }
+            // Chain rule through the discount curve's own quote dependence
+            if (discount) {
+                const auto& dd = sens.d_node_d_discount;
+                for (std::size_t k = dd.row_ptr[i]; k < dd.row_ptr[i + 1]; ++k) {
+                    const auto& disc_row = discount->rows[dd.col[k]];
+                    for (std::size_t c = 0; c < disc_row.size(); ++c) row[c] += dd.val[k] * disc_row[c];
+                }
+            }
+        }
+
+        for (std::size_t c = 0; c < dq.cols; ++c) {
+            quotes_.push_back(QuotePillar{ id, c, sens.quote_maturities[c] });
+        }
+        curves_.push_back(std::move(out));
+        return 0;
+    }
+
+    ir::Result<ir::utils::SparseMatrix> QuoteRiskMap::matrix(std::span<const RiskPillar> pillars) const {
+        ir::utils::SparseMatrix m(pillars.size(), quotes_.size());
+        for (const auto& p : pillars) {
+            if (const CurveRows* c = find(p.curve, p.role)) {
+                if (p.node >= c->rows.size()) {
+                    return ir::Error::make(ir::ErrorCode::InvalidArgument,
+                        "QuoteRiskMap: pillar node " + std::to_string(p.node) + " is not a node of " + p.curve.value);
+                }
+                const auto& row = c->rows[p.node];
+                for (std::size_t q = 0; q < row.size(); ++q) m.push(q, row[q]);
+            }
+            m.end_row();
+        }
+        return m;
+    }
+
+    std::vector<double> quote_deltas(const ir::utils::SparseMatrix& node_to_quote,
+        std::span<const double> node_gradient,
+        double bump) {
+        auto out = node_to_quote.multiply_transposed(node_gradient);
+        for (double& v : out) v *= bump;
+        return out;
+    }
+
+} // namespace ir::risk
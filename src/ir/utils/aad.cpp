@@ -0,0 +1,44 @@
+#include "ir/utils/aad.hpp"
+
+#include <bit>
+
+namespace ir::utils {
+
+    thread_local Tape* Tape::active_ = nullptr;
+
+    Tape::Tape(std::size_t block_nodes) {
+        const std::size_t n = std::bit_ceil(block_nodes < 64 ? std::size_t{ 64 } : block_nodes);
+        shift_ = static_cast<std::size_t>(std::countr_zero(n));
+        mask_ = n - 1;
+    }
+
+    void Tape::grow() {
+        blocks_.push_back(std::make_unique<Node[]>(mask_ + 1));
+        capacity_ += mask_ + 1;
+    }
+
+    std::size_t Tape::bytes() const {
+        return capacity_ * sizeof(Node) + adjoints_.capacity() * sizeof(double);
+    }
+
+    void Tape::propagate(const AReal& out) {
+        adjoints_.assign(size_, 0.0);   // keeps its capacity between sweeps
+        if (!out.active()) return;
+
+        adjoints_[out.node()] = 1.0;
+        double* adj = adjoints_.data();
+        for (std::size_t i = out.node() + 1; i-- > 0;) {
+            const double a = adj[i];
+            if (a == 0.0) continue;
+
+            const Node& n = node(i);
+            if (n.a != kNoNode) adj[n.a] += n.da * a;
+            if (n.b != kNoNode) adj[n.b] += n.db * a;
+        }
+    }
+
+    double Tape::adjoint(const AReal& x) const {
+        return (x.active() && x.node() < adjoints_.size()) ? adjoints_[x.node()] : 0.0;
+    }
+
+} // namespace ir::utils
@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 
 #include "ir/core/error.hpp"
 #include "ir/utils/math.hpp"
+#include "ir/utils/simd.hpp"
 
 namespace ir::utils {
 
@@ -68,6 +70,40 @@ namespace ir::utils {
 
     }
 
+    NodeGradient LinearInterpolator::value_and_gradient(double x) const {
+        const std::size_t last = xs_.size() - 1;
+        // Flat extrapolation: depends on the end node only
+        if (x <= xs_.front()) return NodeGradient{ ys_.front(), 0, 1.0, 0, 0.0 };
+        if (x >= xs_.back())  return NodeGradient{ ys_.back(), last, 1.0, last, 0.0 };
+
+        const std::size_t i1 = static_cast<std::size_t>(
+            std::lower_bound(xs_.begin(), xs_.end(), x) - xs_.begin());
+        const std::size_t i0 = i1 - 1;
+
+        const double w = (x - xs_[i0]) / (xs_[i1] - xs_[i0]);
+        return NodeGradient{ ys_[i0] + w * (ys_[i1] - ys_[i0]), i0, 1.0 - w, i1, w };
+    }
+
+    Result<int> LinearInterpolator::push_back(double x, double y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            return Error::make(ErrorCode::InvalidArgument, "LinearInterpolator::push_back: non-finite x/y.");
+        }
+        if (!(x > xs_.back())) {
+            return Error::make(ErrorCode::InvalidArgument, "LinearInterpolator::push_back: x must be > last x.");
+        }
+        xs_.push_back(x);
+        ys_.push_back(y);
+        return Result<int>(0);
+    }
+
+    Result<int> LinearInterpolator::set_last_value(double y) {
+        if (!std::isfinite(y)) {
+            return Error::make(ErrorCode::InvalidArgument, "LinearInterpolator::set_last_value: non-finite y.");
+        }
+        ys_.back() = y;
+        return Result<int>(0);
+    }
+
     // -------- LogLinearInterpolator --------
 
     LogLinearInterpolator::LogLinearInterpolator(Interp1DData data)
@@ -87,6 +123,7 @@ namespace ir::utils {
         xs_ = std::move(data.x);
         log_ys_.reserve(data.y.size());
         for (double yi : data.y) log_ys_.push_back(std::log(yi));
+        ys_ = std::move(data.y);
     }
 
     double LogLinearInterpolator::value(double x) const {
@@ -111,4 +148,122 @@ namespace ir::utils {
         return std::exp(ly);
     }
 
+    NodeGradient LogLinearInterpolator::value_and_gradient(double x) const {
+        // d exp(ly) / d y_i = value * (weight of ly_i) / y_i
+        const std::size_t last = xs_.size() - 1;
+        if (x <= xs_.front()) return NodeGradient{ ys_.front(), 0, 1.0, 0, 0.0 };
+        if (x >= xs_.back())  return NodeGradient{ ys_.back(), last, 1.0, last, 0.0 };
+
+        const std::size_t i1 = static_cast<std::size_t>(
+            std::lower_bound(xs_.begin(), xs_.end(), x) - xs_.begin());
+        const std::size_t i0 = i1 - 1;
+
+        const double w = (x - xs_[i0]) / (xs_[i1] - xs_[i0]);
+        const double v = std::exp(log_ys_[i0] + w * (log_ys_[i1] - log_ys_[i0]));
+        return NodeGradient{ v, i0, v * (1.0 - w) / ys_[i0], i1, v * w / ys_[i1] };
+    }
+
+    Result<int> LogLinearInterpolator::push_back(double x, double y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearInterpolator::push_back: non-finite x/y.");
+        }
+        if (!(x > xs_.back())) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearInterpolator::push_back: x must be > last x.");
+        }
+        if (!(y > 0.0)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearInterpolator::push_back: y must be > 0.");
+        }
+        xs_.push_back(x);
+        ys_.push_back(y);
+        log_ys_.push_back(std::log(y));
+        return Result<int>(0);
+    }
+
+    Result<int> LogLinearInterpolator::set_last_value(double y) {
+        if (!std::isfinite(y) || !(y > 0.0)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearInterpolator::set_last_value: y must be finite and > 0.");
+        }
+        ys_.back() = y;
+        log_ys_.back() = std::log(y);
+        return Result<int>(0);
+    }
+
+    // -------- LogLinearKernel --------
+
+    Result<int> LogLinearKernel::assign(const std::vector<double>& x, const std::vector<double>& y) {
+        auto ok = validate_xy(Interp1DData{ x, y });
+        if (!ok.has_value()) return ok;
+        for (double yi : y) {
+            if (!(yi > 0.0)) {
+                return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::assign: y must be > 0.");
+            }
+        }
+
+        xs_ = x;
+        ys_ = y;
+        log_ys_.resize(y.size());
+        for (std::size_t i = 0; i < y.size(); ++i) log_ys_[i] = std::log(y[i]);
+        slopes_.assign(x.size(), 0.0);
+        for (std::size_t i = 0; i + 1 < x.size(); ++i) update_slope(i);
+        return Result<int>(0);
+    }
+
+    Result<int> LogLinearKernel::push_back(double x, double y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::push_back: non-finite x/y.");
+        }
+        if (!xs_.empty() && !(x > xs_.back())) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::push_back: x must be > last x.");
+        }
+        if (!(y > 0.0)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::push_back: y must be > 0.");
+        }
+        xs_.push_back(x);
+        ys_.push_back(y);
+        log_ys_.push_back(std::log(y));
+        slopes_.push_back(0.0);
+        if (xs_.size() >= 2) update_slope(xs_.size() - 2);
+        return Result<int>(0);
+    }
+
+    Result<int> LogLinearKernel::set_value(std::size_t i, double y) {
+        if (i >= ys_.size()) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::set_value: index out of range.");
+        }
+        if (!std::isfinite(y) || !(y > 0.0)) {
+            return Error::make(ErrorCode::InvalidArgument, "LogLinearKernel::set_value: y must be finite and > 0.");
+        }
+        ys_[i] = y;
+        log_ys_[i] = std::log(y);
+        if (i > 0) update_slope(i - 1);
+        if (i + 1 < xs_.size()) update_slope(i);
+        return Result<int>(0);
+    }
+
+    void LogLinearKernel::values(std::span<const double> xs, std::span<double> out) const {
+        if (xs.size() != out.size()) {
+            throw std::runtime_error("LogLinearKernel::values: xs and out sizes differ.");
+        }
+        // Blocks of segment indices and clamped abscissas: beyond the ends the point is
+        // clamped onto the end node (the last node carries a zero sentinel slope), which
+        // reproduces flat extrapolation exactly.
+        constexpr std::size_t kBlock = 256;
+        std::int64_t idx[kBlock];
+        double xc[kBlock];
+
+        const std::size_t last = xs_.size() - 1;
+        std::size_t hint = 0;
+        for (std::size_t base = 0; base < xs.size(); base += kBlock) {
+            const std::size_t m = std::min(kBlock, xs.size() - base);
+            for (std::size_t k = 0; k < m; ++k) {
+                const double x = xs[base + k];
+                if (x <= xs_.front()) { idx[k] = 0; xc[k] = xs_.front(); }
+                else if (x >= xs_.back()) { idx[k] = static_cast<std::int64_t>(last); xc[k] = xs_.back(); }
+                else { idx[k] = static_cast<std::int64_t>(segment(x, hint)); xc[k] = x; }
+            }
+            simd::log_linear_gather(xs_.data(), log_ys_.data(), slopes_.data(), idx, xc, m, out.data() + base);
+        }
+        simd::exp_inplace(out);
+    }
+
 } // namespace ir::utils
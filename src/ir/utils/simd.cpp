@@ -0,0 +1,155 @@
+#include "ir/utils/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace ir::utils::simd {
+
+    // exp(x) = 2^n * exp(r), n = round(x / ln2), r = x - n*ln2 in [-ln2/2, ln2/2].
+    // exp(r) by its Taylor series to degree 12 (truncation < 2e-16 on that range);
+    // ln2 split in hi/lo parts (Cody-Waite) so r is exact to double precision.
+    namespace {
+        constexpr double kLog2e = 1.4426950408889634;
+        constexpr double kLn2Hi = 6.93145751953125e-1;
+        constexpr double kLn2Lo = 1.42860682030941723212e-6;
+        constexpr double kMaxArg = 709.0;
+        constexpr double kMinArg = -708.0;
+
+        // 1/k!, k = 12 .. 2 (Horner order)
+        constexpr double kC[] = {
+            2.08767569878680989792e-9,  // 1/12!
+            2.50521083854417187751e-8,  // 1/11!
+            2.75573192239858906526e-7,  // 1/10!
+            2.75573192239858906526e-6,  // 1/9!
+            2.48015873015873015873e-5,  // 1/8!
+            1.98412698412698412698e-4,  // 1/7!
+            1.38888888888888888889e-3,  // 1/6!
+            8.33333333333333333333e-3,  // 1/5!
+            4.16666666666666666667e-2,  // 1/4!
+            1.66666666666666666667e-1,  // 1/3!
+            0.5,                        // 1/2!
+        };
+    } // namespace
+
+#if defined(__AVX512F__)
+
+    const char* isa() { return "avx512"; }
+
+    static inline __m512d exp_pd(__m512d x) {
+        x = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(kMinArg)), _mm512_set1_pd(kMaxArg));
+        const __m512d n = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(kLog2e)),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m512d r = _mm512_fnmadd_pd(n, _mm512_set1_pd(kLn2Hi), x);
+        r = _mm512_fnmadd_pd(n, _mm512_set1_pd(kLn2Lo), r);
+
+        __m512d p = _mm512_set1_pd(kC[0]);
+        for (std::size_t k = 1; k < std::size(kC); ++k) {
+            p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(kC[k]));
+        }
+        p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(1.0));
+        p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(1.0));
+        return _mm512_scalef_pd(p, n);
+    }
+
+    void exp_inplace(std::span<double> x) {
+        const std::size_t n = x.size();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(x.data() + i, exp_pd(_mm512_loadu_pd(x.data() + i)));
+        }
+        if (i < n) {
+            const __mmask8 m = static_cast<__mmask8>((1u << (n - i)) - 1u);
+            const __m512d v = _mm512_mask_loadu_pd(_mm512_setzero_pd(), m, x.data() + i);
+            _mm512_mask_storeu_pd(x.data() + i, m, exp_pd(v));
+        }
+    }
+
+    void log_linear_gather(const double* xs, const double* log_ys, const double* slopes,
+        const std::int64_t* idx, const double* x, std::size_t n, double* out) {
+        std::size_t k = 0;
+        for (; k + 8 <= n; k += 8) {
+            const __m512i vi = _mm512_loadu_si512(idx + k);
+            const __m512d x0 = _mm512_i64gather_pd(vi, xs, 8);
+            const __m512d ly = _mm512_i64gather_pd(vi, log_ys, 8);
+            const __m512d sl = _mm512_i64gather_pd(vi, slopes, 8);
+            const __m512d dx = _mm512_sub_pd(_mm512_loadu_pd(x + k), x0);
+            _mm512_storeu_pd(out + k, _mm512_fmadd_pd(sl, dx, ly));
+        }
+        for (; k < n; ++k) {
+            out[k] = log_ys[idx[k]] + slopes[idx[k]] * (x[k] - xs[idx[k]]);
+        }
+    }
+
+#elif defined(__AVX2__)
+
+    const char* isa() { return "avx2"; }
+
+    static inline __m256d exp_pd(__m256d x) {
+        x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(kMinArg)), _mm256_set1_pd(kMaxArg));
+        const __m256d n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(kLog2e)),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256d r = _mm256_fnmadd_pd(n, _mm256_set1_pd(kLn2Hi), x);
+        r = _mm256_fnmadd_pd(n, _mm256_set1_pd(kLn2Lo), r);
+
+        __m256d p = _mm256_set1_pd(kC[0]);
+        for (std::size_t k = 1; k < std::size(kC); ++k) {
+            p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(kC[k]));
+        }
+        p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(1.0));
+        p = _mm256_fmadd_pd(p, r, _mm256_set1_pd(1.0));
+
+        // 2^n: n + 1.5*2^52 puts n in the low mantissa bits; rebias and shift into the exponent
+        const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+        const __m256i ni = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(n, magic)),
+            _mm256_castpd_si256(magic));
+        const __m256i e = _mm256_slli_epi64(_mm256_add_epi64(ni, _mm256_set1_epi64x(1023)), 52);
+        return _mm256_mul_pd(p, _mm256_castsi256_pd(e));
+    }
+
+    void exp_inplace(std::span<double> x) {
+        const std::size_t n = x.size();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(x.data() + i, exp_pd(_mm256_loadu_pd(x.data() + i)));
+        }
+        for (; i < n; ++i) x[i] = std::exp(x[i]);
+    }
+
+    void log_linear_gather(const double* xs, const double* log_ys, const double* slopes,
+        const std::int64_t* idx, const double* x, std::size_t n, double* out) {
+        std::size_t k = 0;
+        for (; k + 4 <= n; k += 4) {
+            const __m256i vi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + k));
+            const __m256d x0 = _mm256_i64gather_pd(xs, vi, 8);
+            const __m256d ly = _mm256_i64gather_pd(log_ys, vi, 8);
+            const __m256d sl = _mm256_i64gather_pd(slopes, vi, 8);
+            const __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + k), x0);
+            _mm256_storeu_pd(out + k, _mm256_fmadd_pd(sl, dx, ly));
+        }
+        for (; k < n; ++k) {
+            out[k] = log_ys[idx[k]] + slopes[idx[k]] * (x[k] - xs[idx[k]]);
+        }
+    }
+
+#else
+
+    const char* isa() { return "scalar"; }
+
+    void exp_inplace(std::span<double> x) {
+        for (double& v : x) v = std::exp(v);
+    }
+
+    void log_linear_gather(const double* xs, const double* log_ys, const double* slopes,
+        const std::int64_t* idx, const double* x, std::size_t n, double* out) {
+        for (std::size_t k = 0; k < n; ++k) {
+            out[k] = log_ys[idx[k]] + slopes[idx[k]] * (x[k] - xs[idx[k]]);
+        }
+    }
+
+#endif
+
+} // namespace ir::utils::simd
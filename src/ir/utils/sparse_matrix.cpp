@@ -0,0 +1,119 @@
+#include "ir/utils/sparse_matrix.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "ir/core/error.hpp"
+
+namespace ir::utils {
+
+    double SparseMatrix::at(std::size_t i, std::size_t j) const {
+        for (std::size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+            if (col[k] == j) return val[k];
+        }
+        return 0.0;
+    }
+
+    std::vector<double> SparseMatrix::multiply(const std::vector<double>& x) const {
+        std::vector<double> y(rows, 0.0);
+        for (std::size_t i = 0; i < rows; ++i) {
+            double s = 0.0;
+            for (std::size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+                s += val[k] * x[col[k]];
+            }
+            y[i] = s;
+        }
+        return y;
+    }
+
+    std::vector<double> SparseMatrix::multiply_transposed(std::span<const double> x) const {
+        std::vector<double> y(cols, 0.0);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+                y[col[k]] += val[k] * x[i];
+            }
+        }
+        return y;
+    }
+
+    Result<std::vector<double>> solve(const SparseMatrix& a, std::vector<double> b) {
+        const std::size_t n = a.rows;
+        if (a.cols != n || b.size() != n || a.row_ptr.size() != n + 1) {
+            return Error::make(ErrorCode::InvalidArgument, "solve: matrix must be square and match rhs.");
+        }
+
+        // Each row dense over its envelope: v[j - base] is column j, for j in [lo, hi).
+        // Columns before lo are eliminated (or were never stored); the row is empty when
+        // lo >= hi.
+        struct Row {
+            std::size_t base{ 0 };
+            std::size_t lo{ 0 };
+            std::size_t hi{ 0 };
+            std::vector<double> v;
+        };
+        std::vector<Row> rows(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            Row& r = rows[i];
+            r.base = r.lo = r.hi = n;
+            for (std::size_t k = a.row_ptr[i]; k < a.row_ptr[i + 1]; ++k) {
+                r.lo = std::min(r.lo, a.col[k]);
+                r.hi = (r.hi == n) ? a.col[k] + 1 : std::max(r.hi, a.col[k] + 1);
+            }
+            if (r.lo == n) continue;
+            r.base = r.lo;
+            r.v.assign(r.hi - r.lo, 0.0);
+            for (std::size_t k = a.row_ptr[i]; k < a.row_ptr[i + 1]; ++k) r.v[a.col[k] - r.base] = a.val[k];
+        }
+
+        // Forward elimination with partial pivoting. At step k only rows whose envelope
+        // starts at k have a nonzero in column k, and they change only over the pivot
+        // row's envelope (k, hi).
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t p = n;
+            double best = 0.0;
+            for (std::size_t i = k; i < n; ++i) {
+                if (rows[i].lo != k || rows[i].hi <= k) continue;
+                const double m = std::fabs(rows[i].v[k - rows[i].base]);
+                if (m > best) {
+                    best = m;
+                    p = i;
+                }
+            }
+            if (p == n) {
+                return Error::make(ErrorCode::InvalidArgument, "solve: singular matrix.");
+            }
+            if (p != k) {
+                std::swap(rows[k], rows[p]);
+                std::swap(b[k], b[p]);
+            }
+
+            const Row& pr = rows[k];
+            const double piv = pr.v[k - pr.base];
+            for (std::size_t i = k + 1; i < n; ++i) {
+                Row& r = rows[i];
+                if (r.lo != k || r.hi <= k) continue;
+                r.lo = k + 1;
+                const double l = r.v[k - r.base] / piv;
+                if (l == 0.0) continue;
+                if (r.hi < pr.hi) {   // fill-in past the row's envelope
+                    r.hi = pr.hi;
+                    r.v.resize(r.hi - r.base, 0.0);
+                }
+                for (std::size_t j = k + 1; j < pr.hi; ++j) r.v[j - r.base] -= l * pr.v[j - pr.base];
+                b[i] -= l * b[k];
+            }
+        }
+
+        // Back substitution over each U row's envelope
+        std::vector<double> x(n, 0.0);
+        for (std::size_t i = n; i-- > 0;) {
+            const Row& r = rows[i];
+            double s = b[i];
+            for (std::size_t j = i + 1; j < r.hi; ++j) s -= r.v[j - r.base] * x[j];
+            x[i] = s / r.v[i - r.base];
+        }
+        return x;
+    }
+
+} // namespace ir::utils
@@ -0,0 +1,137 @@
+#include "ir/utils/thread_pool.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace ir::utils {
+
+    namespace {
+        // Pool and queue index of the worker running on this thread (none outside workers).
+        thread_local const ThreadPool* tl_pool = nullptr;
+        thread_local std::size_t tl_index = 0;
+    } // namespace
+
+    ThreadPool::ThreadPool(std::size_t threads) {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        queues_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        threads_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(wake_m_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto& t : threads_) t.join();
+    }
+
+    void ThreadPool::push(std::size_t q, std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(queues_[q]->m);
+            queues_[q]->tasks.push_back(std::move(task));
+        }
+        pending_.fetch_add(1, std::memory_order_release);
+        // Taking the wake mutex orders the increment against a worker's predicate check.
+        { std::lock_guard<std::mutex> lock(wake_m_); }
+        wake_cv_.notify_one();
+    }
+
+    void ThreadPool::submit(std::function<void()> task) {
+        const std::size_t q = (tl_pool == this)
+            ? tl_index
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        push(q, std::move(task));
+    }
+
+    bool ThreadPool::try_run_one(std::size_t self) {
+        std::function<void()> task;
+        const std::size_t n = queues_.size();
+
+        // Own queue: newest first (cache-warm). Others: oldest first.
+        for (std::size_t k = 0; k < n && !task; ++k) {
+            Queue& q = *queues_[(self + k) % n];
+            std::lock_guard<std::mutex> lock(q.m);
+            if (q.tasks.empty()) continue;
+            if (k == 0) {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+            }
+            else {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
+            }
+        }
+        if (!task) return false;
+
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+        task();
+        return true;
+    }
+
+    void ThreadPool::worker_loop(std::size_t self) {
+        tl_pool = this;
+        tl_index = self;
+        for (;;) {
+            if (try_run_one(self)) continue;
+
+            std::unique_lock<std::mutex> lock(wake_m_);
+            wake_cv_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_acquire) > 0; });
+            if (stop_ && pending_.load(std::memory_order_acquire) == 0) return;
+        }
+    }
+
+    void ThreadPool::parallel_for(std::size_t n, std::size_t grain,
+        const std::function<void(std::size_t, std::size_t)>& body) {
+        if (n == 0) return;
+        grain = std::max<std::size_t>(1, grain);
+        const std::size_t chunks = (n + grain - 1) / grain;
+
+        struct Sync {
+            std::atomic<std::size_t> remaining;
+            std::mutex m;
+            std::condition_variable cv;
+            std::exception_ptr error;
+        } sync;
+        sync.remaining.store(chunks, std::memory_order_relaxed);
+
+        for (std::size_t c = 0; c < chunks; ++c) {
+            const std::size_t begin = c * grain;
+            const std::size_t end = std::min(n, begin + grain);
+            submit([&sync, &body, begin, end] {
+                try {
+                    body(begin, end);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(sync.m);
+                    if (!sync.error) sync.error = std::current_exception();
+                }
+                // Decrement and notify under the lock: once the caller sees zero it
+                // returns and destroys sync, so the last chunk must be done with it.
+                std::lock_guard<std::mutex> lock(sync.m);
+                if (sync.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) sync.cv.notify_all();
+            });
+        }
+
+        // Help until nothing is left to steal, then wait for chunks still running elsewhere.
+        // The final check is always made under sync.m, so the last chunk has released
+        // it before sync goes out of scope.
+        const std::size_t self = (tl_pool == this) ? tl_index : 0;
+        while (sync.remaining.load(std::memory_order_acquire) > 0) {
+            if (!try_run_one(self)) break;
+        }
+        std::unique_lock<std::mutex> lock(sync.m);
+        sync.cv.wait(lock, [&sync] { return sync.remaining.load(std::memory_order_acquire) == 0; });
+        if (sync.error) std::rethrow_exception(sync.error);
+    }
+
+} // namespace ir::utils
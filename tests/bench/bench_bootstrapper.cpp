@@ -0,0 +1,138 @@
+// Benchmark: OIS discount curve bootstrap, full-rebuild vs incremental mode,
+// Brent vs Newton pillar solver, and sequential vs joint dual-curve solve.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_bootstrapper
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/market/bootstrapper.hpp"
+#include "ir/market/rate_helpers.hpp"
+
+using namespace ir;
+using namespace ir::market;
+
+namespace {
+
+    // Quarterly pillars 3M, 6M, ... with an upward-sloping par curve.
+    std::vector<std::shared_ptr<OisSwapHelper>> make_ois_helpers(const Date& asof, int pillars) {
+        OisSwapHelper::Config cfg;
+        cfg.fixed_dc = DayCount::ACT360;
+        cfg.fixed_freq = Frequency::Annual;
+
+        std::vector<std::shared_ptr<OisSwapHelper>> helpers;
+        helpers.reserve(pillars);
+        for (int i = 1; i <= pillars; ++i) {
+            const Date end = Calendar{}.advance(asof, Tenor{ 3 * i, TenorUnit::Months },
+                BusinessDayConvention::ModifiedFollowing);
+            const double par = 0.030 + 0.0002 * i;
+            helpers.push_back(std::make_shared<OisSwapHelper>(asof, end, par, cfg));
+        }
+        return helpers;
+    }
+
+    // Average wall time (ms) of one curve build.
+    double time_bootstrap(const Date& asof,
+        const std::vector<std::shared_ptr<OisSwapHelper>>& helpers,
+        const BootstrapOptions& opts,
+        int repeats,
+        BootstrapReport* report = nullptr) {
+        CurveBootstrapper bs;
+        PiecewiseDiscountCurve::Config cfg;
+        cfg.dc = DayCount::ACT365;
+
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) {
+            auto res = bs.bootstrap_discount_curve(asof, cfg, helpers, opts, report);
+            if (!res.has_value()) {
+                std::cerr << "Bootstrap failed: " << res.error().message << "\n";
+                return -1.0;
+            }
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(t1 - t0).count() / repeats;
+    }
+
+} // namespace
+
+int main() {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    const int repeats = 20;
+
+    BootstrapOptions full;
+    full.incremental = false;
+    BootstrapOptions incr;
+    incr.incremental = true;
+
+    std::cout << "=== OIS discount curve bootstrap: full rebuild vs incremental ===\n";
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "pillars   full[ms]   incremental[ms]   speedup\n";
+
+    for (int pillars : { 10, 20, 30, 40, 50 }) {
+        const auto helpers = make_ois_helpers(asof, pillars);
+        const double t_full = time_bootstrap(asof, helpers, full, repeats);
+        const double t_incr = time_bootstrap(asof, helpers, incr, repeats);
+        std::cout << std::setw(7) << pillars
+            << std::setw(11) << t_full
+            << std::setw(18) << t_incr
+            << std::setw(10) << (t_full / t_incr) << "x\n";
+    }
+
+    BootstrapOptions brent = incr;
+    brent.pillar_solver = PillarSolver::Brent;
+    BootstrapOptions newton = incr;
+    newton.pillar_solver = PillarSolver::Newton;
+
+    std::cout << "\n=== 50-pillar OIS curve: Brent vs Newton pillar solver (incremental) ===\n";
+    std::cout << "solver   time[ms]   iter/pillar   evals/pillar   fallbacks\n";
+
+    const auto helpers = make_ois_helpers(asof, 50);
+    for (const auto& [name, opts] : { std::pair{ "brent ", brent }, std::pair{ "newton", newton } }) {
+        BootstrapReport rep;
+        const double t = time_bootstrap(asof, helpers, opts, repeats, &rep);
+        std::cout << name
+            << std::setw(11) << t
+            << std::setw(14) << rep.avg_iterations_per_pillar()
+            << std::setw(15) << rep.avg_evaluations_per_pillar()
+            << std::setw(12) << rep.newton_fallbacks << "\n";
+    }
+
+    // Dual curve: 50 OIS + 50 IRS, sequential (discount then forward) vs joint Newton
+    IrsHelper::Config irs_cfg;
+    std::vector<std::shared_ptr<RateHelper>> irs_helpers;
+    for (const auto& h : helpers) {
+        irs_helpers.push_back(std::make_shared<IrsHelper>(asof, h->maturity(), h->market_quote() + 0.003, irs_cfg));
+    }
+
+    CurveBootstrapper bs;
+    JointBootstrapResult joint;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        auto d = bs.bootstrap_discount_curve(asof, {}, helpers, newton);
+        auto f = bs.bootstrap_forward_curve(asof, {}, *d.value(), irs_helpers, newton);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        auto res = bs.bootstrap_curves_jointly(asof, {}, {}, helpers, irs_helpers, newton);
+        if (!res.has_value()) {
+            std::cerr << "Joint solve failed: " << res.error().message << "\n";
+            return 1;
+        }
+        joint = std::move(res.value());
+    }
+    const auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "\n=== 100 instruments (50 OIS + 50 IRS): sequential vs joint solve ===\n";
+    std::cout << "sequential (Newton pillars) [ms]: "
+        << std::chrono::duration<double, std::milli>(t1 - t0).count() / repeats << "\n";
+    std::cout << "joint Newton [ms]:                "
+        << std::chrono::duration<double, std::milli>(t2 - t1).count() / repeats
+        << "  (iterations " << joint.iterations
+        << ", jacobian nnz " << joint.jacobian.nonzeros() << "/" << joint.jacobian.rows * joint.jacobian.cols << ")\n";
+
+    return 0;
+}
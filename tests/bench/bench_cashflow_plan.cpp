@@ -0,0 +1,107 @@
+// Benchmark: repricing a book of IBOR swaps after curve updates. Compares the
+// generic pricers (PortfolioPricer, no lines) with CashflowPlan: trades compiled once,
+// then price_plan per update.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_cashflow_plan [num_trades] [updates]
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/cashflow_plan.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+
+#include "bench_util.hpp"
+
+using namespace ir;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using bench::make_curve;
+using ir::testing::schedule;
+using bench::time_ms;
+
+int main(int argc, char** argv) {
+    const std::size_t num_trades = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    const std::size_t updates = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    market::FixingStore fixings;
+    market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    auto disc = make_curve<market::PiecewiseDiscountCurve>(asof, {}, 0.030, 0.0002);
+    auto fwd = make_curve<market::PiecewiseForwardCurve>(asof, {}, 0.032, 0.0002);
+    md.set_discount_curve(CurveId{ "DISCOUNT" }, disc);
+    md.set_forward_curve(CurveId{ "FWD_IBOR" }, fwd);
+
+    std::vector<PortfolioTrade> trades;
+    for (std::size_t k = 0; k < num_trades; ++k) {
+        const int years = 2 + static_cast<int>(k % 29);
+        FixedLegConfig fc;
+        fc.notional = 1e6;
+        fc.fixed_rate = 0.03;
+        IborLegConfig ic;
+        ic.notional = fc.notional;
+        ic.index = IndexId{ "EURIBOR6M" };
+        PortfolioTrade trade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{},
+            LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, years, 12), fc),
+            LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, years, 6), ic,
+                Calendar{}, BusinessDayConvention::ModifiedFollowing)) };
+        trades.push_back(std::move(trade));
+    }
+    const PricingContext ctx{ asof };
+
+    // Each update moves one node of each curve in place (same ids and axes)
+    auto update = [&](std::size_t u) {
+        const std::size_t i = 1 + u % 39;
+        (void)disc->set_node_value(i, disc->nodes().v[i] * (u % 2 ? 1.0001 : 0.9999));
+        (void)fwd->set_node_value(i, fwd->nodes().v[i] * (u % 2 ? 0.9999 : 1.0001));
+    };
+
+    std::cout << "=== " << num_trades << " IBOR swaps x " << updates << " curve updates, 1 thread ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    const auto disc_nodes = disc->nodes();
+    const auto fwd_nodes = fwd->nodes();
+    const PortfolioPricer pricer(PortfolioOptions{ 1, 0, false });
+    double sum_generic = 0.0;
+    const double t_generic = time_ms([&] {
+        for (std::size_t u = 0; u < updates; ++u) {
+            update(u);
+            for (const auto& r : pricer.price(trades, md, ctx)) sum_generic += r.value().pv;
+        }
+        });
+
+    std::vector<CashflowPlan> plans;
+    const double t_compile = time_ms([&] {
+        for (const auto& t : trades) plans.push_back(compile_plan(t, md, ctx).value());
+        });
+    const auto curves = plan_curves(plans.front(), md).value();   // all trades share the curves
+
+    double sum_plan = 0.0;
+    (void)disc->set_nodes(disc_nodes);   // replay the same updates from the start
+    (void)fwd->set_nodes(fwd_nodes);
+    const double t_plan = time_ms([&] {
+        for (std::size_t u = 0; u < updates; ++u) {
+            update(u);
+            for (const auto& p : plans) sum_plan += price_plan(p, curves).pv;
+        }
+        });
+
+    std::cout << "PortfolioPricer            [ms]: " << t_generic << "\n";
+    std::cout << "compile_plan (once)        [ms]: " << t_compile << "\n";
+    std::cout << "price_plan                 [ms]: " << t_plan << "  (" << t_generic / t_plan << "x faster)\n";
+    std::cout << std::scientific << std::setprecision(2) << "|sum PV difference|: " << std::abs(sum_generic - sum_plan) << "\n";
+    return 0;
+}
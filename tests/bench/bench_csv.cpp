@@ -0,0 +1,73 @@
+// Benchmark: reading a daily fixings history CSV (default 5M rows) with the row reader
+// (one unordered_map<string,string> per row) vs the memory-mapped columnar reader,
+// and the full load_fixings_csv into a FixingStore.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_csv [rows] [--no-legacy]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/io/csv_io.hpp"
+#include "ir/io/market_io.hpp"
+#include "ir/market/quotes.hpp"
+
+#include "bench_util.hpp"
+
+namespace fs = std::filesystem;
+
+using bench::time_ms;
+
+int main(int argc, char** argv) {
+    const std::size_t rows = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5'000'000;
+    const bool legacy = !(argc > 2 && std::string(argv[2]) == "--no-legacy");
+
+    const fs::path path = fs::temp_directory_path() / "ir_bench_fixings.csv";
+    {
+        std::ofstream out(path);
+        out << "Date,Rate\n";
+        const ir::Date d0 = ir::Date::from_ymd(1900, 1, 1);
+        char buf[32];
+        for (std::size_t i = 0; i < rows; ++i) {
+            std::snprintf(buf, sizeof(buf), "%.6f", 0.01 + 1e-9 * static_cast<double>(i));
+            out << (d0 + std::chrono::days{ static_cast<int>(i % 60000) }).to_iso() << "," << buf << "\n";
+        }
+    }
+    std::cout << "=== Fixings CSV: " << rows << " rows (" << fs::file_size(path) / (1024 * 1024) << " MB) ===\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    // Columnar reader first (best of 3) so the row reader's heap churn does not skew it
+    std::size_t check = 0;
+    double t_cols = 1e300;
+    for (int r = 0; r < 3; ++r) {
+        t_cols = std::min(t_cols, time_ms([&] {
+            auto tab = ir::io::read_csv_columns_file(path.string());
+            check += tab.has_value() ? tab.value().rows() : 0;
+            }));
+    }
+    std::cout << "read_csv_columns_file (mmap)  [ms]: " << t_cols << "\n";
+
+    if (legacy) {
+        const double t = time_ms([&] {
+            auto tab = ir::io::read_csv_file(path.string());
+            check += tab.has_value() ? tab.value().rows.size() : 0;
+            });
+        std::cout << "read_csv_file (row maps)      [ms]: " << t << "  (" << t / t_cols << "x)\n";
+    }
+
+    ir::market::FixingStore store;
+    const double t_load = time_ms([&] {
+        auto res = ir::io::load_fixings_csv(path.string(), ir::IndexId{ "SOFR" }, store);
+        if (!res.has_value()) std::cerr << res.error().message << "\n";
+        });
+    std::cout << "load_fixings_csv (parse+add)  [ms]: " << t_load << "\n";
+
+    fs::remove(path);
+    return check == 0 ? 1 : 0;
+}
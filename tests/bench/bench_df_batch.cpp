@@ -0,0 +1,114 @@
+// Benchmark: discounting a 10k-cashflow portfolio with scalar virtual df() calls vs
+// one DiscountCurve::df_batch() pass, and date-based df() with and without the curve's
+// per-day date cache. Reports the SIMD path compiled in
+// (configure with -DIR_ENABLE_AVX2=ON or -DIR_ENABLE_AVX512=ON).
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_df_batch
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/utils/simd.hpp"
+
+using namespace ir;
+using namespace ir::market;
+
+namespace {
+
+    template <class Eval>
+    double time_us(int repeats, Eval&& eval) {
+        double sink = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) sink += eval();
+        const auto t1 = std::chrono::steady_clock::now();
+        if (sink == 42.0) std::cout << "";   // keep the result alive
+        return std::chrono::duration<double, std::micro>(t1 - t0).count() / repeats;
+    }
+
+} // namespace
+
+int main() {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseDiscountCurve curve(asof, {});
+    ir::utils::Nodes1D nodes;
+    (void)nodes.push_back(0.0, 1.0);
+    for (int i = 1; i <= 60; ++i) {
+        const double t = 0.5 * i;
+        (void)nodes.push_back(t, std::exp(-0.03 * t));
+    }
+    (void)curve.set_nodes(nodes);
+    const DiscountCurve& disc = curve;
+
+    // 10k pay dates over 30Y: sorted (one leg after another) and shuffled
+    const std::size_t n = 10000;
+    std::vector<Date> dates(n);
+    std::vector<double> times(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        dates[i] = asof + std::chrono::days{ static_cast<int>(1 + (i * 10950) / n) };
+        times[i] = year_fraction(asof, dates[i], DayCount::ACT365);
+    }
+    std::vector<double> shuffled = times;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{ 7 });
+
+    std::vector<double> out(n);
+    const int repeats = 200;
+
+    std::cout << "SIMD path: " << ir::utils::simd::isa() << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "10k cashflows                scalar[us]   df_batch[us]   speedup\n";
+
+    auto row = [&](const char* name, double t_scalar, double t_batch) {
+        std::cout << std::left << std::setw(29) << name << std::right
+            << std::setw(10) << t_scalar
+            << std::setw(15) << t_batch
+            << std::setw(9) << (t_scalar / t_batch) << "x\n";
+        };
+
+    row("times, sorted",
+        time_us(repeats, [&] { double s = 0.0; for (double t : times) s += disc.df(t); return s; }),
+        time_us(repeats, [&] { disc.df_batch(times, out); return out.back(); }));
+    row("times, shuffled",
+        time_us(repeats, [&] { double s = 0.0; for (double t : shuffled) s += disc.df(t); return s; }),
+        time_us(repeats, [&] { disc.df_batch(shuffled, out); return out.back(); }));
+    row("dates, sorted",
+        time_us(repeats, [&] { double s = 0.0; for (const Date& d : dates) s += disc.df(d); return s; }),
+        time_us(repeats, [&] { disc.df_batch(dates, out); return out.back(); }));
+
+    // Date-based scalar queries: year_fraction per call vs the per-day t / DF tables
+    std::cout << "\n10k df(Date) calls             no cache[us]   t table[us]   t+DF table[us]\n";
+    for (const bool thirty : { false, true }) {
+        PiecewiseDiscountCurve::Config cfg;
+        cfg.dc = thirty ? DayCount::THIRTY360 : DayCount::ACT365;
+        PiecewiseDiscountCurve::Config t_cfg = cfg;
+        t_cfg.date_cache_days = kDateCache60Y;
+        PiecewiseDiscountCurve::Config v_cfg = t_cfg;
+        v_cfg.date_cache_values = true;
+
+        PiecewiseDiscountCurve c0(asof, cfg), c1(asof, t_cfg), c2(asof, v_cfg);
+        (void)c0.set_nodes(nodes);
+        (void)c1.set_nodes(nodes);
+        (void)c2.set_nodes(nodes);
+
+        auto run = [&](const PiecewiseDiscountCurve& c) {
+            return time_us(repeats, [&] { double s = 0.0; for (const Date& d : dates) s += c.df(d); return s; });
+            };
+        std::cout << (thirty ? "THIRTY360" : "ACT365   ")
+            << std::setw(27) << run(c0)
+            << std::setw(14) << run(c1)
+            << std::setw(17) << run(c2) << "\n";
+    }
+    PiecewiseDiscountCurve::Config v_cfg;
+    v_cfg.date_cache_days = kDateCache60Y;
+    v_cfg.date_cache_values = true;
+    PiecewiseDiscountCurve sized(asof, v_cfg);
+    (void)sized.set_nodes(nodes);
+    std::cout << "date cache footprint (60Y, t + DF): " << sized.date_cache_bytes() / 1024.0 << " KB\n";
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Benchmark: 10Y daily SOFR history lookups, the former string-keyed map
+// (index + "|" + ISO date per lookup) vs FixingStore by id, by handle and by range.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_fixings
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "ir/core/date.hpp"
+#include "ir/market/quotes.hpp"
+
+using namespace ir;
+
+namespace {
+
+    // The previous FixingStore layout, kept here as the baseline
+    class MapFixingStore {
+    public:
+        void add(const IndexId& index, const Date& d, double v) { fixings_[key(index, d)] = v; }
+        std::optional<double> get(const IndexId& index, const Date& d) const {
+            const auto it = fixings_.find(key(index, d));
+            if (it == fixings_.end()) return std::nullopt;
+            return it->second;
+        }
+    private:
+        static std::string key(const IndexId& index, const Date& d) { return index.value + "|" + d.to_iso(); }
+        std::unordered_map<std::string, double> fixings_;
+    };
+
+    template <class Loop>
+    double time_ns_per_day(int repeats, int days, Loop&& loop) {
+        double sink = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) sink += loop();
+        const auto t1 = std::chrono::steady_clock::now();
+        if (sink == 42.0) std::cout << "";   // keep the result alive
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(repeats) * days);
+    }
+
+} // namespace
+
+int main() {
+    const IndexId sofr{ "SOFR" };
+    const Date d0 = Date::from_ymd(2016, 1, 4);
+    const int days = 3653;
+
+    MapFixingStore legacy;
+    market::FixingStore store;
+    for (int i = 0; i < days; ++i) {
+        const Date d = d0 + std::chrono::days{ i };
+        legacy.add(sofr, d, 0.01 + 1e-6 * i);
+        store.add(sofr, d, 0.01 + 1e-6 * i);
+    }
+    const Date d1 = d0 + std::chrono::days{ days };
+    const int repeats = 50;
+
+    const double t_map = time_ns_per_day(repeats, days, [&] {
+        double s = 0.0;
+        for (Date d = d0; d < d1; d = d + std::chrono::days{ 1 }) s += legacy.get(sofr, d).value();
+        return s;
+        });
+    const double t_id = time_ns_per_day(repeats, days, [&] {
+        double s = 0.0;
+        for (Date d = d0; d < d1; d = d + std::chrono::days{ 1 }) s += store.get(sofr, d).value();
+        return s;
+        });
+    const double t_handle = time_ns_per_day(repeats, days, [&] {
+        double s = 0.0;
+        const auto h = store.handle(sofr);
+        for (Date d = d0; d < d1; d = d + std::chrono::days{ 1 }) s += store.get(h, d).value();
+        return s;
+        });
+    const double t_range = time_ns_per_day(repeats, days, [&] {
+        double s = 0.0;
+        for (double v : store.get_range(store.handle(sofr), d0, d1)) s += v;
+        return s;
+        });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "10Y daily SOFR history (" << days << " days), ns per lookup\n";
+    std::cout << "string-keyed map:        " << t_map << "\n";
+    std::cout << "FixingStore by IndexId:  " << t_id << "  (" << t_map / t_id << "x)\n";
+    std::cout << "FixingStore by handle:   " << t_handle << "  (" << t_map / t_handle << "x)\n";
+    std::cout << "FixingStore get_range:   " << t_range << "  (" << t_map / t_range << "x)\n";
+    return 0;
+}
@@ -0,0 +1,105 @@
+// Benchmark: intraday refresh of many append-only fixing histories. Compares
+// re-running load_fixings_csv on every file with FixingsFeed::refresh after one row
+// was appended to each. Default: 300 indices x 30 years of daily fixings.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_fixings_feed [indices] [years]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/io/fixings_feed.hpp"
+#include "ir/io/market_io.hpp"
+#include "ir/market/quotes.hpp"
+
+#include "bench_util.hpp"
+
+namespace fs = std::filesystem;
+
+using bench::time_ms;
+
+namespace {
+
+    std::string row(const ir::Date& d, double rate) {
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.6f", rate);
+        return d.to_iso() + "," + buf + "\n";
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int indices = argc > 1 ? std::atoi(argv[1]) : 300;
+    const int years = argc > 2 ? std::atoi(argv[2]) : 30;
+    const ir::Date today = ir::Date::from_ymd(2026, 1, 2);
+    const int days = 365 * years;
+
+    const fs::path dir = fs::temp_directory_path() / "ir_bench_fixings_feed";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    std::vector<std::string> paths;
+    std::uintmax_t total_bytes = 0;
+    for (int k = 0; k < indices; ++k) {
+        paths.push_back((dir / ("fixings_" + std::to_string(k) + ".csv")).string());
+        std::ofstream out(paths.back());
+        out << "Date,Rate\n";
+        for (int i = days; i >= 1; --i) {
+            out << row(today + std::chrono::days{ -i }, 0.01 + 1e-6 * ((i + k) % 1000));
+        }
+    }
+    for (const auto& p : paths) total_bytes += fs::file_size(p);
+
+    std::cout << "=== " << indices << " fixing files x " << days << " rows ("
+        << total_bytes / (1024 * 1024) << " MB) ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    ir::market::FixingStore store;
+    ir::io::FixingsFeed feed(store);
+    std::uint64_t bytes_first = 0;
+    const double t_first = time_ms([&] {
+        for (int k = 0; k < indices; ++k) {
+            auto res = feed.refresh(paths[k], ir::IndexId{ std::to_string(k) });
+            if (!res.has_value()) std::cerr << res.error().message << "\n";
+            else bytes_first += res.value().bytes_read;
+        }
+        });
+    std::cout << "FixingsFeed, first refresh       [ms]: " << t_first << "  (" << bytes_first / 1024 << " KB read)\n";
+
+    // Today's fixing lands in every file
+    for (int k = 0; k < indices; ++k) {
+        std::ofstream(paths[k], std::ios::app) << row(today, 0.02);
+    }
+
+    const double t_full = time_ms([&] {
+        ir::market::FixingStore fresh;
+        for (int k = 0; k < indices; ++k) {
+            auto res = ir::io::load_fixings_csv(paths[k], ir::IndexId{ std::to_string(k) }, fresh);
+            if (!res.has_value()) std::cerr << res.error().message << "\n";
+        }
+        });
+    std::cout << "load_fixings_csv, all files      [ms]: " << t_full << "\n";
+
+    std::uint64_t bytes_inc = 0;
+    std::size_t rows = 0;
+    const double t_inc = time_ms([&] {
+        for (int k = 0; k < indices; ++k) {
+            auto res = feed.refresh(paths[k], ir::IndexId{ std::to_string(k) });
+            if (!res.has_value()) std::cerr << res.error().message << "\n";
+            else {
+                bytes_inc += res.value().bytes_read;
+                rows += res.value().rows;
+            }
+        }
+        });
+    std::cout << "FixingsFeed, incremental refresh [ms]: " << t_inc << "  (" << rows << " rows, "
+        << bytes_inc / 1024 << " KB read, " << t_full / t_inc << "x)\n";
+
+    fs::remove_all(dir);
+    return rows == static_cast<std::size_t>(indices) ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+// Benchmark: virtual LogLinearInterpolator vs LogLinearKernel (plain, hinted and
+// batch lookups) on sorted cashflow-like times.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_interpolation
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ir/utils/interpolation.hpp"
+
+using namespace ir::utils;
+
+namespace {
+
+    template <class Eval>
+    double time_ns_per_point(int repeats, std::size_t points, Eval&& eval) {
+        double sink = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) sink += eval();
+        const auto t1 = std::chrono::steady_clock::now();
+        if (sink == 42.0) std::cout << "";   // keep the result alive
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / (static_cast<double>(repeats) * points);
+    }
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "nodes   points   virtual[ns]   kernel[ns]   hinted[ns]   batch[ns]\n";
+
+    for (int n_nodes : { 10, 50, 200 }) {
+        Interp1DData data;
+        for (int i = 0; i <= n_nodes; ++i) {
+            const double t = 30.0 * i / n_nodes;
+            data.x.push_back(t);
+            data.y.push_back(std::exp(-0.03 * t - 0.0005 * t * t));
+        }
+        const std::unique_ptr<IInterpolator1D> virt = std::make_unique<LogLinearInterpolator>(data);
+        LogLinearKernel kernel;
+        (void)kernel.assign(data.x, data.y);
+
+        // Daily grid over 30Y: sorted, many points per segment
+        std::vector<double> ts;
+        for (int d = 1; d <= 30 * 365; ++d) ts.push_back(d / 365.0);
+        std::vector<double> out(ts.size());
+        const int repeats = 50;
+
+        const double t_virt = time_ns_per_point(repeats, ts.size(), [&] {
+            double s = 0.0;
+            for (double t : ts) s += virt->value(t);
+            return s;
+            });
+        const double t_kernel = time_ns_per_point(repeats, ts.size(), [&] {
+            double s = 0.0;
+            for (double t : ts) s += kernel.value(t);
+            return s;
+            });
+        const double t_hinted = time_ns_per_point(repeats, ts.size(), [&] {
+            double s = 0.0;
+            std::size_t hint = 0;
+            for (double t : ts) s += kernel.value(t, hint);
+            return s;
+            });
+        const double t_batch = time_ns_per_point(repeats, ts.size(), [&] {
+            kernel.values(ts, out);
+            return out.back();
+            });
+
+        std::cout << std::setw(5) << n_nodes
+            << std::setw(9) << ts.size()
+            << std::setw(14) << t_virt
+            << std::setw(13) << t_kernel
+            << std::setw(13) << t_hinted
+            << std::setw(12) << t_batch << "\n";
+    }
+    return 0;
+}
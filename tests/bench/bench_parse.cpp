@@ -0,0 +1,101 @@
+// Benchmark: Tenor::parse / Date::parse_iso over a million CSV-like cells, against
+// the previous parsers (std::stoi on a std::string; std::stringstream into a
+// std::vector<int>), reproduced here as the baseline.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_parse [num_inputs]
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "ir/core/date.hpp"
+
+#include "bench_util.hpp"
+
+using namespace ir;
+
+using bench::time_ms;
+
+namespace {
+
+    Result<Tenor> legacy_tenor(std::string_view s) {
+        const std::size_t loc = s.find_first_of("dDwWmMyY");
+        if (s.size() < 2 || loc == std::string_view::npos || loc == 0) return Error::make(ErrorCode::ParseError, "bad tenor");
+        Tenor t;
+        try {
+            t.n = std::stoi(std::string(s.substr(0, loc)));
+        }
+        catch (...) {
+            return Error::make(ErrorCode::ParseError, "bad tenor");
+        }
+        switch (s.back()) {
+        case 'D': t.unit = TenorUnit::Days; break;
+        case 'W': t.unit = TenorUnit::Weeks; break;
+        case 'M': t.unit = TenorUnit::Months; break;
+        case 'Y': t.unit = TenorUnit::Years; break;
+        default: return Error::make(ErrorCode::ParseError, "bad tenor");
+        }
+        return t;
+    }
+
+    Result<Date> legacy_date(std::string_view iso) {
+        std::stringstream ss{ std::string(iso) };
+        std::vector<int> parts;
+        std::string seg;
+        while (std::getline(ss, seg, '-')) {
+            try {
+                parts.push_back(std::stoi(seg));
+            }
+            catch (...) {
+                return Error::make(ErrorCode::ParseError, "bad date");
+            }
+        }
+        if (parts.size() != 3) return Error::make(ErrorCode::InvalidDate, "bad date");
+        const std::chrono::year_month_day ymd{ std::chrono::year{ parts[0] },
+            std::chrono::month{ static_cast<unsigned>(parts[1]) }, std::chrono::day{ static_cast<unsigned>(parts[2]) } };
+        if (!ymd.ok()) return Error::make(ErrorCode::InvalidDate, "bad date");
+        return Date{ std::chrono::sys_days{ ymd } };
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+
+    // Cells as they appear in deal and market files; one in 50 is malformed
+    const char* units = "DWMY";
+    std::vector<std::string> tenors, dates;
+    tenors.reserve(n);
+    dates.reserve(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        tenors.push_back(k % 50 == 49 ? "XM" : std::to_string(1 + k % 30) + units[k % 4]);
+        dates.push_back(k % 50 == 49 ? "2025-13-01" : (Date::from_ymd(2000, 1, 1) + std::chrono::days{ static_cast<int>(k % 20000) }).to_iso());
+    }
+
+    // Checksums: tenor amounts and date serials, -1 per rejected cell
+    long tenor_sum[2]{}, date_sum[3]{};
+    auto checksum = [](const auto& r) -> long {
+        if (!r.has_value()) return -1;
+        if constexpr (std::is_same_v<std::decay_t<decltype(r.value())>, Tenor>) return r.value().n;
+        else return r.value().raw().time_since_epoch().count();
+    };
+    const double tenor_new = time_ms([&] { for (const auto& s : tenors) tenor_sum[0] += checksum(Tenor::parse(s)); });
+    const double tenor_old = time_ms([&] { for (const auto& s : tenors) tenor_sum[1] += checksum(legacy_tenor(s)); });
+    const double date_new = time_ms([&] { for (const auto& s : dates) date_sum[0] += checksum(Date::parse_iso(s)); });
+    const double date_old = time_ms([&] { for (const auto& s : dates) date_sum[1] += checksum(legacy_date(s)); });
+    const double date_try = time_ms([&] { for (const auto& s : dates) date_sum[2] += checksum(Date::try_parse_iso(s)); });
+    const bool match = tenor_sum[0] == tenor_sum[1] && date_sum[0] == date_sum[1] && date_sum[0] == date_sum[2];
+
+    std::cout << std::fixed << std::setprecision(2)
+        << n << " tenors:  Tenor::parse " << tenor_new << " ms, previous " << tenor_old
+        << " ms (x" << tenor_old / tenor_new << ")\n"
+        << n << " dates:   Date::parse_iso " << date_new << " ms, previous " << date_old
+        << " ms (x" << date_old / date_new << "), try_parse_iso " << date_try << " ms\n"
+        << "results " << (match ? "match" : "DIFFER") << "\n";
+    return match ? 0 : 1;
+}
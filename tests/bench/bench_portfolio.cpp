@@ -0,0 +1,116 @@
+// Benchmark: portfolio pricing throughput vs worker threads (1 .. hardware concurrency)
+// for a mixed book of IBOR swaps, OIS swaps and fixed legs on one shared MarketData.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_portfolio [num_trades] [max_threads]
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+
+#include "bench_util.hpp"
+
+using namespace ir;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using bench::make_curve;
+using ir::testing::schedule;
+
+int main(int argc, char** argv) {
+    const std::size_t num_trades = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    market::PiecewiseDiscountCurve::Config dcfg;
+    dcfg.date_cache_days = market::kDateCache60Y;
+    dcfg.date_cache_values = true;
+    market::PiecewiseForwardCurve::Config fcfg;
+    fcfg.date_cache_days = market::kDateCache60Y;
+    fcfg.date_cache_values = true;
+
+    market::FixingStore fixings;
+    market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(CurveId{ "DISCOUNT" }, make_curve<market::PiecewiseDiscountCurve>(asof, dcfg, 0.030, 0.0002, 41, 0.5));
+    md.set_forward_curve(CurveId{ "FWD_IBOR" }, make_curve<market::PiecewiseForwardCurve>(asof, fcfg, 0.032, 0.0002, 41, 0.5));
+    md.set_forward_curve(CurveId{ "FWD_RFR" }, make_curve<market::PiecewiseForwardCurve>(asof, fcfg, 0.029, 0.0002, 41, 0.5));
+
+    std::vector<PortfolioTrade> trades;
+    trades.reserve(num_trades);
+    for (std::size_t k = 0; k < num_trades; ++k) {
+        const int years = 1 + static_cast<int>(k % 30);
+        FixedLegConfig fc;
+        fc.notional = 1e6;
+        fc.fixed_rate = 0.03;
+        auto fixed = LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, years, 12), fc);
+        if (k % 3 == 0) {
+            IborLegConfig ic;
+            ic.notional = fc.notional;
+            ic.index = IndexId{ "EURIBOR6M" };
+            auto flt = LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, years, 6), ic,
+                Calendar{}, BusinessDayConvention::ModifiedFollowing);
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{}, fixed, flt) });
+        }
+        else if (k % 3 == 1) {
+            RfrLegConfig rc;
+            rc.notional = fc.notional;
+            rc.index = IndexId{ "SOFR" };
+            auto rfr = LegBuilder::build_rfr_compound_leg(PayReceive::Receive, schedule(asof, years, 12), rc);
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<OisSwap>, TradeInfo{}, fixed, rfr) });
+        }
+        else {
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<Leg>, fixed) });
+        }
+    }
+
+    PricingContext ctx;
+    ctx.valuation_date = asof;
+
+    const std::size_t hw = argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+        : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::size_t> counts;
+    for (std::size_t t = 1; t < hw; t *= 2) counts.push_back(t);
+    counts.push_back(hw);
+
+    std::cout << "=== Portfolio pricing: " << num_trades << " trades, 1.." << hw << " threads ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "threads   time[ms]   trades/s   speedup\n";
+
+    double t1 = 0.0;
+    for (std::size_t threads : counts) {
+        PortfolioOptions opts;
+        opts.threads = threads;
+        opts.keep_lines = false;
+        PortfolioPricer pricer(opts);
+
+        (void)pricer.price(trades, md, ctx);   // warm-up
+        const int repeats = 3;
+        const auto a = std::chrono::steady_clock::now();
+        double check = 0.0;
+        for (int r = 0; r < repeats; ++r) {
+            const auto res = pricer.price(trades, md, ctx);
+            for (const auto& x : res) check += x.has_value() ? x.value().pv : 0.0;
+        }
+        const auto b = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(b - a).count() / repeats;
+        if (threads == 1) t1 = ms;
+        std::cout << std::setw(7) << threads
+            << std::setw(11) << ms
+            << std::setw(11) << std::setprecision(0) << (num_trades / (ms * 1e-3)) << std::setprecision(2)
+            << std::setw(9) << (t1 / ms) << "x"
+            << (check == 0.0 ? " (no PV)" : "") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Benchmark: single-curve pricing of a 10Y daily-compounded RFR leg, closed-form
+// projection (default) vs the exact daily loop (PricingContext::rfr_exact_daily_projection).
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_rfr_projection
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "ir/core/date.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/instruments/coupons.hpp"
+#include "ir/instruments/leg.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+
+using namespace ir;
+
+int main() {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    auto curve = std::make_shared<market::PiecewiseDiscountCurve>(asof, market::PiecewiseDiscountCurve::Config{});
+    utils::Nodes1D nodes;
+    (void)nodes.push_back(0.0, 1.0);
+    for (int i = 1; i <= 40; ++i) (void)nodes.push_back(0.25 * i, std::exp(-0.03 * 0.25 * i));
+    (void)curve->set_nodes(nodes);
+
+    market::FixingStore fixings{};
+    market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(CurveId{ "DISCOUNT" }, curve);
+
+    instruments::Leg leg;
+    leg.leg_id = "RFR";
+    leg.direction = instruments::PayReceive::Receive;
+    for (int q = 0; q < 40; ++q) {
+        instruments::RfrObservation obs{ IndexId{ "SOFR" },
+            asof + std::chrono::days{ 91 * q }, asof + std::chrono::days{ 91 * (q + 1) }, DayCount::ACT360 };
+        leg.cashflows.push_back(std::make_shared<instruments::RfrCompoundCoupon>(obs.end, 1e6, 0.0, obs));
+    }
+
+    pricers::PricingContext ctx;
+    ctx.valuation_date = asof;
+    ctx.framework = pricers::PricingFramework::SingleCurve;
+    pricers::DiscountingSwapPricer pricer;
+
+    auto time_us = [&](bool exact, double& pv) {
+        ctx.rfr_exact_daily_projection = exact;
+        const int repeats = 50;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) pv = pricer.price_leg(leg, md, ctx).value().pv;
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(t1 - t0).count() / repeats;
+        };
+
+    double pv_fast = 0.0, pv_exact = 0.0;
+    const double t_exact = time_us(true, pv_exact);
+    const double t_fast = time_us(false, pv_fast);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "10Y quarterly RFR leg (40 coupons, ~3640 accrual days)\n";
+    std::cout << "daily loop [us]:   " << t_exact << "   pv " << pv_exact << "\n";
+    std::cout << "closed form [us]:  " << t_fast << "   pv " << pv_fast << "\n";
+    std::cout << "speedup:           " << t_exact / t_fast << "x\n";
+    return 0;
+}
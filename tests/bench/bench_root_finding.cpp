@@ -0,0 +1,109 @@
+// Benchmark: templated root finders vs the same solvers called through
+// std::function (the former non-template interface).
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_root_finding
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/rate_helpers.hpp"
+#include "ir/utils/root_finding.hpp"
+
+using namespace ir;
+using namespace ir::market;
+using namespace ir::utils;
+
+namespace {
+
+    template <class Solve>
+    double time_ns_per_solve(int repeats, Solve&& solve) {
+        double sink = 0.0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r) sink += solve();
+        const auto t1 = std::chrono::steady_clock::now();
+        if (sink == 42.0) std::cout << "";   // keep the result alive
+        return std::chrono::duration<double, std::nano>(t1 - t0).count() / repeats;
+    }
+
+    void report(const char* name, double t_template, double t_function) {
+        std::cout << std::left << std::setw(34) << name << std::right
+            << std::setw(12) << t_template
+            << std::setw(16) << t_function
+            << std::setw(10) << (t_function / t_template) << "x\n";
+    }
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "objective                         template[ns]   std::function[ns]   ratio\n";
+
+    // 1) Cheap analytic objective: call overhead dominates
+    {
+        const int repeats = 200000;
+        const double target = 0.97;
+        auto f = [target](double x) { return std::exp(-0.03 * x) - target; };
+        auto fdf = [target](double x, double& d) { const double e = std::exp(-0.03 * x); d = -0.03 * e; return e - target; };
+        const std::function<double(double)> f_erased = f;
+        const std::function<double(double, double&)> fdf_erased = fdf;
+
+        report("brent   exp(-rt) - p",
+            time_ns_per_solve(repeats, [&] { return brent(f, 0.0, 10.0).value().root; }),
+            time_ns_per_solve(repeats, [&] { return brent(f_erased, 0.0, 10.0).value().root; }));
+        report("newton  exp(-rt) - p",
+            time_ns_per_solve(repeats, [&] { return newton(fdf, 1.0, 0.0, 10.0).value().root; }),
+            time_ns_per_solve(repeats, [&] { return newton(fdf_erased, 1.0, 0.0, 10.0).value().root; }));
+        report("secant  exp(-rt) - p",
+            time_ns_per_solve(repeats, [&] { return secant(f, 0.5, 1.5).value().root; }),
+            time_ns_per_solve(repeats, [&] { return secant(f_erased, 0.5, 1.5).value().root; }));
+        report("bisect  exp(-rt) - p",
+            time_ns_per_solve(repeats, [&] { return bisection(f, 0.0, 10.0).value().root; }),
+            time_ns_per_solve(repeats, [&] { return bisection(f_erased, 0.0, 10.0).value().root; }));
+    }
+
+    // 2) Bootstrap objective: last pillar of a 20Y annual OIS curve
+    {
+        const int repeats = 20000;
+        const Date asof = Date::from_ymd(2026, 1, 2);
+        OisSwapHelper::Config cfg;
+        cfg.fixed_dc = DayCount::ACT360;
+
+        PiecewiseDiscountCurve curve(asof, {});
+        ir::utils::Nodes1D nodes;
+        (void)nodes.push_back(0.0, 1.0);
+        for (int y = 1; y <= 20; ++y) (void)nodes.push_back(y, std::exp(-0.03 * y));
+        (void)curve.set_nodes(nodes);
+
+        const OisSwapHelper helper(asof, Date::from_ymd(2046, 1, 2), 0.031, cfg);
+        std::vector<double> grad(nodes.t.size());
+
+        auto f = [&](double df) {
+            (void)curve.set_last_value(df);
+            return helper.implied_par_rate(curve).value() - helper.market_quote();
+        };
+        auto fdf = [&](double df, double& d) {
+            (void)curve.set_last_value(df);
+            const double v = helper.implied_par_rate(curve, grad).value() - helper.market_quote();
+            d = grad.back();
+            return v;
+        };
+        const std::function<double(double)> f_erased = f;
+        const std::function<double(double, double&)> fdf_erased = fdf;
+
+        report("brent   OIS 20Y last pillar",
+            time_ns_per_solve(repeats, [&] { return brent(f, 1e-8, 1.0).value().root; }),
+            time_ns_per_solve(repeats, [&] { return brent(f_erased, 1e-8, 1.0).value().root; }));
+        report("newton  OIS 20Y last pillar",
+            time_ns_per_solve(repeats, [&] { return newton(fdf, 0.5, 1e-8, 1.0).value().root; }),
+            time_ns_per_solve(repeats, [&] { return newton(fdf_erased, 0.5, 1e-8, 1.0).value().root; }));
+    }
+
+    return 0;
+}
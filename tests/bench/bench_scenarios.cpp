@@ -0,0 +1,142 @@
+// Benchmark: a book of IBOR swaps revalued under many scenarios (parallel shifts,
+// twists and node moves). Compares ScenarioEngine (compiled cashflows, overlay
+// markets) with rebuilding every shifted curve, date cache included, and pricing the
+// scenario market with PortfolioPricer.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_scenarios [num_trades] [num_scenarios] [threads]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/risk/scenario_engine.hpp"
+
+#include "bench_util.hpp"
+
+using namespace ir;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using bench::make_curve;
+using ir::testing::schedule;
+using bench::time_ms;
+
+int main(int argc, char** argv) {
+    const std::size_t num_trades = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    const std::size_t num_scenarios = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 500;
+    const std::size_t threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 0;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    market::PiecewiseDiscountCurve::Config dcfg;
+    dcfg.date_cache_days = market::kDateCache60Y;
+    dcfg.date_cache_values = true;
+    market::PiecewiseForwardCurve::Config fcfg;
+    fcfg.date_cache_days = market::kDateCache60Y;
+    fcfg.date_cache_values = true;
+
+    market::FixingStore fixings;
+    market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(CurveId{ "DISCOUNT" }, make_curve<market::PiecewiseDiscountCurve>(asof, dcfg, 0.030, 0.0002));
+    md.set_forward_curve(CurveId{ "FWD_IBOR" }, make_curve<market::PiecewiseForwardCurve>(asof, fcfg, 0.032, 0.0002));
+
+    std::vector<PortfolioTrade> trades;
+    for (std::size_t k = 0; k < num_trades; ++k) {
+        const int years = 2 + static_cast<int>(k % 29);
+        FixedLegConfig fc;
+        fc.notional = 1e6;
+        fc.fixed_rate = 0.03;
+        IborLegConfig ic;
+        ic.notional = fc.notional;
+        ic.index = IndexId{ "EURIBOR6M" };
+        trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{},
+            LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, years, 12), fc),
+            LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, years, 6), ic,
+                Calendar{}, BusinessDayConvention::ModifiedFollowing)) });
+    }
+    const PricingContext ctx{ asof };
+
+    // A third each of parallel shifts, twists and pseudo-historical node moves
+    std::vector<risk::Scenario> scenarios;
+    for (std::size_t s = 0; s < num_scenarios; ++s) {
+        const double x = static_cast<double>(s) / static_cast<double>(num_scenarios) - 0.5;
+        risk::CurveShift d{ CurveId{ "DISCOUNT" }, risk::CurveRole::Discount };
+        risk::CurveShift f{ CurveId{ "FWD_IBOR" }, risk::CurveRole::Forward };
+        if (s % 3 == 0) {
+            d.parallel = f.parallel = 0.01 * x;
+        }
+        else if (s % 3 == 1) {
+            d.twist = f.twist = 0.0004 * x;
+            d.pivot = f.pivot = 10.0;
+        }
+        else {
+            for (int i = 0; i < 40; ++i) {
+                d.node_shifts.push_back(0.002 * std::sin(7.0 * x + 0.3 * i));
+                f.node_shifts.push_back(0.002 * std::cos(5.0 * x + 0.2 * i));
+            }
+        }
+        scenarios.push_back(risk::Scenario{ "s" + std::to_string(s), { d, f } });
+    }
+
+    const risk::ScenarioEngine engine(risk::ScenarioOptions{ threads });
+    const PortfolioPricer pricer(PortfolioOptions{ threads, 0, false });
+    std::cout << "=== " << num_trades << " IBOR swaps x " << num_scenarios << " scenarios, 2 curves x 40 pillars, "
+        << pricer.threads() << " threads ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    ir::Result<risk::ScenarioResult> fast = risk::ScenarioResult{};
+    const double t_fast = time_ms([&] { fast = engine.run(trades, md, scenarios, ctx); });
+    std::cout << "ScenarioEngine                   [ms]: " << t_fast << "  ("
+        << 1e3 * t_fast / static_cast<double>(num_scenarios * num_trades) << " us per trade-scenario)\n";
+
+    // Reference on a sample of scenarios: rebuild the shifted curves with their date
+    // cache and reprice the book through the generic pricer
+    const std::size_t sample = std::min<std::size_t>(num_scenarios, 20);
+    double max_diff = 0.0;
+    const double t_slow = time_ms([&] {
+        for (std::size_t s = 0; s < sample; ++s) {
+            market::MarketData scen = md;
+            for (const auto& sh : scenarios[s].shifts) {
+                auto shift_nodes = [&](utils::Nodes1D n) {
+                    for (std::size_t i = 0; i < n.t.size(); ++i) {
+                        const double dz = sh.parallel + sh.twist * (n.t[i] - sh.pivot) + (sh.node_shifts.empty() ? 0.0 : sh.node_shifts[i]);
+                        n.v[i] *= std::exp(-dz * n.t[i]);
+                    }
+                    return n;
+                };
+                if (sh.role == risk::CurveRole::Discount) {
+                    auto c = std::make_shared<market::PiecewiseDiscountCurve>(asof, dcfg);
+                    (void)c->set_nodes(shift_nodes(dynamic_cast<const market::PiecewiseDiscountCurve&>(md.discount_curve(sh.curve)).nodes()));
+                    scen.set_discount_curve(sh.curve, c);
+                }
+                else {
+                    auto c = std::make_shared<market::PiecewiseForwardCurve>(asof, fcfg);
+                    (void)c->set_nodes(shift_nodes(dynamic_cast<const market::PiecewiseForwardCurve&>(md.forward_curve(sh.curve)).nodes()));
+                    scen.set_forward_curve(sh.curve, c);
+                }
+            }
+            const auto pvs = pricer.price(trades, scen, ctx);
+            for (std::size_t k = 0; k < trades.size(); ++k) {
+                max_diff = std::max(max_diff, std::abs(pvs[k].value().pv - fast.value().trade_pv(s, k)));
+            }
+        }
+        });
+    const double t_slow_all = t_slow * static_cast<double>(num_scenarios) / static_cast<double>(sample);
+    std::cout << "Rebuild curves + PortfolioPricer [ms]: " << t_slow_all << "  (extrapolated from " << sample
+        << " scenarios, " << t_slow_all / t_fast << "x ScenarioEngine)\n";
+    std::cout << std::scientific << std::setprecision(2) << "max |engine - pricer| PV: " << max_diff << "\n";
+    return fast.has_value() ? 0 : 1;
+}
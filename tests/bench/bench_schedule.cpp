@@ -0,0 +1,135 @@
+// Benchmark: schedule generation and business-day arithmetic on holiday calendars.
+// Builds USNY+GBLO-like calendars (synthetic holidays, ~10 per year each), generates
+// schedules for a book of trades, and compares the calendar's table lookups with
+// stepping day by day against a sorted holiday list. Repeats the book through
+// ScheduleCache.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_schedule [num_trades]
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/core/schedule_cache.hpp"
+
+#include "bench_util.hpp"
+
+using namespace ir;
+
+using bench::time_ms;
+
+namespace {
+
+    std::vector<Date> holidays(unsigned seed) {
+        std::vector<Date> out;
+        for (int y = 1990; y < 2090; ++y) {
+            for (unsigned k = 0; k < 10; ++k) {
+                const unsigned m = 1 + (k * 7 + seed) % 12;
+                const unsigned d = 1 + (k * 11 + seed * 3 + static_cast<unsigned>(y)) % 28;
+                out.push_back(Date::from_ymd(y, m, d));
+            }
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    // The pre-table approach: weekday check, binary search, one day at a time
+    struct SteppingCalendar {
+        std::vector<Date> hols;   // sorted
+
+        bool is_business_day(const Date& d) const {
+            const unsigned w = std::chrono::weekday{ d.raw() }.c_encoding();
+            return w != 0 && w != 6 && !std::binary_search(hols.begin(), hols.end(), d);
+        }
+        Date advance_business_days(Date d, int n) const {
+            const std::chrono::days step{ n > 0 ? 1 : -1 };
+            for (int left = n > 0 ? n : -n; left > 0;) {
+                d = d + step;
+                if (is_business_day(d)) --left;
+            }
+            return d;
+        }
+        long business_days_between(Date a, const Date& b) const {
+            long n = 0;
+            for (; a < b; a = a + std::chrono::days{ 1 }) n += is_business_day(a) ? 1 : 0;
+            return n;
+        }
+    };
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t num_trades = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+
+    const auto us = holidays(1);
+    const auto uk = holidays(5);
+    Calendar joint;
+    const double build_ms = time_ms([&] {
+        joint = Calendar::join(Calendar::from_holidays("USNY", us), Calendar::from_holidays("GBLO", uk));
+    });
+    std::vector<Date> both(us);
+    both.insert(both.end(), uk.begin(), uk.end());
+    std::sort(both.begin(), both.end());
+    const SteppingCalendar stepping{ both };
+
+    // -------- Schedules --------
+    std::size_t dates = 0;
+    const double sched_ms = time_ms([&] {
+        for (std::size_t k = 0; k < num_trades; ++k) {
+            ScheduleConfig sc;
+            sc.start = Date::from_ymd(2026, 1, 2) + std::chrono::days{ static_cast<int>(k % 2000) };
+            sc.end = joint.advance(sc.start, Tenor{ 1 + static_cast<int>(k % 30), TenorUnit::Years }, sc.bdc);
+            sc.tenor = Tenor{ k % 2 ? 3 : 6, TenorUnit::Months };
+            sc.calendar = joint;
+            dates += make_schedule(sc).dates.size();
+        }
+    });
+
+    // Same book through ScheduleCache: 6000 distinct configurations
+    ScheduleCache cache;
+    std::size_t cached_dates = 0;
+    const double cached_ms = time_ms([&] {
+        for (std::size_t k = 0; k < num_trades; ++k) {
+            ScheduleConfig sc;
+            sc.start = Date::from_ymd(2026, 1, 2) + std::chrono::days{ static_cast<int>(k % 2000) };
+            sc.end = joint.advance(sc.start, Tenor{ 1 + static_cast<int>(k % 30), TenorUnit::Years }, sc.bdc);
+            sc.tenor = Tenor{ k % 2 ? 3 : 6, TenorUnit::Months };
+            sc.calendar = joint;
+            cached_dates += cache.get(sc)->dates.size();
+        }
+    });
+
+    // -------- Business-day arithmetic --------
+    long check_table = 0, check_step = 0;
+    const double table_ms = time_ms([&] {
+        for (std::size_t k = 0; k < num_trades; ++k) {
+            const Date d = Date::from_ymd(2026, 1, 2) + std::chrono::days{ static_cast<int>(k % 5000) };
+            const int n = 1 + static_cast<int>(k % 60);
+            const Date e = joint.advance_business_days(d, n);
+            check_table += joint.business_days_between(d, e) + (e - d).count();
+        }
+    });
+    const double step_ms = time_ms([&] {
+        for (std::size_t k = 0; k < num_trades; ++k) {
+            const Date d = Date::from_ymd(2026, 1, 2) + std::chrono::days{ static_cast<int>(k % 5000) };
+            const int n = 1 + static_cast<int>(k % 60);
+            const Date e = stepping.advance_business_days(d, n);
+            check_step += stepping.business_days_between(d, e) + (e - d).count();
+        }
+    });
+
+    std::cout << std::fixed << std::setprecision(2)
+        << "calendar " << joint.name() << ": built in " << build_ms << " ms\n"
+        << "schedules: " << num_trades << " trades, " << dates << " dates, " << sched_ms << " ms\n"
+        << "  cached:   " << cached_ms << " ms (" << cache.stats().misses << " generated, "
+        << cache.stats().hits << " hits)" << (cached_dates == dates ? "" : " DIFFER") << "\n"
+        << "advance_business_days + business_days_between (1..60 days), " << num_trades << " calls:\n"
+        << "  table:    " << table_ms << " ms\n"
+        << "  stepping: " << step_ms << " ms  (x" << step_ms / table_ms << ")\n"
+        << "checks " << (check_table == check_step ? "match" : "DIFFER") << "\n";
+    return check_table == check_step && cached_dates == dates ? 0 : 1;
+}
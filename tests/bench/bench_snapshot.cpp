@@ -0,0 +1,119 @@
+// Benchmark: market startup from CSV files (one per curve / fixing index) vs one
+// binary snapshot (save_snapshot / load_snapshot). Default market: 100 discount +
+// 100 forward curves with 40 nodes, 20 fixing indices with 30 years of daily history.
+// Not registered with CTest; run manually from a Release build:
+//   ./tests/bench_snapshot [curves] [indices]
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/io/market_io.hpp"
+#include "ir/io/snapshot.hpp"
+#include "ir/market/market_data.hpp"
+
+#include "bench_util.hpp"
+
+namespace fs = std::filesystem;
+
+using bench::time_ms;
+
+namespace {
+
+    void write_curve(const fs::path& p, const char* header, const ir::Date& asof, double rate) {
+        std::ofstream out(p);
+        out << "Date," << header << "\n";
+        char buf[32];
+        for (int i = 0; i < 40; ++i) {
+            const int day = (i == 0) ? 0 : 30 * i * i / 4 + 1;
+            std::snprintf(buf, sizeof(buf), "%.12f", std::exp(-rate * day / 365.0));
+            out << (asof + std::chrono::days{ day }).to_iso() << "," << buf << "\n";
+        }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const int curves = argc > 1 ? std::atoi(argv[1]) : 200;
+    const int indices = argc > 2 ? std::atoi(argv[2]) : 20;
+    const int history_days = 30 * 365;
+    const ir::Date asof = ir::Date::from_ymd(2026, 1, 2);
+
+    const fs::path dir = fs::temp_directory_path() / "ir_bench_snapshot";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    for (int c = 0; c < curves; ++c) {
+        const bool disc = (c % 2 == 0);
+        write_curve(dir / ("curve_" + std::to_string(c) + ".csv"), disc ? "DF" : "PseudoDF",
+            asof, 0.02 + 0.0001 * c);
+    }
+    for (int k = 0; k < indices; ++k) {
+        std::ofstream out(dir / ("fixings_" + std::to_string(k) + ".csv"));
+        out << "Date,Rate\n";
+        char buf[32];
+        for (int i = 1; i <= history_days; ++i) {
+            std::snprintf(buf, sizeof(buf), "%.6f", 0.01 + 1e-6 * ((i * 7 + k) % 1000));
+            out << (asof + std::chrono::days{ -i }).to_iso() << "," << buf << "\n";
+        }
+    }
+
+    auto load_csv = [&](ir::market::MarketData& md, ir::market::FixingStore& store) {
+        for (int c = 0; c < curves; ++c) {
+            const std::string p = (dir / ("curve_" + std::to_string(c) + ".csv")).string();
+            const ir::CurveId id{ std::to_string(c) };
+            auto res = (c % 2 == 0) ? ir::io::load_discount_curve_nodes_csv(p, id, md)
+                : ir::io::load_forward_curve_nodes_csv(p, id, md);
+            if (!res.has_value()) std::cerr << res.error().message << "\n";
+        }
+        for (int k = 0; k < indices; ++k) {
+            const std::string p = (dir / ("fixings_" + std::to_string(k) + ".csv")).string();
+            auto res = ir::io::load_fixings_csv(p, ir::IndexId{ std::to_string(k) }, store);
+            if (!res.has_value()) std::cerr << res.error().message << "\n";
+        }
+        md.set_fixings(&store);
+    };
+
+    std::cout << "=== Market: " << curves << " curves, " << indices << " indices x "
+        << history_days << " days ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+
+    double t_csv = 1e300;
+    for (int r = 0; r < 3; ++r) {
+        ir::market::MarketData md(asof);
+        ir::market::FixingStore store;
+        t_csv = std::min(t_csv, time_ms([&] { load_csv(md, store); }));
+    }
+    std::cout << "CSV folder load        [ms]: " << t_csv << "\n";
+
+    ir::market::MarketData md(asof);
+    ir::market::FixingStore store;
+    load_csv(md, store);
+    const fs::path snap_file = dir / "market.irsnap";
+    std::size_t bytes = 0;
+    const double t_save = time_ms([&] {
+        auto res = ir::io::save_snapshot(md, snap_file.string());
+        if (!res.has_value()) std::cerr << res.error().message << "\n";
+        else bytes = res.value();
+        });
+    std::cout << "save_snapshot          [ms]: " << t_save << "  (" << bytes / 1024 << " KB)\n";
+
+    double t_snap = 1e300;
+    std::size_t check = 0;
+    for (int r = 0; r < 3; ++r) {
+        t_snap = std::min(t_snap, time_ms([&] {
+            auto snap = ir::io::load_snapshot(snap_file.string());
+            check += snap.has_value() ? snap.value().md->discount_curve_ids().size() : 0;
+            }));
+    }
+    std::cout << "load_snapshot          [ms]: " << t_snap << "  (" << t_csv / t_snap << "x)\n";
+
+    fs::remove_all(dir);
+    return check == 0 ? 1 : 0;
+}
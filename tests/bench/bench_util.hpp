@@ -0,0 +1,38 @@
+// Helpers shared by the benchmarks in this directory (schedule() is ir::testing::schedule).
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+#include "ir/core/date.hpp"
+#include "ir/utils/piecewise_nodes.hpp"
+
+#include "../support/schedule.hpp"
+
+namespace bench {
+
+    // Wall time of one call of f, in milliseconds
+    template <class F>
+    double time_ms(F&& f) {
+        const auto t0 = std::chrono::steady_clock::now();
+        f();
+        const auto t1 = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+
+    // Piecewise curve on `pillars` pillars 0, step, 2 step, .. with zero rate
+    // r0 + slope * i at pillar i
+    template <class Curve>
+    std::shared_ptr<Curve> make_curve(const ir::Date& asof, typename Curve::Config cfg, double r0, double slope,
+        int pillars = 40, double step = 0.75) {
+        auto c = std::make_shared<Curve>(asof, cfg);
+        ir::utils::Nodes1D n;
+        for (int i = 0; i < pillars; ++i) {
+            n.t.push_back(step * i);
+            n.v.push_back(std::exp(-(r0 + slope * i) * step * i));
+        }
+        (void)c->set_nodes(n);
+        return c;
+    }
+
+} // namespace bench
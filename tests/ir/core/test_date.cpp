@@ -1,4 +1,5 @@
 #include "ir/core/date.hpp"
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
@@ -28,6 +29,15 @@ TEST_CASE("Date::") {
 		Result<Date> date_error2 = Date::parse_iso("01-Nov-2025");
 		REQUIRE_FALSE(date_error2.has_value());
 		REQUIRE(date_error2.error().code == ErrorCode::ParseError);
+
+		// Non fixed-width form, impossible calendar dates, trailing garbage
+		REQUIRE(Date::parse_iso("2026-1-5").value() == Date::from_ymd(2026, 1, 5));
+		REQUIRE(Date::parse_iso("2024-02-29").value() == Date::from_ymd(2024, 2, 29));
+		REQUIRE(Date::parse_iso("2026-02-29").error().code == ErrorCode::InvalidDate);
+		REQUIRE(Date::parse_iso("2026-13-01").error().code == ErrorCode::InvalidDate);
+		REQUIRE(Date::parse_iso("2026-01-2x").error().code == ErrorCode::ParseError);
+		REQUIRE(Date::parse_iso("2026-01-02-03").error().code == ErrorCode::InvalidDate);
+		REQUIRE(Date::parse_iso("").error().code == ErrorCode::ParseError);
 	}
 
 	SECTION("Date::year/month/day") {
@@ -60,6 +70,30 @@ TEST_CASE("Tenor::parse") {
 	REQUIRE(my_tenor_error.error().code == ErrorCode::ParseError);
 	REQUIRE(my_tenor_error.error().message == "Tenor string does not consist of numeric tenor amount and tenor unit (D/W/M/Y)");
 
+	my_tenor_error = Tenor::parse("3m");
+	REQUIRE(my_tenor_error.error().message == "Unknown tenor unit (expected D,W,M,Y)");
+	REQUIRE(Tenor::parse("-6M").value().n == -6);
+}
+
+TEST_CASE("try_parse and literals: constexpr, non-throwing parsing") {
+	using namespace ir::literals;
+
+	static_assert("3M"_tenor.n == 3 && "3M"_tenor.unit == TenorUnit::Months);
+	static_assert("10y"_tenor.unit == TenorUnit::Years);
+	static_assert("2025-09-30"_date == Date::from_ymd(2025, 9, 30));
+	static_assert(Date::try_parse_iso("2024-2-29") == Date::from_ymd(2024, 2, 29));
+	static_assert(!Date::try_parse_iso("2025-02-29"));
+	static_assert(!Tenor::try_parse("3"));
+
+	for (const char* bad : { "", "M", "+M", "3", "3 M", "3MM", "99999999999D", "3m" }) {
+		REQUIRE_FALSE(Tenor::try_parse(bad));
+		REQUIRE_FALSE(Tenor::parse(bad).has_value());
+	}
+	for (const char* bad : { "", "2025", "2025-09", "2025-09-", "-09-30", "2025-09-30-", "2025-09-3a", "2025/09/30" }) {
+		REQUIRE_FALSE(Date::try_parse_iso(bad));
+		REQUIRE_FALSE(Date::parse_iso(bad).has_value());
+	}
+	REQUIRE(Tenor::try_parse("+2W").value().n == 2);
 }
 
 
@@ -167,6 +201,53 @@ TEST_CASE("Calendar::advance (Days, Weeks, Months, Years) with adjustment") {
 
 }
 
+TEST_CASE("Calendar: holidays, joint calendars and business-day arithmetic") {
+    // 2026-05-25 (Mon) and 2026-07-03 (Fri) in one, 2026-05-25 and 2026-08-31 (Mon) in the other
+    const std::vector<Date> us{ Date::from_ymd(2026, 5, 25), Date::from_ymd(2026, 7, 3) };
+    const std::vector<Date> uk{ Date::from_ymd(2026, 5, 25), Date::from_ymd(2026, 8, 31) };
+    const Calendar usny = Calendar::from_holidays("USNY", us);
+    const Calendar gblo = Calendar::from_holidays("GBLO", uk);
+    const Calendar both = Calendar::join(usny, gblo);
+    REQUIRE(Calendar{}.name() == "WEEKENDS");
+    REQUIRE(both.name() == "USNY+GBLO");
+
+    REQUIRE_FALSE(usny.is_business_day(Date::from_ymd(2026, 7, 3)));
+    REQUIRE(gblo.is_business_day(Date::from_ymd(2026, 7, 3)));
+    REQUIRE_FALSE(both.is_business_day(Date::from_ymd(2026, 7, 3)));
+    REQUIRE_FALSE(both.is_business_day(Date::from_ymd(2026, 8, 31)));
+
+    // Fri 2026-07-03 -> Mon 07-06 / Thu 07-02; Mon 2026-08-31 -> Fri 08-28 (ModifiedFollowing)
+    REQUIRE(usny.adjust(Date::from_ymd(2026, 7, 3), BusinessDayConvention::Following) == Date::from_ymd(2026, 7, 6));
+    REQUIRE(usny.adjust(Date::from_ymd(2026, 7, 3), BusinessDayConvention::Preceding) == Date::from_ymd(2026, 7, 2));
+    REQUIRE(both.adjust(Date::from_ymd(2026, 8, 31), BusinessDayConvention::ModifiedFollowing) == Date::from_ymd(2026, 8, 28));
+
+    // Thu 2026-07-02 + 1 business day skips the holiday and the weekend
+    REQUIRE(usny.advance_business_days(Date::from_ymd(2026, 7, 2), 1) == Date::from_ymd(2026, 7, 6));
+    REQUIRE(usny.advance_business_days(Date::from_ymd(2026, 7, 6), -1) == Date::from_ymd(2026, 7, 2));
+    REQUIRE(usny.advance_business_days(Date::from_ymd(2026, 7, 4), 0) == Date::from_ymd(2026, 7, 6));
+    REQUIRE(usny.business_days_between(Date::from_ymd(2026, 7, 1), Date::from_ymd(2026, 7, 8)) == 4);
+    REQUIRE(usny.business_days_between(Date::from_ymd(2026, 7, 8), Date::from_ymd(2026, 7, 1)) == -4);
+
+    // Table lookups agree with stepping one day at a time, also across the table's
+    // end (2100-01-01), where only weekends are holidays
+    auto stepped = [&](const Calendar& cal, Date d, int n) {
+        const int step = n > 0 ? 1 : -1;
+        for (int left = n > 0 ? n : -n; left > 0;) {
+            d = d + std::chrono::days{ step };
+            if (cal.is_business_day(d)) --left;
+        }
+        return d;
+    };
+    for (const Date start : { Date::from_ymd(2026, 5, 20), Date::from_ymd(2099, 12, 20) }) {
+        for (int n = -15; n <= 15; ++n) {
+            if (n == 0) continue;
+            const Date d = start + std::chrono::days{ n };
+            REQUIRE(both.advance_business_days(d, n) == stepped(both, d, n));
+            REQUIRE(both.business_days_between(d, both.advance_business_days(d, n)) == (n > 0 ? n - 1 + (both.is_business_day(d) ? 1 : 0) : n));
+        }
+    }
+}
+
 TEST_CASE("year_fraction: basic day count conventions") {
     Date d1 = Date::from_ymd(2026, 1, 1);
     Date d2 = Date::from_ymd(2026, 4, 1); // 90 days later (Jan31+Feb28+Mar31 = 90)
@@ -260,4 +341,4 @@ TEST_CASE("make_schedule: forward and backward monthly schedules and EOM behavio
         REQUIRE(s.dates[1] == Date::from_ymd(2026, 2, 27));
         REQUIRE(s.dates[2] == Date::from_ymd(2026, 3, 31));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/schedule_cache.hpp"
+
+using namespace ir;
+
+TEST_CASE("ScheduleCache: identical configurations share one schedule") {
+    ScheduleCache cache;
+    ScheduleConfig sc;
+    sc.start = Date::from_ymd(2026, 1, 30);
+    sc.end = Date::from_ymd(2031, 1, 30);
+    sc.tenor = Tenor{ 3, TenorUnit::Months };
+
+    const auto a = cache.get(sc);
+    REQUIRE(a->dates == make_schedule(sc).dates);
+    REQUIRE(cache.get(sc) == a);
+
+    // Any key field gives a different entry, including the calendar's holidays
+    sc.rule = DateGenerationRule::Forward;
+    REQUIRE(cache.get(sc) != a);
+    const auto target = Calendar::from_holidays("TARGET", std::vector<Date>{ Date::from_ymd(2026, 4, 30) });
+    sc.calendar = target;
+    const auto b = cache.get(sc);
+    REQUIRE(b->dates == make_schedule(sc).dates);
+    REQUIRE(b->dates[1] == Date::from_ymd(2026, 4, 29));
+
+    // Calendars are told apart by their holidays, not their names
+    sc.calendar = Calendar::from_holidays("TARGET", std::vector<Date>{ Date::from_ymd(2026, 7, 30) });
+    REQUIRE(sc.calendar.fingerprint() != target.fingerprint());
+    const auto c = cache.get(sc);
+    REQUIRE(c != b);
+    REQUIRE(c->dates[1] == Date::from_ymd(2026, 4, 30));
+    sc.calendar = Calendar::from_holidays("EUR", std::vector<Date>{ Date::from_ymd(2026, 4, 30) });
+    REQUIRE(sc.calendar.fingerprint() == target.fingerprint());
+    REQUIRE(cache.get(sc) == b);
+    sc.calendar = target;
+
+    std::atomic<int> shared{ 0 };
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (int k = 0; k < 100; ++k) shared += cache.get(sc) == b ? 1 : 0;
+        });
+    }
+    for (auto& t : threads) t.join();
+    REQUIRE(shared == 400);
+
+    const auto s = cache.stats();
+    REQUIRE(s.entries == 4);
+    REQUIRE(s.misses == 4);
+    REQUIRE(s.hits == 402);
+    REQUIRE(s.evictions == 0);
+    cache.clear();
+    REQUIRE(cache.stats().entries == 0);
+    REQUIRE(cache.stats().hits == 0);
+}
+
+TEST_CASE("ScheduleCache: drops the least recently used entry at capacity") {
+    ScheduleCache cache(2);
+    auto config = [](int years) {
+        ScheduleConfig sc;
+        sc.start = Date::from_ymd(2026, 1, 30);
+        sc.end = Date::from_ymd(2026 + years, 1, 30);
+        sc.tenor = Tenor{ 6, TenorUnit::Months };
+        return sc;
+    };
+
+    const auto one = cache.get(config(1));
+    const auto two = cache.get(config(2));
+    REQUIRE(cache.get(config(1)) == one);   // 1Y is now the most recent
+    const auto three = cache.get(config(3));   // drops 2Y
+    REQUIRE(cache.stats().entries == 2);
+    REQUIRE(cache.stats().evictions == 1);
+    REQUIRE(cache.get(config(1)) == one);
+    REQUIRE(cache.get(config(3)) == three);
+
+    // An evicted schedule stays valid for its holders and is regenerated on request
+    REQUIRE(two->dates.size() == 5);
+    const auto again = cache.get(config(2));
+    REQUIRE(again != two);
+    REQUIRE(again->dates == two->dates);
+    const auto st = cache.stats();
+    REQUIRE(st.misses == 4);
+    REQUIRE(st.hits == 3);
+    REQUIRE(st.evictions == 2);
+}
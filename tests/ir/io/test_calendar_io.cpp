@@ -0,0 +1,35 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/io/calendar_io.hpp"
+
+using ir::Date;
+
+TEST_CASE("parse_holiday_calendar reads one date per line", "[io][calendar_io]") {
+    const std::string text =
+        "Date,Name\n"
+        "# US federal holidays\n"
+        "2026-05-25,Memorial Day\r\n"
+        "\n"
+        " 2026-07-03 , Independence Day (observed)\n";
+    auto cal = ir::io::parse_holiday_calendar(text, "USNY");
+    REQUIRE(cal.has_value());
+    REQUIRE(cal.value().name() == "USNY");
+    REQUIRE_FALSE(cal.value().is_business_day(Date::from_ymd(2026, 5, 25)));
+    REQUIRE_FALSE(cal.value().is_business_day(Date::from_ymd(2026, 7, 3)));
+    REQUIRE(cal.value().is_business_day(Date::from_ymd(2026, 7, 2)));
+
+    auto bad = ir::io::parse_holiday_calendar("2026-05-25\n2026-13-01\n", "X");
+    REQUIRE_FALSE(bad.has_value());
+    REQUIRE(bad.error().message.find("line 2") != std::string::npos);
+
+    // Only a title-like first row is taken as a header; a bad first date is an error
+    auto bad_first = ir::io::parse_holiday_calendar("2026-13-01\n2026-05-25\n", "X");
+    REQUIRE_FALSE(bad_first.has_value());
+    REQUIRE(bad_first.error().message.find("line 1") != std::string::npos);
+    REQUIRE(ir::io::parse_holiday_calendar("Holiday\n2026-05-25\n", "X").has_value());
+
+    REQUIRE_FALSE(ir::io::load_holiday_calendar("no/such/holidays.csv", "X").has_value());
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ir/io/csv_io.hpp"
+
+namespace fs = std::filesystem;
+
+TEST_CASE("read_csv_columns_text tokenises into per-column views", "[io][csv]") {
+    const std::string text = "Date, Rate\r\n2026-01-02 ,0.031\r\n\r\n2026-01-05,  0.032\n2026-01-06,0.033";
+    auto res = ir::io::read_csv_columns_text(text);
+    REQUIRE(res.has_value());
+    const auto& tab = res.value();
+
+    REQUIRE(tab.headers == std::vector<std::string>{ "Date", "Rate" });
+    REQUIRE(tab.rows() == 3);
+    auto rate = tab.column("Rate");
+    REQUIRE(rate.has_value());
+    REQUIRE((*rate.value())[0] == "0.031");
+    REQUIRE((*rate.value())[1] == "0.032");
+    REQUIRE((*rate.value())[2] == "0.033");
+    REQUIRE(tab.columns[0][0] == "2026-01-02");
+
+    // Cells are views into the source text, not copies
+    REQUIRE(tab.columns[0][2].data() >= text.data());
+    REQUIRE(tab.columns[0][2].data() < text.data() + text.size());
+
+    REQUIRE_FALSE(tab.column("PseudoDF").has_value());
+}
+
+TEST_CASE("read_csv_columns_text rejects ragged rows and missing header", "[io][csv]") {
+    auto short_row = ir::io::read_csv_columns_text("A,B\n1,2\n3\n");
+    REQUIRE_FALSE(short_row.has_value());
+    REQUIRE(short_row.error().message.find("line 3") != std::string::npos);
+
+    REQUIRE_FALSE(ir::io::read_csv_columns_text("A,B\n1,2,3\n").has_value());
+    REQUIRE_FALSE(ir::io::read_csv_columns_text("\n  \n").has_value());
+}
+
+TEST_CASE("read_csv_columns_text reads a header-only table without a trailing newline", "[io][csv]") {
+    // Substring of a larger buffer, so reading past the view's end is not masked by a terminator
+    const std::string buffer = "Date,Rate\n2026-01-02,0.031\n";
+    auto res = ir::io::read_csv_columns_text(std::string_view(buffer).substr(0, 9));
+    REQUIRE(res.has_value());
+    REQUIRE(res.value().headers == std::vector<std::string>{ "Date", "Rate" });
+    REQUIRE(res.value().rows() == 0);
+
+    auto one_row = ir::io::read_csv_columns_text(std::string_view(buffer).substr(0, buffer.size() - 1));
+    REQUIRE(one_row.has_value());
+    REQUIRE(one_row.value().rows() == 1);
+    REQUIRE(one_row.value().columns[1][0] == "0.031");
+}
+
+TEST_CASE("read_csv_columns_file maps the file and matches the row reader", "[io][csv]") {
+    const fs::path p = fs::temp_directory_path() / "ir_csv_io_test.csv";
+    {
+        std::ofstream out(p);
+        out << "Date,DF\n";
+        for (int i = 0; i < 1000; ++i) out << "2026-01-02," << 1.0 - 1e-4 * i << "\n";
+    }
+
+    auto cols = ir::io::read_csv_columns_file(p.string());
+    auto rows = ir::io::read_csv_file(p.string());
+    REQUIRE(cols.has_value());
+    REQUIRE(rows.has_value());
+    REQUIRE(cols.value().source != nullptr);
+    REQUIRE(cols.value().rows() == rows.value().rows.size());
+    for (std::size_t i = 0; i < rows.value().rows.size(); ++i) {
+        REQUIRE(cols.value().columns[1][i] == rows.value().rows[i].at("DF"));
+    }
+
+    // The table keeps the mapping alive after the last other reference is gone
+    auto copy = cols.value();
+    cols = ir::Error::make(ir::ErrorCode::Ok, "");
+    REQUIRE(copy.columns[0][999] == "2026-01-02");
+
+    fs::remove(p);
+    REQUIRE_FALSE(ir::io::read_csv_columns_file(p.string()).has_value());
+}
+
+TEST_CASE("parse_double is strict and CsvColumns::describe locates cells", "[io][csv]") {
+    REQUIRE(ir::io::parse_double("0.0315").value() == 0.0315);
+    REQUIRE(ir::io::parse_double("+1e-4").value() == 1e-4);
+    REQUIRE(ir::io::parse_double("-2").value() == -2.0);
+    REQUIRE_FALSE(ir::io::parse_double("").has_value());
+    REQUIRE_FALSE(ir::io::parse_double("0.5abc").has_value());
+    REQUIRE_FALSE(ir::io::parse_double("abc").has_value());
+
+    const std::string text = "Date,Rate\n\n2026-01-02,0.031\n2026-01-05,  x1\n";
+    auto res = ir::io::read_csv_columns_text(text);
+    REQUIRE(res.has_value());
+    REQUIRE(res.value().describe(1, 1) == "'x1' (Rate, line 4, column 14)");
+    REQUIRE(res.value().describe(0, 0) == "'2026-01-02' (Date, line 3, column 1)");
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/io/fixings_feed.hpp"
+#include "ir/io/snapshot.hpp"
+
+namespace fs = std::filesystem;
+using ir::Date;
+
+namespace {
+
+    void write_file(const fs::path& p, const std::string& text) {
+        fs::create_directories(p.parent_path());
+        std::ofstream(p, std::ios::binary | std::ios::trunc) << text;
+    }
+
+    void append(const fs::path& p, const std::string& text) {
+        std::ofstream(p, std::ios::binary | std::ios::app) << text;
+    }
+
+} // namespace
+
+TEST_CASE("FixingsFeed parses only appended rows", "[io][fixings_feed]") {
+    const fs::path dir = fs::temp_directory_path() / "ir_fixings_feed_test";
+    fs::remove_all(dir);
+    const fs::path file = dir / "fixings_sofr.csv";
+    write_file(file, "Date,Rate\n2026-01-02,0.0430\n2026-01-05,0.0431\n");
+    const ir::IndexId sofr{ "SOFR" };
+
+    ir::market::FixingStore store;
+    ir::io::FixingsFeed feed(store);
+
+    auto first = feed.refresh(file.string(), sofr);
+    REQUIRE(first.has_value());
+    REQUIRE(first.value().full_reload);
+    REQUIRE(first.value().rows == 2);
+    REQUIRE(fs::exists(ir::io::FixingsFeed::sidecar_path(file.string())));
+
+    // Nothing new
+    auto idle = feed.refresh(file.string(), sofr);
+    REQUIRE(idle.has_value());
+    REQUIRE_FALSE(idle.value().full_reload);
+    REQUIRE(idle.value().rows == 0);
+
+    // One row appended, plus the start of the next one still being written
+    append(file, "2026-01-06,0.0432\n2026-01-0");
+    auto next = feed.refresh(file.string(), sofr);
+    REQUIRE(next.has_value());
+    REQUIRE_FALSE(next.value().full_reload);
+    REQUIRE(next.value().rows == 1);
+    REQUIRE(store.get(sofr, Date::from_ymd(2026, 1, 6)).value() == 0.0432);
+
+    append(file, "7,0.0433\n");
+    auto rest = feed.refresh(file.string(), sofr);
+    REQUIRE(rest.has_value());
+    REQUIRE(rest.value().rows == 1);
+    REQUIRE(store.get(sofr, Date::from_ymd(2026, 1, 7)).value() == 0.0433);
+    REQUIRE(store.get(sofr, Date::from_ymd(2026, 1, 2)).value() == 0.0430);
+
+    // A rewritten history is detected and reloaded in full
+    write_file(file, "Date,Rate\n2026-01-02,0.0500\n2026-01-05,0.0431\n2026-01-06,0.0432\n2026-01-07,0.0433\n");
+    auto rewritten = feed.refresh(file.string(), sofr);
+    REQUIRE(rewritten.has_value());
+    REQUIRE(rewritten.value().full_reload);
+    REQUIRE(store.get(sofr, Date::from_ymd(2026, 1, 2)).value() == 0.0500);
+
+    // Bad appended rows are reported with the file name
+    append(file, "2026-01-08,abc\n");
+    auto bad = feed.refresh(file.string(), sofr);
+    REQUIRE_FALSE(bad.has_value());
+    REQUIRE(bad.error().message.find("fixings_sofr.csv") != std::string::npos);
+}
+
+TEST_CASE("FixingsFeed resumes from the sidecar when the store already has the history", "[io][fixings_feed]") {
+    const fs::path dir = fs::temp_directory_path() / "ir_fixings_feed_resume";
+    fs::remove_all(dir);
+    const fs::path file = dir / "fixings_estr.csv";
+    write_file(file, "Date,Rate\n2026-01-02,0.0190\n2026-01-05,0.0191\n");
+    const ir::IndexId estr{ "ESTR" };
+
+    // Day 1: load and persist the store with a snapshot
+    const fs::path snap_file = dir / "market.irsnap";
+    {
+        ir::market::FixingStore store;
+        ir::io::FixingsFeed feed(store);
+        REQUIRE(feed.refresh(file.string(), estr).has_value());
+        ir::market::MarketData md(Date::from_ymd(2026, 1, 5));
+        md.set_fixings(&store);
+        REQUIRE(ir::io::save_snapshot(md, snap_file.string()).has_value());
+    }
+    append(file, "2026-01-06,0.0192\n");
+
+    SECTION("restored store: only the appended row is parsed") {
+        auto snap = ir::io::load_snapshot(snap_file.string());
+        REQUIRE(snap.has_value());
+        ir::io::FixingsFeed feed(*snap.value().fixings);
+        auto res = feed.refresh(file.string(), estr);
+        REQUIRE(res.has_value());
+        REQUIRE_FALSE(res.value().full_reload);
+        REQUIRE(res.value().rows == 1);
+        REQUIRE(snap.value().md->fixings(estr, Date::from_ymd(2026, 1, 6)).value() == 0.0192);
+    }
+    SECTION("empty store: the sidecar is not trusted") {
+        ir::market::FixingStore store;
+        ir::io::FixingsFeed feed(store);
+        auto res = feed.refresh(file.string(), estr);
+        REQUIRE(res.has_value());
+        REQUIRE(res.value().full_reload);
+        REQUIRE(res.value().rows == 3);
+    }
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "ir/core/date.hpp"
+#include "ir/core/ids.hpp"
+#include "ir/io/market_cache.hpp"
+
+namespace fs = std::filesystem;
+using ir::Date;
+
+namespace {
+
+    void write_file(const fs::path& p, const std::string& text) {
+        fs::create_directories(p.parent_path());
+        std::ofstream(p) << text;
+    }
+
+} // namespace
+
+TEST_CASE("fnv1a_64 matches the reference vectors", "[io][market_cache]") {
+    REQUIRE(ir::io::fnv1a_64("") == 0xcbf29ce484222325ULL);
+    REQUIRE(ir::io::fnv1a_64("a") == 0xaf63dc4c8601ec8cULL);
+    REQUIRE(ir::io::fnv1a_64("foobar") == 0x85944171f73967e8ULL);
+}
+
+TEST_CASE("MarketFileCache builds each distinct file content once", "[io][market_cache]") {
+    const fs::path dir = fs::temp_directory_path() / "ir_market_cache_test";
+    fs::remove_all(dir);
+    const std::string disc = "Date,DF\n2026-01-02,1\n2027-01-02,0.97\n2028-01-02,0.94\n";
+    write_file(dir / "a" / "discount.csv", disc);
+    write_file(dir / "b" / "discount.csv", disc);   // same content, other path
+    write_file(dir / "c" / "discount.csv", "Date,DF\n2026-01-02,1\n2027-01-02,0.96\n");
+    write_file(dir / "fixings.csv", "Date,Rate\n2025-12-31,0.031\n2025-12-30,0.030\n");
+
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    ir::io::MarketFileCache cache;
+
+    auto a = cache.discount_curve((dir / "a" / "discount.csv").string(), asof);
+    auto b = cache.discount_curve((dir / "b" / "discount.csv").string(), asof);
+    auto a2 = cache.discount_curve((dir / "a" / ".." / "a" / "discount.csv").string(), asof);
+    auto c = cache.discount_curve((dir / "c" / "discount.csv").string(), asof);
+    REQUIRE(a.has_value());
+    REQUIRE(b.has_value());
+    REQUIRE(a2.has_value());
+    REQUIRE(c.has_value());
+
+    REQUIRE(a.value() == b.value());
+    REQUIRE(a.value() == a2.value());
+    REQUIRE(a.value() != c.value());
+    REQUIRE_THAT(a.value()->df(Date::from_ymd(2027, 1, 2)), Catch::Matchers::WithinAbs(0.97, 1e-12));
+
+    // Another asof builds a new curve from the already-read file
+    auto later = cache.discount_curve((dir / "a" / "discount.csv").string(), Date::from_ymd(2026, 6, 1));
+    REQUIRE(later.has_value());
+    REQUIRE(later.value() != a.value());
+
+    auto fx = cache.fixings((dir / "fixings.csv").string());
+    REQUIRE(fx.has_value());
+    REQUIRE(fx.value()->size() == 2);
+    REQUIRE(fx.value()->front().first == Date::from_ymd(2025, 12, 31));
+    REQUIRE(fx.value()->front().second == 0.031);
+
+    const auto st = cache.stats();
+    REQUIRE(st.files_read == 4);   // a, b, c, fixings (a/../a is the same path)
+    REQUIRE(st.built == 4);        // a(=b), c, a at the later asof, fixings
+    REQUIRE(st.hits == 2);
+
+    // Missing file and wrong columns are errors, not exceptions
+    REQUIRE_FALSE(cache.discount_curve((dir / "missing.csv").string(), asof).has_value());
+    REQUIRE_FALSE(cache.forward_curve((dir / "fixings.csv").string(), asof).has_value());
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("MarketFileCache shares one fixing store per set of fixing files", "[io][market_cache]") {
+    const fs::path dir = fs::temp_directory_path() / "ir_market_cache_fixings_test";
+    fs::remove_all(dir);
+    const std::string sofr = "Date,Rate\n2025-12-31,0.031\n2025-12-30,0.030\n";
+    write_file(dir / "a" / "SOFR.csv", sofr);
+    write_file(dir / "b" / "SOFR.csv", sofr);   // same content, other folder
+    write_file(dir / "ESTR.csv", "Date,Rate\n2025-12-31,0.021\n");
+
+    const ir::IndexId sofr_id{ "SOFR" };
+    const ir::IndexId estr_id{ "ESTR" };
+    ir::io::MarketFileCache cache;
+    auto a = cache.fixing_store({ { sofr_id, (dir / "a" / "SOFR.csv").string() }, { estr_id, (dir / "ESTR.csv").string() } });
+    auto b = cache.fixing_store({ { estr_id, (dir / "ESTR.csv").string() }, { sofr_id, (dir / "b" / "SOFR.csv").string() } });
+    auto c = cache.fixing_store({ { sofr_id, (dir / "a" / "SOFR.csv").string() } });
+    REQUIRE(a.has_value());
+    REQUIRE(b.has_value());
+    REQUIRE(c.has_value());
+
+    REQUIRE(a.value() == b.value());
+    REQUIRE(a.value() != c.value());
+    REQUIRE(a.value()->get(sofr_id, Date::from_ymd(2025, 12, 30)) == 0.030);
+    REQUIRE(a.value()->get(estr_id, Date::from_ymd(2025, 12, 31)) == 0.021);
+    REQUIRE_FALSE(c.value()->get(estr_id, Date::from_ymd(2025, 12, 31)).has_value());
+
+    REQUIRE_FALSE(cache.fixing_store({ { sofr_id, (dir / "missing.csv").string() } }).has_value());
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("Market file parse errors carry header, line and column", "[io][market_cache]") {
+    const fs::path p = fs::temp_directory_path() / "ir_market_io_bad.csv";
+    write_file(p, "Date,PseudoDF\n2026-01-02,1\n2027-01-02,0.9x7\n");
+
+    ir::io::MarketFileCache cache;
+    auto res = cache.forward_curve(p.string(), Date::from_ymd(2026, 1, 2));
+    REQUIRE_FALSE(res.has_value());
+    REQUIRE(res.error().code == ir::ErrorCode::ParseError);
+    REQUIRE(res.error().message.find("'0.9x7' (PseudoDF, line 3, column 12)") != std::string::npos);
+
+    fs::remove(p);
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/io/snapshot.hpp"
+#include "ir/market/curves.hpp"
+
+namespace fs = std::filesystem;
+using ir::Date;
+
+namespace {
+
+    std::string read_bytes(const fs::path& p) {
+        std::ifstream f(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(f), {});
+    }
+
+    void write_bytes(const fs::path& p, const std::string& bytes) {
+        std::ofstream(p, std::ios::binary | std::ios::trunc) << bytes;
+    }
+
+} // namespace
+
+TEST_CASE("Snapshot round-trips curves, quotes and fixings", "[io][snapshot]") {
+    using namespace ir::market;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    PiecewiseDiscountCurve::Config dcfg;
+    dcfg.dc = ir::DayCount::ACT360;
+    dcfg.bdc = ir::BusinessDayConvention::Following;
+    dcfg.date_cache_days = 3 * 366;
+    dcfg.date_cache_values = true;
+    auto disc = std::make_shared<PiecewiseDiscountCurve>(asof, dcfg);
+    REQUIRE(disc->set_nodes({ { 0.0, 1.0, 2.0 }, { 1.0, 0.97, 0.94 } }).has_value());
+
+    auto fwd = std::make_shared<PiecewiseForwardCurve>(asof, PiecewiseForwardCurve::Config{});
+    REQUIRE(fwd->set_nodes({ { 0.0, 1.5 }, { 1.0, 0.95 } }).has_value());
+
+    FixingStore store;
+    store.add(ir::IndexId{ "ESTR" }, Date::from_ymd(2025, 12, 30), 0.0191);
+    store.add(ir::IndexId{ "ESTR" }, Date::from_ymd(2026, 1, 2), 0.0193);   // gap on 12-31 and 01-01
+    store.add(ir::IndexId{ "SOFR" }, Date::from_ymd(2025, 12, 31), 0.043);
+
+    MarketData md(asof);
+    md.set_discount_curve(ir::CurveId{ "EUR-OIS" }, disc);
+    md.set_forward_curve(ir::CurveId{ "EUR-6M" }, fwd);
+    md.set_quote("EUR-OIS-1Y", Quote{ QuoteType::Rate, 0.025 });
+    md.set_quote("EUR-6M-SPREAD", Quote{ QuoteType::Spread, 0.0012 });
+    md.set_fixings(&store);
+
+    const fs::path file = fs::temp_directory_path() / "ir_snapshot_test.irsnap";
+    auto written = ir::io::save_snapshot(md, file.string());
+    REQUIRE(written.has_value());
+    REQUIRE(written.value() == fs::file_size(file));
+
+    auto snap = ir::io::load_snapshot(file.string());
+    REQUIRE(snap.has_value());
+    const MarketData& out = *snap.value().md;
+    REQUIRE(out.asof() == asof);
+
+    const auto& d = dynamic_cast<const PiecewiseDiscountCurve&>(out.discount_curve(ir::CurveId{ "EUR-OIS" }));
+    REQUIRE(d.nodes().t == disc->nodes().t);
+    REQUIRE(d.nodes().v == disc->nodes().v);
+    REQUIRE(d.config().dc == ir::DayCount::ACT360);
+    REQUIRE(d.config().bdc == ir::BusinessDayConvention::Following);
+    REQUIRE(d.config().date_cache_days == 3 * 366);
+    REQUIRE(d.config().date_cache_values);
+    REQUIRE(d.date_cache_values().size() == disc->date_cache_values().size());
+    const Date mid = Date::from_ymd(2027, 5, 17);
+    REQUIRE(d.df(mid) == disc->df(mid));
+
+    const auto& f = out.forward_curve(ir::CurveId{ "EUR-6M" });
+    REQUIRE(f.forward_rate(asof, mid, ir::DayCount::ACT360) == fwd->forward_rate(asof, mid, ir::DayCount::ACT360));
+
+    REQUIRE(out.quotes().size() == 2);
+    REQUIRE(out.quote("EUR-6M-SPREAD")->type == QuoteType::Spread);
+    REQUIRE(out.quote("EUR-OIS-1Y")->value == 0.025);
+
+    REQUIRE(out.fixings(ir::IndexId{ "ESTR" }, Date::from_ymd(2025, 12, 30)).value() == 0.0191);
+    REQUIRE(out.fixings(ir::IndexId{ "ESTR" }, Date::from_ymd(2026, 1, 2)).value() == 0.0193);
+    REQUIRE_FALSE(out.fixings(ir::IndexId{ "ESTR" }, Date::from_ymd(2025, 12, 31)).has_value());
+    REQUIRE(out.fixings(ir::IndexId{ "SOFR" }, Date::from_ymd(2025, 12, 31)).value() == 0.043);
+
+    // Same market, same bytes
+    const fs::path again = fs::temp_directory_path() / "ir_snapshot_test_again.irsnap";
+    REQUIRE(ir::io::save_snapshot(out, again.string()).has_value());
+    REQUIRE(read_bytes(again) == read_bytes(file));
+}
+
+TEST_CASE("load_snapshot rejects foreign, stale and damaged files", "[io][snapshot]") {
+    using namespace ir::market;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    auto disc = std::make_shared<PiecewiseDiscountCurve>(asof, PiecewiseDiscountCurve::Config{});
+    REQUIRE(disc->set_nodes({ { 0.0, 1.0 }, { 1.0, 0.97 } }).has_value());
+    MarketData md(asof);
+    md.set_discount_curve(ir::CurveId{ "USD-SOFR" }, disc);
+
+    const fs::path file = fs::temp_directory_path() / "ir_snapshot_bad.irsnap";
+    REQUIRE(ir::io::save_snapshot(md, file.string()).has_value());
+    const std::string good = read_bytes(file);
+
+    SECTION("not a snapshot") {
+        write_bytes(file, "Date,DF\n2026-01-02,1\n" + std::string(64, ' '));
+        auto res = ir::io::load_snapshot(file.string());
+        REQUIRE_FALSE(res.has_value());
+        REQUIRE(res.error().message.find("not a market snapshot") != std::string::npos);
+    }
+    SECTION("other version") {
+        std::string bytes = good;
+        bytes[8] = static_cast<char>(ir::io::kSnapshotVersion + 1);
+        write_bytes(file, bytes);
+        auto res = ir::io::load_snapshot(file.string());
+        REQUIRE_FALSE(res.has_value());
+        REQUIRE(res.error().message.find("unsupported version") != std::string::npos);
+    }
+    SECTION("truncated") {
+        write_bytes(file, good.substr(0, good.size() - 8));
+        auto res = ir::io::load_snapshot(file.string());
+        REQUIRE_FALSE(res.has_value());
+        REQUIRE(res.error().message.find("truncated") != std::string::npos);
+    }
+    SECTION("node offset out of range") {
+        std::string bytes = good;
+        bytes[64 + 32] = '\x7f';   // high byte region of CurveRecord::nodes_offset
+        bytes[64 + 38] = '\x7f';
+        write_bytes(file, bytes);
+        auto res = ir::io::load_snapshot(file.string());
+        REQUIRE_FALSE(res.has_value());
+        REQUIRE(res.error().message.find("bad discount curve record") != std::string::npos);
+    }
+}
+
+TEST_CASE("set_nodes with a saved date cache adopts it only if it fits", "[io][snapshot]") {
+    using namespace ir::market;
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseDiscountCurve::Config cfg;
+    cfg.date_cache_days = 2 * 366;
+    cfg.date_cache_values = true;
+    const ir::utils::Nodes1D nodes{ { 0.0, 1.0, 2.0 }, { 1.0, 0.97, 0.94 } };
+
+    PiecewiseDiscountCurve ref(asof, cfg);
+    REQUIRE(ref.set_nodes(nodes).has_value());
+    const std::vector<double> saved(ref.date_cache_values().begin(), ref.date_cache_values().end());
+
+    PiecewiseDiscountCurve adopted(asof, cfg);
+    REQUIRE(adopted.set_nodes(nodes, saved).has_value());
+    REQUIRE(std::vector<double>(adopted.date_cache_values().begin(), adopted.date_cache_values().end()) == saved);
+
+    // A table from other nodes is rejected and rebuilt from the curve's own nodes
+    PiecewiseDiscountCurve other(asof, cfg);
+    REQUIRE(other.set_nodes({ { 0.0, 1.0, 2.0 }, { 1.0, 0.95, 0.90 } }, saved).has_value());
+    REQUIRE(other.date_cache_values().size() == saved.size());
+    const Date d = Date::from_ymd(2027, 7, 1);
+    REQUIRE(other.df(d) < ref.df(d));
+}
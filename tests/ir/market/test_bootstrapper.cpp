@@ -300,3 +300,361 @@ TEST_CASE("CurveBootstrapper::bootstrap_forward_curve - IRS helpers", "[bootstra
     REQUIRE_THAT(fwd_1y, Catch::Matchers::WithinAbs(0.029, 1e-5));
 
 }
+
+TEST_CASE("CurveBootstrapper: incremental and full-rebuild modes agree", "[bootstrapper][ois]") {
+    CurveBootstrapper bootstrapper;
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    PiecewiseDiscountCurve::Config cfg;
+    cfg.dc = DayCount::ACT365;
+
+    OisSwapHelper::Config ois_cfg;
+    ois_cfg.fixed_dc = DayCount::ACT360;
+    ois_cfg.fixed_freq = Frequency::Annual;
+
+    std::vector<std::shared_ptr<OisSwapHelper>> helpers;
+    for (int y = 1; y <= 10; ++y) {
+        helpers.push_back(std::make_shared<OisSwapHelper>(
+            asof, Date::from_ymd(2026 + y, 1, 1), 0.025 + 0.001 * y, ois_cfg));
+    }
+
+    BootstrapOptions full;
+    full.incremental = false;
+    BootstrapOptions incr;
+    incr.incremental = true;
+
+    auto r_full = bootstrapper.bootstrap_discount_curve(asof, cfg, helpers, full);
+    auto r_incr = bootstrapper.bootstrap_discount_curve(asof, cfg, helpers, incr);
+    REQUIRE(r_full.has_value());
+    REQUIRE(r_incr.has_value());
+
+    const auto& n_full = r_full.value()->nodes();
+    const auto& n_incr = r_incr.value()->nodes();
+    REQUIRE(n_full.t.size() == n_incr.t.size());
+    for (std::size_t i = 0; i < n_full.t.size(); ++i) {
+        REQUIRE(n_full.t[i] == n_incr.t[i]);
+        REQUIRE_THAT(n_incr.v[i], Catch::Matchers::WithinAbs(n_full.v[i], 1e-12));
+    }
+
+    for (const auto& h : helpers) {
+        auto implied = h->implied_par_rate(*r_incr.value());
+        REQUIRE(implied.has_value());
+        REQUIRE_THAT(implied.value(), Catch::Matchers::WithinAbs(h->market_quote(), 1e-5));
+    }
+}
+
+TEST_CASE("OisSwapHelper: cached schedule is reused across curves with different time axes", "[bootstrapper][ois]") {
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    OisSwapHelper::Config ois_cfg;
+    ois_cfg.fixed_dc = DayCount::ACT360;
+    ois_cfg.fixed_freq = Frequency::Quarterly;
+    OisSwapHelper helper(asof, Date::from_ymd(2028, 1, 1), 0.03, ois_cfg);
+
+    // Same continuously-compounded zero rate on two different time axes.
+    auto make_curve = [&](DayCount dc) {
+        PiecewiseDiscountCurve::Config cfg;
+        cfg.dc = dc;
+        PiecewiseDiscountCurve curve(asof, cfg);
+        ir::utils::Nodes1D nodes;
+        REQUIRE(nodes.push_back(0.0, 1.0).has_value());
+        const double t = year_fraction(asof, Date::from_ymd(2030, 1, 1), dc);
+        REQUIRE(nodes.push_back(t, std::exp(-0.03 * t)).has_value());
+        REQUIRE(curve.set_nodes(nodes).has_value());
+        return curve;
+    };
+
+    const auto c365 = make_curve(DayCount::ACT365);
+    const auto c360 = make_curve(DayCount::ACT360);
+
+    auto r365 = helper.implied_par_rate(c365);
+    auto r360 = helper.implied_par_rate(c360);
+    auto r365_again = helper.implied_par_rate(c365);
+    REQUIRE(r365.has_value());
+    REQUIRE(r360.has_value());
+    REQUIRE(r365_again.has_value());
+
+    REQUIRE(r365.value() == r365_again.value());
+    REQUIRE_FALSE(r365.value() == r360.value());
+}
+
+TEST_CASE("Rate helpers: analytic node gradients match finite differences", "[bootstrapper][gradient]") {
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    PiecewiseDiscountCurve disc(asof, PiecewiseDiscountCurve::Config{});
+    PiecewiseForwardCurve fwd(asof, PiecewiseForwardCurve::Config{});
+    ir::utils::Nodes1D dn, fn;
+    for (double t : { 0.0, 0.5, 1.0, 2.0, 3.0 }) {
+        REQUIRE(dn.push_back(t, std::exp(-0.03 * t)).has_value());
+        REQUIRE(fn.push_back(t, std::exp(-0.035 * t - 0.001 * t * t)).has_value());
+    }
+    REQUIRE(disc.set_nodes(dn).has_value());
+    REQUIRE(fwd.set_nodes(fn).has_value());
+
+    OisSwapHelper ois(asof, Date::from_ymd(2028, 7, 1), 0.03, OisSwapHelper::Config{});
+    IrsHelper irs(asof, Date::from_ymd(2028, 7, 1), 0.03, IrsHelper::Config{});
+    FraHelper fra(Date::from_ymd(2026, 9, 1), Date::from_ymd(2027, 3, 1), 0.03, FraHelper::Config{});
+
+    std::vector<double> gd(dn.t.size()), gf(fn.t.size());
+    const double h = 1e-6;
+
+    SECTION("OIS par rate w.r.t. discount nodes") {
+        REQUIRE(ois.implied_par_rate(disc, gd).has_value());
+        for (std::size_t j = 1; j < dn.t.size(); ++j) {
+            auto up = dn; up.v[j] += h;
+            auto dw = dn; dw.v[j] -= h;
+            PiecewiseDiscountCurve cu(asof, {}), cd(asof, {});
+            REQUIRE(cu.set_nodes(up).has_value());
+            REQUIRE(cd.set_nodes(dw).has_value());
+            const double fd = (ois.implied_par_rate(cu).value() - ois.implied_par_rate(cd).value()) / (2 * h);
+            REQUIRE_THAT(gd[j], Catch::Matchers::WithinAbs(fd, 1e-6));
+        }
+    }
+
+    SECTION("IRS par rate w.r.t. discount and forward nodes") {
+        REQUIRE(irs.implied_par_rate(disc, fwd, gd, gf).has_value());
+        for (std::size_t j = 1; j < fn.t.size(); ++j) {
+            auto up = fn; up.v[j] += h;
+            auto dw = fn; dw.v[j] -= h;
+            PiecewiseForwardCurve cu(asof, {}), cd(asof, {});
+            REQUIRE(cu.set_nodes(up).has_value());
+            REQUIRE(cd.set_nodes(dw).has_value());
+            const double fd = (irs.implied_par_rate(disc, cu).value() - irs.implied_par_rate(disc, cd).value()) / (2 * h);
+            REQUIRE_THAT(gf[j], Catch::Matchers::WithinAbs(fd, 1e-6));
+        }
+        for (std::size_t j = 1; j < dn.t.size(); ++j) {
+            auto up = dn; up.v[j] += h;
+            auto dw = dn; dw.v[j] -= h;
+            PiecewiseDiscountCurve cu(asof, {}), cd(asof, {});
+            REQUIRE(cu.set_nodes(up).has_value());
+            REQUIRE(cd.set_nodes(dw).has_value());
+            const double fd = (irs.implied_par_rate(cu, fwd).value() - irs.implied_par_rate(cd, fwd).value()) / (2 * h);
+            REQUIRE_THAT(gd[j], Catch::Matchers::WithinAbs(fd, 1e-6));
+        }
+    }
+
+    SECTION("FRA rate w.r.t. forward nodes") {
+        REQUIRE(fra.implied_fra_rate(fwd, gf).has_value());
+        for (std::size_t j = 1; j < fn.t.size(); ++j) {
+            auto up = fn; up.v[j] += h;
+            auto dw = fn; dw.v[j] -= h;
+            PiecewiseForwardCurve cu(asof, {}), cd(asof, {});
+            REQUIRE(cu.set_nodes(up).has_value());
+            REQUIRE(cd.set_nodes(dw).has_value());
+            const double fd = (fra.implied_fra_rate(cu).value() - fra.implied_fra_rate(cd).value()) / (2 * h);
+            REQUIRE_THAT(gf[j], Catch::Matchers::WithinAbs(fd, 1e-6));
+        }
+    }
+}
+
+TEST_CASE("CurveBootstrapper: Newton pillar solver matches Brent with fewer iterations", "[bootstrapper][newton]") {
+    CurveBootstrapper bootstrapper;
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    OisSwapHelper::Config ois_cfg;
+    ois_cfg.fixed_dc = DayCount::ACT360;
+    ois_cfg.fixed_freq = Frequency::Annual;
+
+    std::vector<std::shared_ptr<OisSwapHelper>> disc_helpers;
+    for (int y = 1; y <= 10; ++y) {
+        disc_helpers.push_back(std::make_shared<OisSwapHelper>(
+            asof, Date::from_ymd(2026 + y, 1, 1), 0.025 + 0.001 * y, ois_cfg));
+    }
+
+    IrsHelper::Config irs_cfg;
+    std::vector<std::shared_ptr<RateHelper>> fwd_helpers;
+    for (int y = 1; y <= 10; ++y) {
+        fwd_helpers.push_back(std::make_shared<IrsHelper>(
+            asof, Date::from_ymd(2026 + y, 1, 1), 0.028 + 0.001 * y, irs_cfg));
+    }
+
+    BootstrapOptions brent_opts;
+    brent_opts.pillar_solver = PillarSolver::Brent;
+    BootstrapOptions newton_opts;
+    newton_opts.pillar_solver = PillarSolver::Newton;
+
+    BootstrapReport rep_brent, rep_newton;
+    auto d_brent = bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers, brent_opts, &rep_brent);
+    auto d_newton = bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers, newton_opts, &rep_newton);
+    REQUIRE(d_brent.has_value());
+    REQUIRE(d_newton.has_value());
+
+    REQUIRE(rep_newton.pillars == 10);
+    REQUIRE(rep_newton.newton_fallbacks == 0);
+    REQUIRE(rep_newton.avg_iterations_per_pillar() < rep_brent.avg_iterations_per_pillar());
+    for (std::size_t i = 0; i < d_brent.value()->nodes().v.size(); ++i) {
+        REQUIRE_THAT(d_newton.value()->nodes().v[i],
+            Catch::Matchers::WithinAbs(d_brent.value()->nodes().v[i], 1e-10));
+    }
+
+    auto f_brent = bootstrapper.bootstrap_forward_curve(asof, {}, *d_brent.value(), fwd_helpers, brent_opts);
+    auto f_newton = bootstrapper.bootstrap_forward_curve(asof, {}, *d_newton.value(), fwd_helpers, newton_opts, &rep_newton);
+    REQUIRE(f_brent.has_value());
+    REQUIRE(f_newton.has_value());
+    REQUIRE(rep_newton.newton_fallbacks == 0);
+    for (std::size_t i = 0; i < f_brent.value()->nodes().v.size(); ++i) {
+        REQUIRE_THAT(f_newton.value()->nodes().v[i],
+            Catch::Matchers::WithinAbs(f_brent.value()->nodes().v[i], 1e-10));
+    }
+}
+
+TEST_CASE("CurveBootstrapper: joint discount + forward solve with 64 instruments", "[bootstrapper][joint]") {
+    CurveBootstrapper bootstrapper;
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    OisSwapHelper::Config ois_cfg;
+    ois_cfg.fixed_dc = DayCount::ACT360;
+    ois_cfg.fixed_freq = Frequency::Annual;
+    IrsHelper::Config irs_cfg;
+
+    // Semi-annual pillars out to 16Y on both curves
+    std::vector<std::shared_ptr<OisSwapHelper>> disc_helpers;
+    std::vector<std::shared_ptr<RateHelper>> fwd_helpers;
+    for (int i = 1; i <= 32; ++i) {
+        const Date end = Calendar{}.advance(asof, Tenor{ 6 * i, TenorUnit::Months },
+            BusinessDayConvention::ModifiedFollowing);
+        disc_helpers.push_back(std::make_shared<OisSwapHelper>(asof, end, 0.025 + 0.0004 * i, ois_cfg));
+        fwd_helpers.push_back(std::make_shared<IrsHelper>(asof, end, 0.028 + 0.0004 * i, irs_cfg));
+    }
+
+    auto joint = bootstrapper.bootstrap_curves_jointly(asof, {}, {}, disc_helpers, fwd_helpers);
+    REQUIRE(joint.has_value());
+    const auto& res = joint.value();
+    REQUIRE(res.iterations <= 8);
+    REQUIRE(res.max_abs_residual <= 1e-12);
+    REQUIRE(res.jacobian.rows == 64);
+    REQUIRE(res.jacobian.cols == 64);
+    // OIS rows never depend on forward nodes
+    for (std::size_t i = 0; i < 32; ++i) {
+        for (std::size_t j = 32; j < 64; ++j) REQUIRE(res.jacobian.at(i, j) == 0.0);
+    }
+
+    // Same equations as the sequential bootstrap, so the same nodes
+    BootstrapOptions opts;
+    opts.pillar_solver = PillarSolver::Newton;
+    auto disc = bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers, opts);
+    REQUIRE(disc.has_value());
+    auto fwd = bootstrapper.bootstrap_forward_curve(asof, {}, *disc.value(), fwd_helpers, opts);
+    REQUIRE(fwd.has_value());
+    for (std::size_t i = 0; i < disc.value()->nodes().v.size(); ++i) {
+        REQUIRE_THAT(res.discount->nodes().v[i], Catch::Matchers::WithinAbs(disc.value()->nodes().v[i], 1e-10));
+    }
+    for (std::size_t i = 0; i < fwd.value()->nodes().v.size(); ++i) {
+        REQUIRE_THAT(res.forward->nodes().v[i], Catch::Matchers::WithinAbs(fwd.value()->nodes().v[i], 1e-10));
+    }
+
+    // Spot-check a cross-curve Jacobian entry (IRS row vs a discount node) by bumping
+    const auto* irs = dynamic_cast<const IrsHelper*>(fwd_helpers[20].get());
+    const std::size_t row = 32 + 20;
+    const std::size_t node = 10;   // discount node 11 (column 10)
+    const double h = 1e-6;
+    auto bumped = [&](double s) {
+        auto nodes = res.discount->nodes();
+        nodes.v[node + 1] += s;
+        PiecewiseDiscountCurve c(asof, {});
+        REQUIRE(c.set_nodes(nodes).has_value());
+        return irs->implied_par_rate(c, *res.forward).value();
+    };
+    const double fd = (bumped(h) - bumped(-h)) / (2.0 * h);
+    REQUIRE_THAT(res.jacobian.at(row, node), Catch::Matchers::WithinAbs(fd, 1e-6));
+}
+
+TEST_CASE("CurveBootstrapper: date cache config is honoured on the returned curve", "[bootstrapper][date_cache]") {
+    CurveBootstrapper bootstrapper;
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    OisSwapHelper::Config ois_cfg;
+    std::vector<std::shared_ptr<OisSwapHelper>> disc_helpers;
+    for (int y = 1; y <= 5; ++y) {
+        disc_helpers.push_back(std::make_shared<OisSwapHelper>(
+            asof, Date::from_ymd(2026 + y, 1, 1), 0.025 + 0.001 * y, ois_cfg));
+    }
+
+    PiecewiseDiscountCurve::Config cfg;
+    cfg.date_cache_days = 366 * 10;
+    cfg.date_cache_values = true;
+
+    auto plain = bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers);
+    auto cached = bootstrapper.bootstrap_discount_curve(asof, cfg, disc_helpers);
+    REQUIRE(plain.has_value());
+    REQUIRE(cached.has_value());
+    REQUIRE(cached.value()->config().date_cache_values);
+    REQUIRE(cached.value()->date_cache_bytes() == 2 * 366 * 10 * sizeof(double));
+
+    for (int days = 0; days < 366 * 6; days += 30) {
+        const Date d = asof + std::chrono::days{ days };
+        REQUIRE_THAT(cached.value()->df(d), Catch::Matchers::WithinRel(plain.value()->df(d), 1e-14));
+    }
+}
+
+TEST_CASE("CurveBootstrapper: quote sensitivities match re-bootstrapping", "[bootstrapper][sensitivities]") {
+    CurveBootstrapper bootstrapper;
+    Date asof = Date::from_ymd(2026, 1, 1);
+
+    OisSwapHelper::Config ois_cfg;
+    IrsHelper::Config irs_cfg;
+    std::vector<Date> ends;
+    std::vector<double> ois_quotes, irs_quotes;
+    for (int i = 1; i <= 10; ++i) {
+        ends.push_back(Calendar{}.advance(asof, Tenor{ 9 * i, TenorUnit::Months }, BusinessDayConvention::ModifiedFollowing));
+        ois_quotes.push_back(0.025 + 0.0006 * i);
+        irs_quotes.push_back(0.028 + 0.0005 * i);
+    }
+    auto disc_helpers = [&](const std::vector<double>& q) {
+        std::vector<std::shared_ptr<OisSwapHelper>> h;
+        for (std::size_t i = 0; i < q.size(); ++i) h.push_back(std::make_shared<OisSwapHelper>(asof, ends[i], q[i], ois_cfg));
+        return h;
+    };
+    auto fwd_helpers = [&](const std::vector<double>& q) {
+        std::vector<std::shared_ptr<RateHelper>> h;
+        for (std::size_t i = 0; i < q.size(); ++i) h.push_back(std::make_shared<IrsHelper>(asof, ends[i], q[i], irs_cfg));
+        return h;
+    };
+
+    BootstrapOptions opts;
+    opts.pillar_solver = PillarSolver::Newton;
+    opts.solver.tol_abs = 1e-15;
+    opts.solver.tol_rel = 1e-14;
+
+    BootstrapSensitivities disc_sens, fwd_sens;
+    auto disc = bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers(ois_quotes), opts, nullptr, &disc_sens);
+    REQUIRE(disc.has_value());
+    auto fwd = bootstrapper.bootstrap_forward_curve(asof, {}, *disc.value(), fwd_helpers(irs_quotes), opts, nullptr, &fwd_sens);
+    REQUIRE(fwd.has_value());
+
+    REQUIRE(disc_sens.d_node_d_quote.rows == 11);
+    REQUIRE(disc_sens.d_node_d_quote.cols == 10);
+    REQUIRE(disc_sens.quote_maturities == ends);
+    REQUIRE(disc_sens.d_node_d_discount.rows == 0);
+    REQUIRE(fwd_sens.d_node_d_discount.rows == 11);
+    REQUIRE(fwd_sens.d_node_d_discount.cols == 11);
+
+    const double h = 1e-6;
+    for (std::size_t q = 0; q < 10; ++q) {
+        auto rebuilt = [&](double s) {
+            auto quotes = ois_quotes;
+            quotes[q] += s;
+            return bootstrapper.bootstrap_discount_curve(asof, {}, disc_helpers(quotes), opts).value()->nodes().v;
+        };
+        const auto up = rebuilt(h);
+        const auto down = rebuilt(-h);
+        for (std::size_t i = 0; i < up.size(); ++i) {
+            REQUIRE_THAT(disc_sens.d_node_d_quote.at(i, q), Catch::Matchers::WithinAbs((up[i] - down[i]) / (2.0 * h), 1e-6));
+        }
+    }
+
+    // Forward nodes against one discount node, with the IRS quotes held fixed
+    const std::size_t node = 4;
+    auto rebuilt_fwd = [&](double s) {
+        auto nodes = disc.value()->nodes();
+        nodes.v[node] += s;
+        PiecewiseDiscountCurve c(asof, {});
+        REQUIRE(c.set_nodes(nodes).has_value());
+        return bootstrapper.bootstrap_forward_curve(asof, {}, c, fwd_helpers(irs_quotes), opts).value()->nodes().v;
+    };
+    const auto up = rebuilt_fwd(h);
+    const auto down = rebuilt_fwd(-h);
+    for (std::size_t i = 0; i < up.size(); ++i) {
+        REQUIRE_THAT(fwd_sens.d_node_d_discount.at(i, node), Catch::Matchers::WithinAbs((up[i] - down[i]) / (2.0 * h), 1e-6));
+    }
+}
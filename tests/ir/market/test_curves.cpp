@@ -0,0 +1,170 @@
+#include "ir/market/curves.hpp"
+#include "ir/core/date.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace ir;
+using namespace ir::market;
+
+namespace {
+    // Minimal non-piecewise curve: exercises the scalar df_batch fallback
+    class FlatCurve final : public DiscountCurve {
+    public:
+        FlatCurve(const Date& asof, double r) : DiscountCurve(asof), r_(r) {}
+        double df(const Date& d) const override { return df(year_fraction(asof_, d, DayCount::ACT365)); }
+        double df(double t) const override { return std::exp(-r_ * t); }
+    private:
+        double r_;
+    };
+
+    ir::utils::Nodes1D sample_nodes() {
+        ir::utils::Nodes1D nodes;
+        (void)nodes.push_back(0.0, 1.0);
+        for (int i = 1; i <= 40; ++i) {
+            const double t = 0.5 * i;
+            (void)nodes.push_back(t, std::exp(-(0.02 + 0.0005 * t) * t));
+        }
+        return nodes;
+    }
+}
+
+TEST_CASE("PiecewiseDiscountCurve::df_batch matches scalar df", "[curves][batch]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseDiscountCurve curve(asof, {});
+    REQUIRE(curve.set_nodes(sample_nodes()).has_value());
+
+    // Sorted grid past the last node, then an unsorted tail incl. t <= 0
+    std::vector<double> t;
+    for (int i = 0; i < 2000; ++i) t.push_back(0.0125 * i);
+    for (double x : { 7.3, -1.0, 0.2, 25.0, 3.0 }) t.push_back(x);
+
+    std::vector<double> out(t.size());
+    curve.df_batch(t, out);
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        REQUIRE_THAT(out[i], Catch::Matchers::WithinRel(curve.df(t[i]), 1e-14));
+    }
+    REQUIRE(out[2001] == 1.0);
+
+    std::vector<Date> dates;
+    for (int m = -2; m < 240; ++m) dates.push_back(asof + std::chrono::days{ 31 * m });
+    std::vector<double> out_d(dates.size());
+    curve.df_batch(dates, out_d);
+    for (std::size_t i = 0; i < dates.size(); ++i) {
+        REQUIRE_THAT(out_d[i], Catch::Matchers::WithinRel(curve.df(dates[i]), 1e-14));
+    }
+
+    std::vector<double> too_short(3);
+    REQUIRE_THROWS(curve.df_batch(t, too_short));
+}
+
+TEST_CASE("PiecewiseForwardCurve::pf_batch and DiscountCurve fallback", "[curves][batch]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseForwardCurve fwd(asof, {});
+    REQUIRE(fwd.set_nodes(sample_nodes()).has_value());
+
+    const std::vector<double> t{ 0.0, 0.25, 1.0, 9.99, 20.0, 30.0 };
+    std::vector<double> out(t.size());
+    fwd.pf_batch(t, out);
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        REQUIRE_THAT(out[i], Catch::Matchers::WithinRel(fwd.pf(t[i]), 1e-14));
+    }
+
+    FlatCurve flat(asof, 0.03);
+    const DiscountCurve& base = flat;
+    base.df_batch(t, out);
+    for (std::size_t i = 0; i < t.size(); ++i) {
+        REQUIRE(out[i] == flat.df(t[i]));
+    }
+}
+
+TEST_CASE("Date cache: cached and uncached curves agree", "[curves][date_cache]") {
+    const Date asof = Date::from_ymd(2026, 1, 30);
+
+    PiecewiseDiscountCurve::Config plain_cfg;
+    plain_cfg.dc = DayCount::THIRTY360;
+    PiecewiseDiscountCurve::Config t_cfg = plain_cfg;
+    t_cfg.date_cache_days = 366 * 5;
+    PiecewiseDiscountCurve::Config v_cfg = t_cfg;
+    v_cfg.date_cache_values = true;
+
+    PiecewiseDiscountCurve plain(asof, plain_cfg), t_only(asof, t_cfg), full(asof, v_cfg);
+    for (auto* c : { &plain, &t_only, &full }) REQUIRE(c->set_nodes(sample_nodes()).has_value());
+
+    REQUIRE(plain.date_cache_bytes() == 0);
+    REQUIRE(t_only.date_cache_bytes() == 366 * 5 * sizeof(double));
+    REQUIRE(full.date_cache_bytes() == 2 * 366 * 5 * sizeof(double));
+
+    // Inside the table, before asof and beyond the table
+    for (int days = -10; days < 366 * 7; days += 7) {
+        const Date d = asof + std::chrono::days{ days };
+        REQUIRE_THAT(t_only.df(d), Catch::Matchers::WithinRel(plain.df(d), 1e-15));
+        REQUIRE_THAT(full.df(d), Catch::Matchers::WithinRel(plain.df(d), 1e-14));
+    }
+
+    // Incremental updates drop the DF table until it is rebuilt
+    REQUIRE(full.set_last_value(full.nodes().v.back() * 0.99).has_value());
+    REQUIRE(plain.set_last_value(plain.nodes().v.back() * 0.99).has_value());
+    REQUIRE(full.date_cache_bytes() == 366 * 5 * sizeof(double));
+    const Date probe = asof + std::chrono::days{ 1000 };
+    REQUIRE_THAT(full.df(probe), Catch::Matchers::WithinRel(plain.df(probe), 1e-14));
+    full.rebuild_date_cache();
+    REQUIRE(full.date_cache_bytes() == 2 * 366 * 5 * sizeof(double));
+    REQUIRE_THAT(full.df(probe), Catch::Matchers::WithinRel(plain.df(probe), 1e-14));
+}
+
+TEST_CASE("Date cache: forward curve and footprint", "[curves][date_cache]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseForwardCurve::Config cfg;
+    cfg.date_cache_days = kDateCache60Y;
+    cfg.date_cache_values = true;
+
+    PiecewiseForwardCurve plain(asof, {}), cached(asof, cfg);
+    REQUIRE(plain.set_nodes(sample_nodes()).has_value());
+    REQUIRE(cached.set_nodes(sample_nodes()).has_value());
+
+    for (int m = 0; m < 120; ++m) {
+        const Date s = asof + std::chrono::days{ 30 * m };
+        const Date e = s + std::chrono::days{ 91 };
+        REQUIRE_THAT(cached.forward_rate(s, e, DayCount::ACT360),
+            Catch::Matchers::WithinRel(plain.forward_rate(s, e, DayCount::ACT360), 1e-12));
+    }
+
+    // Footprint: t table only vs t table + value table
+    PiecewiseDiscountCurve::Config dcfg;
+    dcfg.date_cache_days = kDateCache60Y;
+    PiecewiseDiscountCurve a(asof, dcfg), b(asof, dcfg);
+    REQUIRE(a.date_cache_bytes() == b.date_cache_bytes());
+    REQUIRE(cached.date_cache_bytes() == 2 * a.date_cache_bytes());
+}
+
+TEST_CASE("set_node_value bumps one node and keeps the date cache in sync", "[curves][date_cache]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    PiecewiseDiscountCurve::Config cfg;
+    cfg.date_cache_days = kDateCache60Y;
+    cfg.date_cache_values = true;
+    PiecewiseDiscountCurve cached(asof, cfg), plain(asof, {});
+    REQUIRE(cached.set_nodes(sample_nodes()).has_value());
+    REQUIRE(plain.set_nodes(sample_nodes()).has_value());
+    const PiecewiseDiscountCurve base = cached;
+
+    const auto& n = sample_nodes();
+    for (std::size_t i = 0; i < n.t.size(); ++i) {
+        const double bumped = n.v[i] * 0.999;
+        REQUIRE(cached.set_node_value(i, bumped).has_value());
+        REQUIRE(plain.set_node_value(i, bumped).has_value());
+        for (int d = 0; d < 40 * 366; d += 17) {
+            const Date probe = asof + std::chrono::days{ d };
+            REQUIRE_THAT(cached.df(probe), Catch::Matchers::WithinRel(plain.df(probe), 1e-14));
+        }
+        REQUIRE(cached.set_node_value(i, n.v[i]).has_value());
+        REQUIRE(plain.set_node_value(i, n.v[i]).has_value());
+    }
+    for (int d = 0; d < kDateCache60Y; d += 7) {
+        const Date probe = asof + std::chrono::days{ d };
+        REQUIRE(cached.df(probe) == base.df(probe));
+    }
+    REQUIRE_FALSE(cached.set_node_value(n.t.size(), 0.9).has_value());
+    REQUIRE_FALSE(cached.set_node_value(1, -0.9).has_value());
+}
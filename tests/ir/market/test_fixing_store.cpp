@@ -0,0 +1,92 @@
+#include "ir/market/quotes.hpp"
+#include "ir/core/date.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+
+using namespace ir;
+using namespace ir::market;
+
+TEST_CASE("FixingStore: add/get by id and by handle, out-of-order and overwrite", "[fixings]") {
+    FixingStore store;
+    const IndexId sofr{ "SOFR" };
+    const IndexId estr{ "ESTR" };
+    const Date d0 = Date::from_ymd(2026, 1, 5);
+
+    REQUIRE(store.handle(sofr) == FixingStore::kNoIndex);
+    REQUIRE_FALSE(store.get(sofr, d0).has_value());
+
+    store.add(sofr, d0, 0.0430);
+    store.add(sofr, d0 + std::chrono::days{ 3 }, 0.0433);
+    store.add(sofr, d0 + std::chrono::days{ -4 }, 0.0428);   // before the first day
+    store.add(estr, d0, 0.0190);
+    store.add(sofr, d0, 0.0431);                              // overwrite
+
+    const auto h = store.handle(sofr);
+    REQUIRE(h != FixingStore::kNoIndex);
+    REQUIRE(store.handle(estr) != h);
+
+    REQUIRE(store.get(sofr, d0).value() == 0.0431);
+    REQUIRE(store.get(h, d0 + std::chrono::days{ 3 }).value() == 0.0433);
+    REQUIRE(store.get(h, d0 + std::chrono::days{ -4 }).value() == 0.0428);
+    REQUIRE(store.get(estr, d0).value() == 0.0190);
+
+    // Gaps and days outside the history are missing
+    REQUIRE_FALSE(store.get(h, d0 + std::chrono::days{ 1 }).has_value());
+    REQUIRE_FALSE(store.get(h, d0 + std::chrono::days{ 30 }).has_value());
+    REQUIRE_FALSE(store.get(h, d0 + std::chrono::days{ -30 }).has_value());
+    REQUIRE_FALSE(store.get(FixingStore::kNoIndex, d0).has_value());
+
+    // A NaN fixing removes the entry
+    store.add(sofr, d0, std::numeric_limits<double>::quiet_NaN());
+    REQUIRE_FALSE(store.get(h, d0).has_value());
+}
+
+TEST_CASE("FixingStore::get_range returns one entry per day", "[fixings]") {
+    FixingStore store;
+    const IndexId sofr{ "SOFR" };
+    const Date d0 = Date::from_ymd(2026, 1, 1);
+    for (int i = 0; i < 10; ++i) {
+        if (i == 6) continue;   // missing day
+        store.add(sofr, d0 + std::chrono::days{ i }, 0.04 + 0.001 * i);
+    }
+    const auto h = store.handle(sofr);
+
+    const auto r = store.get_range(h, d0 + std::chrono::days{ 2 }, d0 + std::chrono::days{ 8 });
+    REQUIRE(r.size() == 6);
+    REQUIRE(r[0] == 0.042);
+    REQUIRE(r[3] == 0.045);
+    REQUIRE(std::isnan(r[4]));
+
+    // Not fully covered, empty or unknown index: empty span
+    REQUIRE(store.get_range(h, d0 + std::chrono::days{ -1 }, d0 + std::chrono::days{ 3 }).empty());
+    REQUIRE(store.get_range(h, d0 + std::chrono::days{ 5 }, d0 + std::chrono::days{ 11 }).empty());
+    REQUIRE(store.get_range(h, d0, d0).empty());
+    REQUIRE(store.get_range(FixingStore::kNoIndex, d0, d0 + std::chrono::days{ 1 }).empty());
+}
+
+TEST_CASE("FixingStore: a history added newest-first reads back in date order", "[fixings]") {
+    FixingStore store;
+    const IndexId sofr{ "SOFR" };
+    const Date last = Date::from_ymd(2026, 1, 30);
+    const int days = 3000;
+    int added = 0;
+    for (int k = 0; k < days; k += 1 + k % 3, ++added) {
+        store.add(sofr, last + std::chrono::days{ -k }, 0.01 + 1e-6 * k);
+    }
+
+    const auto h = store.handle(sofr);
+    const auto hist = store.history(h);
+    REQUIRE(store.first_date(h) + std::chrono::days{ static_cast<int>(hist.size()) - 1 } == last);
+    int found = 0;
+    for (int k = 0; k < days; ++k) {
+        const auto v = store.get(h, last + std::chrono::days{ -k });
+        if (!v) continue;
+        REQUIRE(*v == 0.01 + 1e-6 * k);
+        ++found;
+    }
+    REQUIRE(found == added);
+    REQUIRE(store.get(h, store.first_date(h)).has_value());
+    REQUIRE_FALSE(store.get(h, store.first_date(h) + std::chrono::days{ -1 }).has_value());
+    REQUIRE(store.get_range(h, store.first_date(h), last + std::chrono::days{ 1 }).size() == hist.size());
+}
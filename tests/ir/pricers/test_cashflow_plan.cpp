@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/cashflow_plan.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using ir::testing::Market;
+using ir::testing::make_trades;
+using ir::testing::zero_nodes;
+
+TEST_CASE("CashflowPlan: price_plan matches the pricers, also on bumped curves", "[pricers][plan]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+
+    for (const auto framework : { PricingFramework::MultiCurve, PricingFramework::SingleCurve }) {
+        PricingContext ctx{ asof };
+        ctx.framework = framework;
+        const PortfolioPricer pricer(PortfolioOptions{ 1 });
+        const auto expected = pricer.price(trades, m.md, ctx);
+
+        std::vector<CashflowPlan> plans;
+        for (const auto& trade : trades) {
+            auto plan = compile_plan(trade, m.md, ctx);
+            REQUIRE(plan.has_value());
+            REQUIRE(plan.value().t_start.size() == plan.value().size());
+            REQUIRE(plan.value().known_amount.size() == plan.value().size());
+            plans.push_back(std::move(plan.value()));
+        }
+        REQUIRE(plans[0].legs == 2);
+        REQUIRE(plans[2].legs == 1);
+        REQUIRE(plans[0].uses_ibor == (framework == PricingFramework::MultiCurve));
+        REQUIRE_FALSE(plans[0].uses_rfr);
+
+        auto check = [&](const ir::market::MarketData& md, const std::vector<ir::Result<PricingResult>>& pvs) {
+            for (std::size_t k = 0; k < trades.size(); ++k) {
+                auto curves = plan_curves(plans[k], md);
+                REQUIRE(curves.has_value());
+                const auto r = price_plan(plans[k], curves.value());
+                const auto& e = pvs[k].value();
+                REQUIRE(std::abs(r.pv - e.pv) <= 1e-9 * std::abs(e.pv));
+                REQUIRE(std::abs(r.pv_fixed_leg - e.pv_fixed_leg) <= 1e-9 * std::abs(e.pv_fixed_leg));
+                REQUIRE(std::abs(r.pv_float_leg - e.pv_float_leg) <= 1e-9 * std::abs(e.pv_float_leg) + 1e-9);
+            }
+        };
+        check(m.md, expected);
+
+        // The same plans price moved curves of the same ids and axes
+        ir::market::MarketData bumped = m.md;
+        auto disc = std::make_shared<ir::market::PiecewiseDiscountCurve>(
+            dynamic_cast<const ir::market::PiecewiseDiscountCurve&>(m.md.discount_curve(ir::CurveId{ "DISCOUNT" })));
+        auto rfr = std::make_shared<ir::market::PiecewiseForwardCurve>(
+            dynamic_cast<const ir::market::PiecewiseForwardCurve&>(m.md.forward_curve(ir::CurveId{ "FWD_RFR" })));
+        REQUIRE(disc->set_node_value(5, disc->nodes().v[5] * 0.999).has_value());
+        REQUIRE(rfr->set_node_value(3, rfr->nodes().v[3] * 1.001).has_value());
+        bumped.set_discount_curve(ir::CurveId{ "DISCOUNT" }, disc);
+        bumped.set_forward_curve(ir::CurveId{ "FWD_RFR" }, rfr);
+        check(bumped, pricer.price(trades, bumped, ctx));
+    }
+}
+
+TEST_CASE("CashflowPlan: curves must be piecewise and on the plan's axes", "[pricers][plan]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+    const PricingContext ctx{ asof };
+
+    auto plan = compile_plan(trades[0], m.md, ctx);
+    REQUIRE(plan.has_value());
+
+    // IBOR curve rebuilt on another asof
+    ir::market::MarketData moved = m.md;
+    auto ibor = std::make_shared<ir::market::PiecewiseForwardCurve>(asof + std::chrono::days{ 1 },
+        ir::market::PiecewiseForwardCurve::Config{});
+    REQUIRE(ibor->set_nodes(zero_nodes(0.032, 0.0004)).has_value());
+    moved.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, ibor);
+    auto off_axis = plan_curves(plan.value(), moved);
+    REQUIRE_FALSE(off_axis.has_value());
+    REQUIRE(off_axis.error().message.find("FWD_IBOR") != std::string::npos);
+
+    PricingContext missing{ asof };
+    missing.ibor_forward_curve = ir::CurveId{ "FWD_NONE" };
+    REQUIRE_FALSE(compile_plan(trades[0], m.md, missing).has_value());
+}
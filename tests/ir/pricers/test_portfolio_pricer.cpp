@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using ir::testing::discount_curve;
+using ir::testing::forward_curve;
+using ir::testing::schedule;
+using ir::testing::yearly_grid;
+using ir::testing::zero_nodes;
+
+TEST_CASE("PortfolioPricer: parallel results match serial pricing in input order", "[pricers][portfolio]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+
+    const auto grid = yearly_grid(30);
+    ir::market::FixingStore fixings;
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, forward_curve(asof, zero_nodes(0.032, 0.0004, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_RFR" }, forward_curve(asof, zero_nodes(0.029, 0.0004, grid)));
+
+    std::vector<PortfolioTrade> trades;
+    for (int k = 0; k < 60; ++k) {
+        const int years = 1 + k % 20;
+        FixedLegConfig fc;
+        fc.notional = 1e6 * (1 + k);
+        fc.fixed_rate = 0.03 + 0.0001 * k;
+        auto fixed = LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, years, 12), fc);
+
+        if (k % 3 == 0) {
+            IborLegConfig ic;
+            ic.notional = fc.notional;
+            ic.index = ir::IndexId{ "EURIBOR6M" };
+            auto flt = LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, years, 6), ic,
+                ir::Calendar{}, ir::BusinessDayConvention::ModifiedFollowing);
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{}, fixed, flt) });
+        }
+        else if (k % 3 == 1) {
+            RfrLegConfig rc;
+            rc.notional = fc.notional;
+            rc.index = ir::IndexId{ "SOFR" };
+            auto rfr = LegBuilder::build_rfr_compound_leg(PayReceive::Receive, schedule(asof, years, 12), rc);
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<OisSwap>, TradeInfo{}, fixed, rfr) });
+        }
+        else {
+            trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<Leg>, fixed) });
+        }
+    }
+    // Per-trade context override pointing at a missing curve: only this trade fails
+    PricingContext bad;
+    bad.valuation_date = asof;
+    bad.discount_curve = ir::CurveId{ "MISSING" };
+    trades[7].ctx = bad;
+
+    PricingContext ctx;
+    ctx.valuation_date = asof;
+
+    PortfolioOptions opts;
+    opts.threads = 4;
+    opts.grain = 3;
+    PortfolioPricer parallel(opts);
+    REQUIRE(parallel.threads() == 4);
+    const auto res = parallel.price(trades, md, ctx);
+
+    PortfolioOptions serial_opts;
+    serial_opts.threads = 1;
+    PortfolioPricer serial(serial_opts);
+    REQUIRE(serial.threads() == 1);
+    const auto ref = serial.price(trades, md, ctx);
+
+    MultiCurveSwapPricer pricer;
+    REQUIRE(res.size() == trades.size());
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        if (i == 7) {
+            REQUIRE_FALSE(res[i].has_value());
+            REQUIRE_FALSE(ref[i].has_value());
+            continue;
+        }
+        REQUIRE(res[i].has_value());
+        REQUIRE(ref[i].has_value());
+        REQUIRE(res[i].value().pv == ref[i].value().pv);
+        REQUIRE(res[i].value().lines.size() == ref[i].value().lines.size());
+
+        // Same numbers as pricing the product directly
+        if (const auto* swap = std::get_if<OisSwap>(&trades[i].product)) {
+            auto direct = pricer.price(*swap, md, ctx);
+            REQUIRE(direct.has_value());
+            REQUIRE(res[i].value().pv == direct.value().pv);
+            REQUIRE(res[i].value().pv_float_leg == direct.value().pv_float_leg);
+        }
+        else if (const auto* leg = std::get_if<Leg>(&trades[i].product)) {
+            auto direct = pricer.price_leg(*leg, md, ctx);
+            REQUIRE(direct.has_value());
+            REQUIRE(res[i].value().pv == direct.value().pv);
+        }
+    }
+
+    // keep_lines = false drops cashflow detail but not the PVs
+    opts.keep_lines = false;
+    const auto lean = PortfolioPricer(opts).price(trades, md, ctx);
+    REQUIRE(lean[0].has_value());
+    REQUIRE(lean[0].value().lines.empty());
+    REQUIRE(lean[0].value().pv == res[0].value().pv);
+}
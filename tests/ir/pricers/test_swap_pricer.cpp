@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
 
 #include "ir/core/date.hpp"
 #include "ir/core/conventions.hpp"
@@ -109,6 +110,58 @@ TEST_CASE("MultiCurveSwapPricer: projects IBOR coupon when fixing missing", "[pr
     REQUIRE_THAT(res.value().pv_fixed_leg, Catch::Matchers::WithinAbs(0.0, 1e-12));
 }
 
+TEST_CASE("MultiCurveSwapPricer: PricingDetail selects PV only, leg aggregates or cashflow lines", "[pricers][swap]") {
+    const Date asof = Date::from_ymd(2026, 1, 1);
+
+    ir::market::FixingStore fixings{};
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, std::make_shared<FlatDiscountCurve>(asof, 0.02));
+    md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, std::make_shared<FlatForwardCurve>(asof, 0.05));
+
+    const ir::instruments::IborObservation obs{
+        ir::IndexId{ "USD-LIBOR-6M" }, asof, asof, Date::from_ymd(2026, 7, 1), DayCount::ACT360 };
+
+    ir::instruments::Leg float_leg;
+    float_leg.direction = ir::instruments::PayReceive::Receive;
+    float_leg.cashflows = { std::make_shared<ir::instruments::IborCoupon>(obs.accrual_end, 1'000'000.0, 0.0, obs) };
+
+    ir::instruments::Leg fixed_leg;
+    fixed_leg.direction = ir::instruments::PayReceive::Pay;
+    fixed_leg.cashflows = { std::make_shared<ir::instruments::FixedCoupon>(Date::from_ymd(2026, 4, 1), 10'000.0),
+        std::make_shared<ir::instruments::FixedCoupon>(obs.accrual_end, 10'000.0) };
+
+    const ir::instruments::InterestRateSwap swap(ir::instruments::TradeInfo{}, fixed_leg, float_leg);
+    ir::pricers::PricingContext ctx;
+    ctx.valuation_date = asof;
+
+    const ir::pricers::MultiCurveSwapPricer pricer;
+    const auto full = pricer.price(swap, md, ctx);
+    REQUIRE(full.has_value());
+    REQUIRE(ctx.detail == ir::pricers::PricingDetail::Cashflows);
+    REQUIRE(full.value().lines.size() == 3);
+    REQUIRE(full.value().lines[0].leg == 0);
+    REQUIRE(full.value().lines[0].type == ir::instruments::CashflowType::Fixed);
+    REQUIRE(full.value().lines[2].leg == 1);
+    REQUIRE(std::string(ir::pricers::cashflow_label(full.value().lines[2].type)) == "IBOR");
+    REQUIRE(full.value().lines[2].pv == full.value().pv_float_leg);
+
+    ctx.detail = ir::pricers::PricingDetail::Aggregates;
+    const auto agg = pricer.price(swap, md, ctx);
+    REQUIRE(agg.has_value());
+    REQUIRE(agg.value().lines.empty());
+    REQUIRE(agg.value().pv == full.value().pv);
+    REQUIRE(agg.value().pv_fixed_leg == full.value().pv_fixed_leg);
+    REQUIRE(agg.value().pv_float_leg == full.value().pv_float_leg);
+
+    ctx.detail = ir::pricers::PricingDetail::PvOnly;
+    const auto pv_only = pricer.price(swap, md, ctx);
+    REQUIRE(pv_only.has_value());
+    REQUIRE(pv_only.value().lines.empty());
+    REQUIRE(pv_only.value().pv == full.value().pv);
+    REQUIRE(pv_only.value().pv_fixed_leg == 0.0);
+}
+
 TEST_CASE("MultiCurveSwapPricer: uses fixing when available (overrides projection)", "[pricers][swap]") {
     const Date asof = Date::from_ymd(2026, 1, 1);
 
@@ -258,8 +311,8 @@ TEST_CASE("MultiCurveSwapPricer::price_leg prices IBOR receive leg directly", "[
 
     REQUIRE_THAT(res.value().pv, Catch::Matchers::WithinAbs(expected, 1e-10));
     REQUIRE(res.value().lines.size() == 1);
-    REQUIRE(res.value().lines[0].leg_id == "IBOR_LEG");
-    REQUIRE(res.value().lines[0].label == "IBOR");
+    REQUIRE(res.value().lines[0].leg == 0);
+    REQUIRE(res.value().lines[0].type == ir::instruments::CashflowType::IborCoupon);
     REQUIRE_THAT(res.value().lines[0].amount, Catch::Matchers::WithinAbs(expected, 1e-10));
     REQUIRE_THAT(res.value().lines[0].pv, Catch::Matchers::WithinAbs(expected, 1e-10));
 }
@@ -304,8 +357,8 @@ TEST_CASE("MultiCurveSwapPricer::price_leg prices RFR pay leg directly", "[price
 
     REQUIRE_THAT(res.value().pv, Catch::Matchers::WithinAbs(expected, 1e-10));
     REQUIRE(res.value().lines.size() == 1);
-    REQUIRE(res.value().lines[0].leg_id == "RFR_LEG");
-    REQUIRE(res.value().lines[0].label == "RFR");
+    REQUIRE(res.value().lines[0].leg == 0);
+    REQUIRE(res.value().lines[0].type == ir::instruments::CashflowType::RfrCoupon);
     REQUIRE_THAT(res.value().lines[0].amount, Catch::Matchers::WithinAbs(expected, 1e-10));
 }
 
@@ -345,8 +398,8 @@ TEST_CASE("DiscountingSwapPricer::price_leg projects IBOR from discount curve in
 
     REQUIRE(res.has_value());
     REQUIRE(res.value().lines.size() == 1);
-    REQUIRE(res.value().lines[0].label == "IBOR");
-    REQUIRE(res.value().lines[0].leg_id == "SC_IBOR_LEG");
+    REQUIRE(res.value().lines[0].type == ir::instruments::CashflowType::IborCoupon);
+    REQUIRE(res.value().lines[0].leg == 0);
 
     const double tau = ir::year_fraction(obs.accrual_start, obs.accrual_end, obs.accrual_dc);
     const double df1 = 1.0;
@@ -394,4 +447,56 @@ TEST_CASE("MultiCurveSwapPricer::price_leg returns error when required IBOR forw
     auto res = pricer.price_leg(leg, md, ctx);
 
     REQUIRE_FALSE(res.has_value());
-}
\ No newline at end of file
+}
+TEST_CASE("DiscountingSwapPricer: closed-form RFR projection matches the daily loop", "[pricers][swap][rfr]") {
+    const Date asof = Date::from_ymd(2026, 3, 16);
+
+    // Realised fixings before valuation for the first (seasoned) coupon
+    ir::market::FixingStore fixings{};
+    for (Date d = Date::from_ymd(2026, 1, 2); d < asof; d = d + std::chrono::days{ 1 }) {
+        fixings.add(ir::IndexId{ "SOFR" }, d, 0.031);
+    }
+
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, std::make_shared<FlatDiscountCurve>(asof, 0.035));
+
+    // 10Y of annual daily-compounded coupons, the first one already accruing
+    ir::instruments::Leg leg;
+    leg.leg_id = "RFR_LEG";
+    leg.direction = ir::instruments::PayReceive::Receive;
+    for (int y = 0; y < 10; ++y) {
+        ir::instruments::RfrObservation obs{
+            ir::IndexId{ "SOFR" },
+            Date::from_ymd(2026 + y, 1, 2),
+            Date::from_ymd(2027 + y, 1, 2),
+            DayCount::ACT360
+        };
+        leg.cashflows.push_back(std::make_shared<ir::instruments::RfrCompoundCoupon>(
+            obs.end, 1'000'000.0, 0.001, obs));
+    }
+
+    ir::pricers::PricingContext ctx;
+    ctx.valuation_date = asof;
+    ctx.framework = ir::pricers::PricingFramework::SingleCurve;
+
+    ir::pricers::DiscountingSwapPricer pricer;
+    auto fast = pricer.price_leg(leg, md, ctx);
+    ctx.rfr_exact_daily_projection = true;
+    auto exact = pricer.price_leg(leg, md, ctx);
+
+    REQUIRE(fast.has_value());
+    REQUIRE(exact.has_value());
+    REQUIRE(fast.value().lines.size() == 10);
+    REQUIRE_THAT(fast.value().pv, Catch::Matchers::WithinRel(exact.value().pv, 1e-10));
+    for (std::size_t i = 0; i < 10; ++i) {
+        REQUIRE_THAT(fast.value().lines[i].amount,
+            Catch::Matchers::WithinRel(exact.value().lines[i].amount, 1e-10));
+    }
+
+    // Realised days still need their fixings
+    ir::market::FixingStore empty{};
+    md.set_fixings(&empty);
+    ctx.rfr_exact_daily_projection = false;
+    REQUIRE_FALSE(pricer.price_leg(leg, md, ctx).has_value());
+}
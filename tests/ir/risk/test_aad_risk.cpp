@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/risk/aad_risk.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using ir::testing::Market;
+using ir::testing::make_trades;
+
+TEST_CASE("AadRiskEngine: PV and node deltas match the pricer and bump-and-reprice", "[risk][aad]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+
+    for (const auto framework : { PricingFramework::MultiCurve, PricingFramework::SingleCurve }) {
+        PricingContext ctx{ asof };
+        ctx.framework = framework;
+
+        const auto pvs = PortfolioPricer(PortfolioOptions{ 1 }).price(trades, m.md, ctx);
+        auto up = ir::risk::BucketedRiskEngine(ir::risk::BucketedRiskOptions{ 1e-4, 1 }).compute(trades, m.md, ctx);
+        auto down = ir::risk::BucketedRiskEngine(ir::risk::BucketedRiskOptions{ -1e-4, 1 }).compute(trades, m.md, ctx);
+        REQUIRE(up.has_value());
+        REQUIRE(down.has_value());
+
+        ir::risk::AadRiskEngine engine;
+        for (std::size_t k = 0; k < trades.size(); ++k) {
+            auto aad = engine.compute(trades[k], m.md, ctx);
+            REQUIRE(aad.has_value());
+            REQUIRE(std::abs(aad.value().pv - pvs[k].value().pv) <= 1e-9 * std::abs(pvs[k].value().pv));
+            REQUIRE(aad.value().pillars.size() == up.value().pillars.size());
+
+            for (std::size_t p = 0; p < aad.value().pillars.size(); ++p) {
+                REQUIRE(aad.value().pillars[p].curve == up.value().pillars[p].curve);
+                // Central difference: bump-and-reprice up and down, convexity cancels
+                const double fd = 0.5 * (up.value().trade_delta(p, k) - down.value().trade_delta(p, k));
+                REQUIRE(std::abs(aad.value().deltas[p] - fd) <= 1e-6 * std::abs(fd) + 1e-8);
+            }
+        }
+    }
+}
+
+TEST_CASE("AadRiskEngine: repeated calls reuse the tape", "[risk][aad]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+    const PricingContext ctx{ asof };
+
+    ir::risk::AadRiskEngine engine;
+    auto first = engine.compute(trades[0], m.md, ctx);
+    REQUIRE(first.has_value());
+    const std::size_t bytes = engine.tape().bytes();
+
+    auto second = engine.compute(trades[0], m.md, ctx);
+    REQUIRE(second.has_value());
+    REQUIRE(engine.tape().bytes() == bytes);
+    REQUIRE(second.value().tape_nodes == first.value().tape_nodes);
+    REQUIRE(second.value().gradient == first.value().gradient);
+
+    // A fixed leg has no forward curve risk
+    auto fixed = engine.compute(trades[2], m.md, ctx);
+    REQUIRE(fixed.has_value());
+    for (std::size_t p = 0; p < fixed.value().pillars.size(); ++p) {
+        if (fixed.value().pillars[p].role == ir::risk::CurveRole::Forward) {
+            REQUIRE(fixed.value().gradient[p] == 0.0);
+        }
+    }
+}
+
+TEST_CASE("AadRiskEngine: missing curves and fixings are errors", "[risk][aad]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+    ir::risk::AadRiskEngine engine;
+
+    PricingContext ctx{ asof };
+    ctx.ibor_forward_curve = ir::CurveId{ "FWD_MISSING" };
+    auto no_curve = engine.compute(trades[0], m.md, ctx);
+    REQUIRE_FALSE(no_curve.has_value());
+    REQUIRE(no_curve.error().message.find("FWD_MISSING") != std::string::npos);
+
+    ir::market::FixingStore empty;
+    m.md.set_fixings(&empty);
+    auto no_fixings = engine.compute(trades[1], m.md, PricingContext{ asof });
+    REQUIRE_FALSE(no_fixings.has_value());
+    REQUIRE(no_fixings.error().message.find("fixing") != std::string::npos);
+}
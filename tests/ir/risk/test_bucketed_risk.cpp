@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/risk/bucketed_risk.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using ir::testing::discount_curve;
+using ir::testing::forward_curve;
+using ir::testing::make_ladder;
+using ir::testing::yearly_grid;
+using ir::testing::zero_nodes;
+
+TEST_CASE("BucketedRiskEngine: skipping unaffected cashflows does not change the deltas", "[risk]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    const auto grid = yearly_grid(30);
+    ir::market::FixingStore fixings;
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, forward_curve(asof, zero_nodes(0.032, 0.0004, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_RFR" }, forward_curve(asof, zero_nodes(0.029, 0.0004, grid)));
+    const auto trades = make_ladder(asof);
+
+    ir::risk::BucketedRiskOptions full_opts;
+    full_opts.threads = 1;
+    full_opts.skip_unaffected = false;
+    auto full = ir::risk::BucketedRiskEngine(full_opts).compute(trades, md, PricingContext{ asof });
+    auto fast = ir::risk::BucketedRiskEngine(ir::risk::BucketedRiskOptions{ 1e-4, 4, 1 }).compute(trades, md, PricingContext{ asof });
+    REQUIRE(full.has_value());
+    REQUIRE(fast.has_value());
+
+    const auto& f = full.value();
+    const auto& r = fast.value();
+    REQUIRE(r.pillars.size() == 3 * 31);
+    REQUIRE(r.legs.size() == 15);
+    REQUIRE(r.legs[0].trade == 0);
+    REQUIRE(r.legs[14].trade == 8);
+    REQUIRE(r.cashflows_repriced < f.cashflows_repriced / 5);
+
+    for (std::size_t p = 0; p < r.pillars.size(); ++p) {
+        for (std::size_t l = 0; l < r.legs.size(); ++l) {
+            REQUIRE(std::abs(r.leg_delta(p, l) - f.leg_delta(p, l)) < 1e-7);
+        }
+    }
+
+    // The forward curve risk of an IBOR swap sits on its float leg only
+    // (trade 0 is a 2Y swap, so FWD_IBOR node t = 5 does not move it at all)
+    const std::size_t ibor_1y = 31 + 1;
+    const std::size_t ibor_5y = 31 + 5;
+    REQUIRE(r.pillars[ibor_1y].curve == ir::CurveId{ "FWD_IBOR" });
+    REQUIRE(r.pillars[ibor_1y].t == 1.0);
+    REQUIRE(r.leg_delta(ibor_1y, 0) == 0.0);
+    REQUIRE(r.leg_delta(ibor_1y, 1) != 0.0);
+    REQUIRE(r.trade_delta(ibor_1y, 0) == r.leg_delta(ibor_1y, 1));
+    REQUIRE(r.trade_delta(ibor_5y, 0) == 0.0);
+
+    // The base market is untouched
+    REQUIRE(md.discount_curve(ir::CurveId{ "DISCOUNT" }).df(Date::from_ymd(2031, 3, 1))
+        == discount_curve(asof, zero_nodes(0.03, 0.0005, grid))->df(Date::from_ymd(2031, 3, 1)));
+}
+
+TEST_CASE("BucketedRiskEngine: key-rate deltas add up to a parallel shift", "[risk]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    const auto grid = yearly_grid(30);
+    ir::market::FixingStore fixings;
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, forward_curve(asof, zero_nodes(0.032, 0.0004, grid)));
+    md.set_forward_curve(ir::CurveId{ "FWD_RFR" }, forward_curve(asof, zero_nodes(0.029, 0.0004, grid)));
+    const auto trades = make_ladder(asof);
+    const PricingContext ctx{ asof };
+
+    auto risk = ir::risk::BucketedRiskEngine().compute(trades, md, ctx);
+    REQUIRE(risk.has_value());
+
+    ir::market::MarketData shifted = md;
+    shifted.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005, grid, 1e-4)));
+    PortfolioPricer pricer(PortfolioOptions{ 1 });
+    const auto base = pricer.price(trades, md, ctx);
+    const auto bumped = pricer.price(trades, shifted, ctx);
+
+    for (std::size_t k = 0; k < trades.size(); ++k) {
+        double sum = 0.0;
+        for (std::size_t p = 0; p < 31; ++p) sum += risk.value().trade_delta(p, k);
+        const double parallel = bumped[k].value().pv - base[k].value().pv;
+        REQUIRE(std::abs(sum - parallel) <= 1e-2 * std::abs(parallel));
+    }
+}
+
+TEST_CASE("BucketedRiskEngine: a trade that cannot be priced is an error", "[risk]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    const auto grid = yearly_grid(30);
+    ir::market::FixingStore fixings;
+    ir::market::MarketData md(asof);
+    md.set_fixings(&fixings);
+    md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005, grid)));
+
+    const auto trades = make_ladder(asof);   // the swaps need forward curves
+    auto risk = ir::risk::BucketedRiskEngine().compute(trades, md, PricingContext{ asof });
+    REQUIRE_FALSE(risk.has_value());
+    REQUIRE(risk.error().message.find("trade 0") != std::string::npos);
+}
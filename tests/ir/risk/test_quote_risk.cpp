@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/bootstrapper.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/market/rate_helpers.hpp"
+#include "ir/pricers/swap_pricer.hpp"
+#include "ir/risk/aad_risk.hpp"
+#include "ir/risk/quote_risk.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::market;
+using namespace ir::pricers;
+
+using ir::testing::schedule;
+
+namespace {
+
+    struct Curves {
+        std::shared_ptr<PiecewiseDiscountCurve> disc;
+        std::shared_ptr<PiecewiseForwardCurve> fwd;
+        BootstrapSensitivities disc_sens;
+        BootstrapSensitivities fwd_sens;
+    };
+
+    // OIS discount curve and IRS forward curve, 1Y .. 12Y
+    Curves build(const Date& asof, const std::vector<double>& ois, const std::vector<double>& irs) {
+        std::vector<std::shared_ptr<OisSwapHelper>> dh;
+        std::vector<std::shared_ptr<RateHelper>> fh;
+        for (std::size_t i = 0; i < ois.size(); ++i) {
+            const Date end = ir::Calendar{}.advance(asof, ir::Tenor{ static_cast<int>(i) + 1, ir::TenorUnit::Years },
+                ir::BusinessDayConvention::ModifiedFollowing);
+            dh.push_back(std::make_shared<OisSwapHelper>(asof, end, ois[i], OisSwapHelper::Config{}));
+            fh.push_back(std::make_shared<IrsHelper>(asof, end, irs[i], IrsHelper::Config{}));
+        }
+        BootstrapOptions opts;
+        opts.pillar_solver = PillarSolver::Newton;
+        opts.solver.tol_abs = 1e-15;
+        opts.solver.tol_rel = 1e-14;
+
+        Curves c;
+        CurveBootstrapper b;
+        c.disc = b.bootstrap_discount_curve(asof, {}, dh, opts, nullptr, &c.disc_sens).value();
+        c.fwd = b.bootstrap_forward_curve(asof, {}, *c.disc, fh, opts, nullptr, &c.fwd_sens).value();
+        return c;
+    }
+
+} // namespace
+
+TEST_CASE("QuoteRiskMap: node gradient x d(node)/d(quote) matches re-bootstrap and reprice", "[risk][quote_risk]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    std::vector<double> ois, irs;
+    for (int i = 1; i <= 12; ++i) {
+        ois.push_back(0.024 + 0.0007 * i);
+        irs.push_back(0.027 + 0.0006 * i);
+    }
+
+    FixedLegConfig fc;
+    fc.notional = 1e7;
+    fc.fixed_rate = 0.031;
+    IborLegConfig ic;
+    ic.notional = fc.notional;
+    ic.index = ir::IndexId{ "EURIBOR3M" };
+    const InterestRateSwap swap(TradeInfo{},
+        LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, 7, 12), fc),
+        LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, 7, 3), ic,
+            ir::Calendar{}, ir::BusinessDayConvention::ModifiedFollowing));
+    const PricingContext ctx{ asof };
+    FixingStore fixings;
+
+    auto market = [&](const Curves& c) {
+        MarketData md(asof);
+        md.set_fixings(&fixings);
+        md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, c.disc);
+        md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, c.fwd);
+        return md;
+    };
+
+    const Curves base = build(asof, ois, irs);
+    const MarketData md = market(base);
+
+    ir::risk::QuoteRiskMap map;
+    REQUIRE(map.add_discount_curve(ir::CurveId{ "DISCOUNT" }, base.disc_sens).has_value());
+    REQUIRE(map.add_forward_curve(ir::CurveId{ "FWD_IBOR" }, base.fwd_sens, ir::CurveId{ "DISCOUNT" }).has_value());
+    REQUIRE(map.quotes().size() == 24);
+    REQUIRE(map.quotes()[12].curve == ir::CurveId{ "FWD_IBOR" });
+
+    ir::risk::AadRiskEngine engine;
+    auto node_risk = engine.compute(PortfolioTrade{ swap }, md, ctx);
+    REQUIRE(node_risk.has_value());
+    auto m = map.matrix(node_risk.value().pillars);
+    REQUIRE(m.has_value());
+    const auto deltas = ir::risk::quote_deltas(m.value(), node_risk.value().gradient, 1e-4);
+    REQUIRE(deltas.size() == 24);
+
+    MultiCurveSwapPricer pricer;
+    const double h = 1e-5;
+    for (std::size_t q = 0; q < 24; ++q) {
+        auto repriced = [&](double s) {
+            auto o = ois;
+            auto r = irs;
+            (q < 12 ? o[q] : r[q - 12]) += s;
+            return pricer.price(swap, market(build(asof, o, r)), ctx).value().pv;
+        };
+        const double fd = (repriced(h) - repriced(-h)) / (2.0 * h) * 1e-4;
+        REQUIRE(std::abs(deltas[q] - fd) <= 1e-5 * std::abs(fd) + 1e-4);
+    }
+    // The 7Y swap does not see quotes beyond its maturity
+    REQUIRE(deltas[11] == 0.0);
+    REQUIRE(deltas[23] == 0.0);
+}
+
+TEST_CASE("QuoteRiskMap: a forward curve needs its discount curve first", "[risk][quote_risk]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    const Curves c = build(asof, { 0.025, 0.026, 0.027 }, { 0.028, 0.029, 0.030 });
+
+    ir::risk::QuoteRiskMap map;
+    auto early = map.add_forward_curve(ir::CurveId{ "FWD_IBOR" }, c.fwd_sens, ir::CurveId{ "DISCOUNT" });
+    REQUIRE_FALSE(early.has_value());
+    REQUIRE(early.error().message.find("DISCOUNT") != std::string::npos);
+
+    REQUIRE(map.add_discount_curve(ir::CurveId{ "DISCOUNT" }, c.disc_sens).has_value());
+    REQUIRE_FALSE(map.add_discount_curve(ir::CurveId{ "DISCOUNT" }, c.disc_sens).has_value());
+    REQUIRE(map.add_forward_curve(ir::CurveId{ "FWD_IBOR" }, c.fwd_sens, ir::CurveId{ "DISCOUNT" }).has_value());
+}
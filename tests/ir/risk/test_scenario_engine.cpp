@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+#include "ir/risk/scenario_engine.hpp"
+
+#include "support/risk_fixtures.hpp"
+
+using ir::Date;
+using namespace ir::instruments;
+using namespace ir::pricers;
+
+using ir::testing::Market;
+using ir::testing::make_trades;
+
+TEST_CASE("ScenarioEngine: scenario PVs match the pricer on the scenario market", "[risk][scenario]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    auto trades = make_trades(asof);
+    PricingContext single{ asof };
+    single.framework = PricingFramework::SingleCurve;
+    trades.push_back(PortfolioTrade{ trades[1].product, single });   // OIS swap, single-curve
+
+    using ir::risk::CurveRole;
+    using ir::risk::CurveShift;
+    const ir::CurveId disc{ "DISCOUNT" };
+    const ir::CurveId ibor{ "FWD_IBOR" };
+    const ir::CurveId rfr{ "FWD_RFR" };
+
+    std::vector<double> moves(11);
+    for (std::size_t i = 0; i < moves.size(); ++i) moves[i] = 1e-4 * std::sin(1.0 + static_cast<double>(i));
+
+    std::vector<ir::risk::Scenario> scenarios;
+    scenarios.push_back({ "unchanged", {} });
+    scenarios.push_back({ "parallel +25bp", {
+        CurveShift{ disc, CurveRole::Discount, 0.0025 },
+        CurveShift{ ibor, CurveRole::Forward, 0.0025 },
+        CurveShift{ rfr, CurveRole::Forward, 0.0025 } } });
+    scenarios.push_back({ "steepener", { CurveShift{ disc, CurveRole::Discount, 0.0, 0.0002, 5.0 } } });
+    scenarios.push_back({ "historical", {
+        CurveShift{ ibor, CurveRole::Forward, 0.0, 0.0, 0.0, moves },
+        CurveShift{ rfr, CurveRole::Forward, -0.001, 0.0, 0.0, moves } } });
+
+    const PricingContext ctx{ asof };
+    const PortfolioPricer pricer(PortfolioOptions{ 1 });
+    const auto base = pricer.price(trades, m.md, ctx);
+
+    auto out = ir::risk::ScenarioEngine(ir::risk::ScenarioOptions{ 3, 1 }).run(trades, m.md, scenarios, ctx);
+    REQUIRE(out.has_value());
+    const auto& r = out.value();
+    REQUIRE(r.trades == trades.size());
+    REQUIRE(r.scenarios.size() == scenarios.size());
+    REQUIRE(r.pv.size() == scenarios.size() * trades.size());
+
+    for (std::size_t k = 0; k < trades.size(); ++k) {
+        const double pv = base[k].value().pv;
+        REQUIRE(std::abs(r.base_pv[k] - pv) <= 1e-9 * std::abs(pv));
+        REQUIRE(std::abs(r.pnl(0, k)) <= 1e-9 * std::abs(pv));
+    }
+
+    for (std::size_t s = 1; s < scenarios.size(); ++s) {
+        auto md = ir::risk::ScenarioEngine::scenario_market(m.md, scenarios[s]);
+        REQUIRE(md.has_value());
+        const auto expected = pricer.price(trades, md.value(), ctx);
+        for (std::size_t k = 0; k < trades.size(); ++k) {
+            const double pv = expected[k].value().pv;
+            REQUIRE(std::abs(r.trade_pv(s, k) - pv) <= 1e-9 * std::abs(pv));
+        }
+    }
+    REQUIRE(r.pnl(1, 0) != 0.0);
+    REQUIRE(r.pnl(3, 2) == 0.0);   // a fixed leg does not see forward curves
+
+    // Only the shifted curves are replaced in the scenario market
+    auto steep = ir::risk::ScenarioEngine::scenario_market(m.md, scenarios[2]);
+    REQUIRE(steep.has_value());
+    REQUIRE(&steep.value().forward_curve(ibor) == &m.md.forward_curve(ibor));
+    REQUIRE(&steep.value().discount_curve(disc) != &m.md.discount_curve(disc));
+    REQUIRE(steep.value().forward_curve_ids().size() == 2);
+}
+
+TEST_CASE("ScenarioEngine: invalid shifts and trades fail the run", "[risk][scenario]") {
+    const Date asof = Date::from_ymd(2026, 1, 2);
+    Market m(asof);
+    const auto trades = make_trades(asof);
+    const PricingContext ctx{ asof };
+    const ir::risk::ScenarioEngine engine(ir::risk::ScenarioOptions{ 1 });
+
+    const std::vector<ir::risk::Scenario> short_moves{ { "short", {
+        ir::risk::CurveShift{ ir::CurveId{ "FWD_IBOR" }, ir::risk::CurveRole::Forward, 0.0, 0.0, 0.0, { 1e-4, 2e-4 } } } } };
+    auto bad_shift = engine.run(trades, m.md, short_moves, ctx);
+    REQUIRE_FALSE(bad_shift.has_value());
+    REQUIRE(bad_shift.error().message.find("scenario short") != std::string::npos);
+
+    const std::vector<ir::risk::Scenario> unknown{ { "unknown", {
+        ir::risk::CurveShift{ ir::CurveId{ "FWD_XYZ" }, ir::risk::CurveRole::Forward, 0.001 } } } };
+    REQUIRE_FALSE(engine.run(trades, m.md, unknown, ctx).has_value());
+
+    PricingContext other{ asof };
+    other.discount_curve = ir::CurveId{ "MISSING" };
+    auto bad_trade = engine.run(trades, m.md, {}, other);
+    REQUIRE_FALSE(bad_trade.has_value());
+    REQUIRE(bad_trade.error().message.find("trade 0") != std::string::npos);
+}
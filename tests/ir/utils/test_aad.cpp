@@ -0,0 +1,53 @@
+#include "ir/utils/aad.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+
+using namespace ir::utils;
+
+TEST_CASE("Tape: one backward sweep gives all partial derivatives", "[aad]") {
+    Tape tape;
+    Tape::Scope scope(tape);
+
+    const AReal x = tape.input(1.5);
+    const AReal y = tape.input(0.7);
+    const AReal z = tape.input(3.0);   // not used by f
+
+    // f = x y + exp(x) / y - log(y) + 2 x
+    const AReal f = x * y + exp(x) / y - log(y) + 2.0 * x;
+    REQUIRE_THAT(f.value(), Catch::Matchers::WithinRel(1.5 * 0.7 + std::exp(1.5) / 0.7 - std::log(0.7) + 3.0, 1e-15));
+
+    tape.propagate(f);
+    REQUIRE_THAT(tape.adjoint(x), Catch::Matchers::WithinRel(0.7 + std::exp(1.5) / 0.7 + 2.0, 1e-14));
+    REQUIRE_THAT(tape.adjoint(y), Catch::Matchers::WithinRel(1.5 - std::exp(1.5) / (0.7 * 0.7) - 1.0 / 0.7, 1e-14));
+    REQUIRE(tape.adjoint(z) == 0.0);
+    REQUIRE(tape.adjoint(AReal(4.0)) == 0.0);
+}
+
+TEST_CASE("Tape: constants are not recorded and rewind reuses the arena", "[aad]") {
+    Tape tape(64);
+    Tape::Scope scope(tape);
+
+    const AReal c = AReal(2.0) * 3.0 + 1.0;
+    REQUIRE_FALSE(c.active());
+    REQUIRE(tape.size() == 0);
+
+    auto record = [&] {
+        AReal x = tape.input(1.0001);
+        AReal acc = 0.0;
+        for (int k = 0; k < 1000; ++k) acc += x * static_cast<double>(k);
+        tape.propagate(acc);
+        return tape.adjoint(x);
+    };
+
+    REQUIRE(record() == 999.0 * 1000.0 / 2.0);
+    const std::size_t nodes = tape.size();
+    const std::size_t bytes = tape.bytes();
+    REQUIRE(nodes == 1 + 2 * 1000);   // input, then x * k and the running sum per step
+
+    tape.rewind();
+    REQUIRE(tape.size() == 0);
+    REQUIRE(record() == 999.0 * 1000.0 / 2.0);
+    REQUIRE(tape.size() == nodes);
+    REQUIRE(tape.bytes() == bytes);
+}
@@ -2,6 +2,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <cmath>
+#include <vector>
 
 using namespace ir::utils;
 
@@ -46,4 +47,76 @@ TEST_CASE("LogLinearInterpolator: log-space linearization and flat extrapolation
     // Flat extrapolation (returns end y values)
     REQUIRE_THAT(lli.value(-1.0), Catch::Matchers::WithinAbs(std::exp(0.0), 1e-12));
     REQUIRE_THAT(lli.value(3.0), Catch::Matchers::WithinAbs(std::exp(2.0), 1e-12));
-}
\ No newline at end of file
+}
+TEST_CASE("LogLinearInterpolator: push_back and set_last_value update in place") {
+    Interp1DData data;
+    data.x = { 0.0, 1.0 };
+    data.y = { std::exp(0.0), std::exp(-1.0) };
+
+    LogLinearInterpolator lli(std::move(data));
+
+    REQUIRE(lli.push_back(2.0, std::exp(-3.0)).has_value());
+    REQUIRE_THAT(lli.value(1.5), Catch::Matchers::WithinAbs(std::exp(-2.0), 1e-12));
+
+    REQUIRE(lli.set_last_value(std::exp(-2.0)).has_value());
+    REQUIRE_THAT(lli.value(1.5), Catch::Matchers::WithinAbs(std::exp(-1.5), 1e-12));
+    REQUIRE_THAT(lli.value(3.0), Catch::Matchers::WithinAbs(std::exp(-2.0), 1e-12));
+
+    // Invalid updates are rejected and leave the interpolator untouched
+    REQUIRE_FALSE(lli.push_back(2.0, 0.5).has_value());
+    REQUIRE_FALSE(lli.set_last_value(0.0).has_value());
+    REQUIRE_THAT(lli.value(2.0), Catch::Matchers::WithinAbs(std::exp(-2.0), 1e-12));
+}
+
+TEST_CASE("LogLinearKernel: matches LogLinearInterpolator; hinted and batch lookups agree") {
+    Interp1DData data{ {0.0, 0.5, 1.0, 2.0, 5.0, 10.0}, {1.0, 0.99, 0.975, 0.95, 0.86, 0.72} };
+    LogLinearInterpolator ref(data);
+    LogLinearKernel k;
+    REQUIRE(k.assign(data.x, data.y).has_value());
+
+    // Sorted probes incl. nodes and both extrapolation sides
+    std::vector<double> xs;
+    for (double x = -1.0; x <= 12.0; x += 0.125) xs.push_back(x);
+
+    std::vector<double> batch(xs.size());
+    k.values(xs, batch);
+
+    std::size_t hint = 0;
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        const double expected = ref.value(xs[i]);
+        REQUIRE_THAT(k.value(xs[i]), Catch::Matchers::WithinRel(expected, 1e-14));
+        REQUIRE_THAT(k.value(xs[i], hint), Catch::Matchers::WithinRel(expected, 1e-14));
+        REQUIRE_THAT(batch[i], Catch::Matchers::WithinRel(expected, 1e-14));
+    }
+
+    // A stale hint (moving backwards) still finds the right segment
+    hint = 4;
+    REQUIRE_THAT(k.value(0.25, hint), Catch::Matchers::WithinRel(ref.value(0.25), 1e-14));
+    REQUIRE(hint == 0);
+
+    auto g = k.value_and_gradient(3.0, hint);
+    auto g_ref = ref.value_and_gradient(3.0);
+    REQUIRE(g.i0 == g_ref.i0);
+    REQUIRE(g.i1 == g_ref.i1);
+    REQUIRE_THAT(g.d0, Catch::Matchers::WithinRel(g_ref.d0, 1e-12));
+    REQUIRE_THAT(g.d1, Catch::Matchers::WithinRel(g_ref.d1, 1e-12));
+}
+
+TEST_CASE("LogLinearKernel: set_value refreshes adjacent slopes") {
+    LogLinearKernel k;
+    REQUIRE(k.push_back(0.0, 1.0).has_value());
+    REQUIRE_FALSE(k.ready());
+    REQUIRE(k.push_back(1.0, 0.98).has_value());
+    REQUIRE(k.push_back(2.0, 0.95).has_value());
+    REQUIRE(k.ready());
+
+    REQUIRE(k.set_value(1, 0.97).has_value());
+    LogLinearInterpolator ref(Interp1DData{ {0.0, 1.0, 2.0}, {1.0, 0.97, 0.95} });
+    for (double x : { 0.3, 1.0, 1.7 }) {
+        REQUIRE_THAT(k.value(x), Catch::Matchers::WithinRel(ref.value(x), 1e-14));
+    }
+
+    REQUIRE_FALSE(k.set_value(3, 0.9).has_value());
+    REQUIRE_FALSE(k.set_value(0, -1.0).has_value());
+    REQUIRE_FALSE(k.push_back(1.5, 0.96).has_value());
+}
@@ -3,6 +3,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <cmath>
+#include <functional>
 
 using namespace ir::utils;
 using namespace ir;
@@ -42,4 +43,57 @@ TEST_CASE("brent: invalid bracket returns error") {
     auto res = brent(f, -1.0, 1.0);
     REQUIRE_FALSE(res.has_value());
     REQUIRE(res.error().code == ErrorCode::InvalidArgument);
-}
\ No newline at end of file
+}
+TEST_CASE("newton: quadratic root f(x)=x^2-2 with analytic derivative") {
+    auto fdf = [](double x, double& dfdx) { dfdx = 2.0 * x; return x * x - 2.0; };
+
+    auto res = newton(fdf, 1.0, 0.0, 2.0);
+    REQUIRE(res.has_value());
+    RootFindResult r = res.value();
+
+    REQUIRE(r.report.converged);
+    REQUIRE(r.report.iterations < 10);
+    REQUIRE_THAT(r.root, Catch::Matchers::WithinAbs(std::sqrt(2.0), 1e-12));
+}
+
+TEST_CASE("newton: zero derivative returns error") {
+    auto fdf = [](double x, double& dfdx) { dfdx = 0.0; return x * x + 1.0; };
+    auto res = newton(fdf, 0.0, -1.0, 1.0);
+    REQUIRE_FALSE(res.has_value());
+    REQUIRE(res.error().code == ErrorCode::InvalidArgument);
+}
+
+TEST_CASE("secant: cubic root f(x)=x^3-x-2") {
+    auto f = [](double x) { return x * x * x - x - 2.0; };
+    auto res = secant(f, 1.0, 2.0);
+    REQUIRE(res.has_value());
+    REQUIRE(res.value().report.converged);
+    REQUIRE_THAT(res.value().root, Catch::Matchers::WithinAbs(1.5213797068045676, 1e-10));
+}
+
+TEST_CASE("bisection: matches brent and rejects unbracketed interval") {
+    auto f = [](double x) { return std::cos(x) - x; };
+    auto bis = bisection(f, 0.0, 1.0);
+    auto br = brent(f, 0.0, 1.0);
+    REQUIRE(bis.has_value());
+    REQUIRE(br.has_value());
+    REQUIRE(bis.value().report.converged);
+    REQUIRE(bis.value().report.iterations > br.value().report.iterations);
+    REQUIRE_THAT(bis.value().root, Catch::Matchers::WithinAbs(br.value().root, 1e-10));
+
+    REQUIRE_FALSE(bisection([](double x) { return x * x + 1.0; }, -1.0, 1.0).has_value());
+}
+
+static double shifted_identity(double x) { return x - 0.25; }
+
+TEST_CASE("brent: accepts std::function, function pointers and stateful functors") {
+    const std::function<double(double)> erased = [](double x) { return x - 0.5; };
+    REQUIRE_THAT(brent(erased, 0.0, 1.0).value().root, Catch::Matchers::WithinAbs(0.5, 1e-12));
+    REQUIRE_THAT(brent(&shifted_identity, 0.0, 1.0).value().root, Catch::Matchers::WithinAbs(0.25, 1e-12));
+
+    int calls = 0;
+    auto counting = [&calls](double x) { ++calls; return x - 0.75; };
+    auto res = brent(counting, 0.0, 1.0);
+    REQUIRE_THAT(res.value().root, Catch::Matchers::WithinAbs(0.75, 1e-12));
+    REQUIRE(calls >= 2);
+}
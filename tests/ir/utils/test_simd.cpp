@@ -0,0 +1,40 @@
+#include "ir/utils/simd.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace ir::utils;
+
+TEST_CASE("simd::exp_inplace agrees with std::exp (incl. remainder lanes)") {
+    INFO("isa: " << simd::isa());
+    // 1003 points: not a multiple of the vector width
+    std::vector<double> x;
+    for (int i = 0; i < 1003; ++i) x.push_back(-60.0 + 0.0657 * i);
+    x.push_back(0.0);
+    x.push_back(-700.0);
+    x.push_back(700.0);
+
+    std::vector<double> y = x;
+    simd::exp_inplace(y);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        REQUIRE_THAT(y[i], Catch::Matchers::WithinRel(std::exp(x[i]), 1e-15));
+    }
+    REQUIRE(y[1003] == 1.0);
+}
+
+TEST_CASE("simd::log_linear_gather evaluates the indexed segments") {
+    const std::vector<double> xs{ 0.0, 1.0, 3.0 };
+    const std::vector<double> ly{ 0.0, -0.02, -0.09 };
+    const std::vector<double> sl{ -0.02, -0.035, 0.0 };
+    const std::vector<std::int64_t> idx{ 0, 1, 1, 2, 0, 1 };
+    const std::vector<double> x{ 0.5, 1.0, 2.0, 3.0, 0.0, 2.5 };
+
+    std::vector<double> out(x.size());
+    simd::log_linear_gather(xs.data(), ly.data(), sl.data(), idx.data(), x.data(), x.size(), out.data());
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        const auto i = static_cast<std::size_t>(idx[k]);
+        REQUIRE_THAT(out[k], Catch::Matchers::WithinAbs(ly[i] + sl[i] * (x[k] - xs[i]), 1e-16));
+    }
+}
@@ -0,0 +1,79 @@
+#include "ir/utils/sparse_matrix.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace ir::utils;
+
+TEST_CASE("SparseMatrix: CSR build, lookup and multiply", "[sparse]") {
+    // [ 2 0 1 ]
+    // [ 0 3 0 ]
+    // [ 4 0 5 ]
+    SparseMatrix m(3, 3);
+    m.push(0, 2.0); m.push(1, 0.0); m.push(2, 1.0); m.end_row();
+    m.push(1, 3.0); m.end_row();
+    m.push(0, 4.0); m.push(2, 5.0); m.end_row();
+
+    REQUIRE(m.nonzeros() == 5);
+    REQUIRE(m.at(0, 1) == 0.0);
+    REQUIRE(m.at(2, 2) == 5.0);
+
+    const auto y = m.multiply({ 1.0, 2.0, 3.0 });
+    REQUIRE(y == std::vector<double>{ 5.0, 6.0, 19.0 });
+
+    const std::vector<double> x{ 1.0, 2.0, 3.0 };
+    REQUIRE(m.multiply_transposed(x) == std::vector<double>{ 14.0, 6.0, 16.0 });
+}
+
+TEST_CASE("solve: LU with pivoting recovers x", "[sparse]") {
+    // Zero on the first diagonal entry forces a row swap
+    SparseMatrix m(3, 3);
+    m.push(1, 1.0); m.push(2, 2.0); m.end_row();
+    m.push(0, 3.0); m.push(1, 1.0); m.end_row();
+    m.push(0, 1.0); m.push(2, 4.0); m.end_row();
+
+    const std::vector<double> x_true{ 1.0, -2.0, 0.5 };
+    auto x = solve(m, m.multiply(x_true));
+    REQUIRE(x.has_value());
+    for (std::size_t i = 0; i < 3; ++i) {
+        REQUIRE_THAT(x.value()[i], Catch::Matchers::WithinAbs(x_true[i], 1e-14));
+    }
+
+    SparseMatrix singular(2, 2);
+    singular.push(0, 1.0); singular.end_row();
+    singular.push(0, 2.0); singular.end_row();
+    REQUIRE_FALSE(solve(singular, { 1.0, 1.0 }).has_value());
+}
+
+TEST_CASE("solve: envelope LU with pivoting fill-in recovers x", "[sparse]") {
+    // Curve-Jacobian shape: nonzero below the diagonal (decaying away from it) and one
+    // entry above. Every third diagonal entry is tiny, so pivoting swaps rows and fills
+    // in past their envelopes.
+    const std::size_t n = 60;
+    SparseMatrix m(n, n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j <= std::min(i + 1, n - 1); ++j) {
+            const double d = 1.0 + static_cast<double>(i > j ? i - j : j - i);
+            double v = (0.2 + 0.02 * static_cast<double>((i * 7 + j * 3) % 11)) / (d * d);
+            if (j == i) v = (i % 3 == 0) ? 1e-3 : 2.0 + 0.1 * static_cast<double>(i % 5);
+            if (j == i + 1 && i % 3 == 0) v = 1.5;
+            m.push(j, v);
+        }
+        m.end_row();
+    }
+
+    std::vector<double> x_true(n);
+    for (std::size_t i = 0; i < n; ++i) x_true[i] = 1.0 - 0.05 * static_cast<double>(i % 9);
+    auto x = solve(m, m.multiply(x_true));
+    REQUIRE(x.has_value());
+    for (std::size_t i = 0; i < n; ++i) {
+        REQUIRE_THAT(x.value()[i], Catch::Matchers::WithinAbs(x_true[i], 1e-10));
+    }
+
+    // An empty row is singular
+    SparseMatrix empty_row(2, 2);
+    empty_row.push(0, 1.0); empty_row.push(1, 1.0); empty_row.end_row();
+    empty_row.end_row();
+    REQUIRE_FALSE(solve(empty_row, { 1.0, 1.0 }).has_value());
+}
@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "ir/utils/thread_pool.hpp"
+
+using ir::utils::ThreadPool;
+
+TEST_CASE("ThreadPool::parallel_for visits every index exactly once", "[utils][thread_pool]") {
+    ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    for (std::size_t grain : { std::size_t{ 1 }, std::size_t{ 7 }, std::size_t{ 1000 } }) {
+        std::vector<std::atomic<int>> hits(997);
+        pool.parallel_for(hits.size(), grain, [&](std::size_t b, std::size_t e) {
+            for (std::size_t i = b; i < e; ++i) hits[i].fetch_add(1);
+            });
+        for (const auto& h : hits) REQUIRE(h.load() == 1);
+    }
+
+    // Empty range is a no-op
+    pool.parallel_for(0, 1, [](std::size_t, std::size_t) { throw std::logic_error("not called"); });
+}
+
+TEST_CASE("ThreadPool: nested parallel_for and exception propagation", "[utils][thread_pool]") {
+    ThreadPool pool(3);
+
+    std::atomic<int> sum{ 0 };
+    pool.parallel_for(8, 1, [&](std::size_t, std::size_t) {
+        pool.parallel_for(10, 2, [&](std::size_t b, std::size_t e) {
+            sum.fetch_add(static_cast<int>(e - b));
+            });
+        });
+    REQUIRE(sum.load() == 80);
+
+    REQUIRE_THROWS_AS(pool.parallel_for(16, 1, [](std::size_t b, std::size_t) {
+        if (b == 5) throw std::runtime_error("chunk failed");
+        }), std::runtime_error);
+
+    // Pool remains usable after a failed batch
+    std::atomic<int> n{ 0 };
+    pool.parallel_for(16, 4, [&](std::size_t b, std::size_t e) { n.fetch_add(static_cast<int>(e - b)); });
+    REQUIRE(n.load() == 16);
+}
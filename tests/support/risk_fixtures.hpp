@@ -0,0 +1,152 @@
+// Market and trades shared by the pricer and risk tests: a 20Y discount curve,
+// IBOR and RFR forward curves and 400 days of SOFR fixings, a book of an IBOR
+// swap, a seasoned OIS swap (first coupons partly realised) and a fixed leg, and a
+// 2Y .. 26Y ladder of swaps and fixed legs.
+#pragma once
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+#include "ir/instruments/leg_builder.hpp"
+#include "ir/instruments/products.hpp"
+#include "ir/market/curves.hpp"
+#include "ir/market/market_data.hpp"
+#include "ir/market/quotes.hpp"
+#include "ir/pricers/portfolio_pricer.hpp"
+
+#include "schedule.hpp"
+
+namespace ir::testing {
+
+    // 11 nodes, 0 .. 20Y
+    inline constexpr double kZeroGrid[] = { 0.0, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0 };
+
+    // 0, 1, .. years
+    inline std::vector<double> yearly_grid(int years) {
+        std::vector<double> t;
+        for (int i = 0; i <= years; ++i) t.push_back(i);
+        return t;
+    }
+
+    // Discount factors exp(-(r0 + slope t + bump) t) on the grid
+    inline ir::utils::Nodes1D zero_nodes(double r0, double slope,
+        std::span<const double> grid = kZeroGrid, double bump = 0.0) {
+        ir::utils::Nodes1D n;
+        for (double t : grid) {
+            n.t.push_back(t);
+            n.v.push_back(std::exp(-(r0 + slope * t + bump) * t));
+        }
+        return n;
+    }
+
+    // Date-cached piecewise discount curve on `nodes`
+    inline std::shared_ptr<ir::market::PiecewiseDiscountCurve> discount_curve(const ir::Date& asof,
+        const ir::utils::Nodes1D& nodes) {
+        ir::market::PiecewiseDiscountCurve::Config cfg;
+        cfg.date_cache_days = ir::market::kDateCache60Y;
+        cfg.date_cache_values = true;
+        auto c = std::make_shared<ir::market::PiecewiseDiscountCurve>(asof, cfg);
+        REQUIRE(c->set_nodes(nodes).has_value());
+        return c;
+    }
+
+    inline std::shared_ptr<ir::market::PiecewiseForwardCurve> forward_curve(const ir::Date& asof,
+        const ir::utils::Nodes1D& nodes) {
+        auto c = std::make_shared<ir::market::PiecewiseForwardCurve>(asof, ir::market::PiecewiseForwardCurve::Config{});
+        REQUIRE(c->set_nodes(nodes).has_value());
+        return c;
+    }
+
+    // DISCOUNT (date-cached), FWD_IBOR and FWD_RFR piecewise curves, and SOFR fixings
+    struct Market {
+        ir::market::FixingStore fixings;
+        ir::market::MarketData md;
+
+        explicit Market(const ir::Date& asof) : md(asof) {
+            md.set_fixings(&fixings);
+            md.set_discount_curve(ir::CurveId{ "DISCOUNT" }, discount_curve(asof, zero_nodes(0.03, 0.0005)));
+            md.set_forward_curve(ir::CurveId{ "FWD_IBOR" }, forward_curve(asof, zero_nodes(0.032, 0.0004)));
+            md.set_forward_curve(ir::CurveId{ "FWD_RFR" }, forward_curve(asof, zero_nodes(0.029, 0.0003)));
+
+            // Realised SOFR days for coupons that started before asof
+            for (ir::Date d = asof + std::chrono::days{ -400 }; d < asof; d = d + std::chrono::days{ 1 }) {
+                fixings.add(ir::IndexId{ "SOFR" }, d, 0.028);
+            }
+        }
+    };
+
+    // 12Y IBOR swap, seasoned 7Y OIS swap, 25Y fixed leg
+    inline std::vector<ir::pricers::PortfolioTrade> make_trades(const ir::Date& asof) {
+        using namespace ir::instruments;
+        using ir::pricers::PortfolioProduct;
+        using ir::pricers::PortfolioTrade;
+
+        const ir::Date seasoned = asof + std::chrono::days{ -100 };   // first coupons partly realised
+        FixedLegConfig fc;
+        fc.notional = 1e6;
+        fc.fixed_rate = 0.03;
+
+        IborLegConfig ic;
+        ic.notional = fc.notional;
+        ic.index = ir::IndexId{ "EURIBOR6M" };
+        RfrLegConfig rc;
+        rc.notional = fc.notional;
+        rc.index = ir::IndexId{ "SOFR" };
+        rc.spread = 0.001;
+
+        std::vector<PortfolioTrade> trades;
+        trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{},
+            LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, 12, 12), fc),
+            LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, 12, 6), ic,
+                ir::Calendar{}, ir::BusinessDayConvention::ModifiedFollowing)) });
+        trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<OisSwap>, TradeInfo{},
+            LegBuilder::build_fixed_leg(PayReceive::Receive, schedule(seasoned, 7, 12), fc),
+            LegBuilder::build_rfr_compound_leg(PayReceive::Pay, schedule(seasoned, 7, 12), rc)) });
+        trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<Leg>,
+            LegBuilder::build_fixed_leg(PayReceive::Receive, schedule(asof, 25, 12), fc)) });
+        return trades;
+    }
+
+    // Nine trades maturing 2Y, 5Y .. 26Y: IBOR swap, OIS swap, fixed leg, repeated
+    inline std::vector<ir::pricers::PortfolioTrade> make_ladder(const ir::Date& asof) {
+        using namespace ir::instruments;
+        using ir::pricers::PortfolioProduct;
+        using ir::pricers::PortfolioTrade;
+
+        std::vector<PortfolioTrade> trades;
+        for (int k = 0; k < 9; ++k) {
+            const int years = 2 + 3 * k;
+            FixedLegConfig fc;
+            fc.notional = 1e6;
+            fc.fixed_rate = 0.03;
+            auto fixed = LegBuilder::build_fixed_leg(PayReceive::Pay, schedule(asof, years, 12), fc);
+            if (k % 3 == 0) {
+                IborLegConfig ic;
+                ic.notional = fc.notional;
+                ic.index = ir::IndexId{ "EURIBOR6M" };
+                auto flt = LegBuilder::build_ibor_leg(PayReceive::Receive, schedule(asof, years, 6), ic,
+                    ir::Calendar{}, ir::BusinessDayConvention::ModifiedFollowing);
+                trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<InterestRateSwap>, TradeInfo{}, fixed, flt) });
+            }
+            else if (k % 3 == 1) {
+                RfrLegConfig rc;
+                rc.notional = fc.notional;
+                rc.index = ir::IndexId{ "SOFR" };
+                auto rfr = LegBuilder::build_rfr_compound_leg(PayReceive::Receive, schedule(asof, years, 12), rc);
+                trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<OisSwap>, TradeInfo{}, fixed, rfr) });
+            }
+            else {
+                trades.push_back(PortfolioTrade{ PortfolioProduct(std::in_place_type<Leg>, fixed) });
+            }
+        }
+        return trades;
+    }
+
+} // namespace ir::testing
@@ -0,0 +1,18 @@
+// Schedule helper shared by the tests and the benchmarks.
+#pragma once
+#include "ir/core/date.hpp"
+#include "ir/core/conventions.hpp"
+
+namespace ir::testing {
+
+    // `years` from start (ModifiedFollowing), one period every `months_per_period`,
+    // weekends-only calendar
+    inline ir::Schedule schedule(const ir::Date& start, int years, int months_per_period) {
+        ir::ScheduleConfig sc;
+        sc.start = start;
+        sc.end = ir::Calendar{}.advance(start, ir::Tenor{ years, ir::TenorUnit::Years }, ir::BusinessDayConvention::ModifiedFollowing);
+        sc.tenor = ir::Tenor{ months_per_period, ir::TenorUnit::Months };
+        return ir::make_schedule(sc);
+    }
+
+} // namespace ir::testing